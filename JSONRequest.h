@@ -10,6 +10,25 @@
 #include <HTTPClient.h>
 #include "time.h"
 #include "ArduinoJson.h"
+#include "eventLog.h"
+#include "heapMonitor.h"
+#include "arena.h"
+#include "trace.h"
+
+//replies are parsed into the scratch arena, which is emptied when the request's done (see arena.h)
+struct ScratchAllocator {
+  void * allocate(size_t n){
+    return scratch.alloc(n);
+  }
+
+  void deallocate(void * p){} //it all goes at once
+
+  void * reallocate(void * p, size_t n){
+    return scratch.grow(p, n);
+  }
+};
+
+typedef BasicJsonDocument<ScratchAllocator> ScratchJsonDocument;
 
 //templates for treating lambda functions as something we can store.
 template <typename CT, typename ... A> class jfunction
@@ -17,7 +36,7 @@ template <typename CT, typename ... A> class jfunction
 
 class jsonFunc{
   public:
-    virtual void operator()(DynamicJsonDocument&);
+    virtual void operator()(JsonDocument&);
 };
 
 template <typename C> class jfunction<C>: public jsonFunc {
@@ -27,7 +46,7 @@ private:
 public:
     jfunction(const C & obj) : mObject(obj) {}
 
-    void operator()(DynamicJsonDocument& a) {
+    void operator()(JsonDocument& a) {
         this->mObject(a);
     }
 };
@@ -50,8 +69,9 @@ public:
   bool lambda;
   bool running;
 
-  void (*voidCB)(DynamicJsonDocument&); //store a normal function as a callback
-  jsonFunc* callback; //store a lambda func as a callback
+  void (*voidCB)(JsonDocument&); //store a normal function as a callback
+  jsonFunc* callback = NULL; //store a lambda func as a callback
+  size_t callbackSize = 0;
 
   JSONCall(){
     now = 0;
@@ -63,35 +83,49 @@ public:
 
   //handle the backend http request
   void call(){
-    Serial.println("made the call");
-    HTTPClient req;
-    req.begin(url);
+    LOGI(EV_HTTP_CALL, type);
+    ScratchJsonDocument doc(2000);
+    DeserializationError error;
     int httpCode = 0;
-    Serial.println(url);
-
-    //Make the request, depending on type; this is blocking.
-    if(type == GET) httpCode = req.GET(), Serial.println("Getting");
-    else if(type == POST) httpCode = req.POST(data);
-    else if(type == PUT) httpCode = req.PUT(data);
+    if(trace.replaying) httpCode = trace.playReply(doc, error); //the reply this request got when the trace was recorded
+    else {
+      HTTPClient req;
+      req.useHTTP10(true); //no chunked replies, so the json can be parsed straight off the connection
+      req.begin(url);
+      if(debug) Serial.println(url);
+
+      //Make the request, depending on type; this is blocking.
+      if(type == GET) httpCode = req.GET();
+      else if(type == POST) httpCode = req.POST(data);
+      else if(type == PUT) httpCode = req.PUT(data);
+
+      if(httpCode > 0 && trace.recording){ //keep a copy of the reply on its way through
+        TraceTee tee(req.getStream(), trace.reply);
+        error = deserializeJson(doc, tee);
+        trace.recordReply(httpCode, tee.len, tee.total);
+      } else if(httpCode > 0) error = deserializeJson(doc, req.getStream()); //parse the reply as it comes in, without keeping it as a string
+      else trace.recordReply(httpCode, 0);
+      req.end();
+    }
 
     //handle the response
     if (httpCode > 0) { //doesn't handle any 400 codes, but oh well
-      DynamicJsonDocument doc(2000);
-      DeserializationError error = deserializeJson(doc, req.getString()); //parse the return string
-  
       // Test if parsing succeeds.
       if (error) {
-        Serial.print(F("deserializeJson() failed: "));
-        Serial.println(error.f_str());
+        LOGW(EV_JSON_ERROR, error.code());
       } else {
         if(!lambda) voidCB(doc); //make the callbacks, depending on if it's a lambda func or not.
         else (*callback)(doc);
-        delete callback;
       }
-    } else if(debug){
-      Serial.println("HTTP Error:");
-      Serial.println(httpCode);
+    } else LOGW(EV_HTTP_ERROR, httpCode);
+    if(lambda){ //the callback's done with, whether it got called or not
+      delete callback;
+      heapMon.note(HEAP_CALLBACKS, -(int32_t)callbackSize);
+      callback = NULL;
+      lambda = false;
     }
+    running = false;
+    scratch.reset();
   }
 
   //funcs to set callbacks and start the call. 
@@ -101,17 +135,20 @@ public:
     else type = GET;
     url = URL;
     callback = new jfunction<C>(CB);
+    callbackSize = sizeof(jfunction<C>);
+    heapMon.note(HEAP_CALLBACKS, callbackSize);
     running = true;
     lambda = true;
     //startRequest();
     call();
   }
 
-  void request(String URL, void (*CB)(DynamicJsonDocument&), String DATA = ""){
+  void request(String URL, void (*CB)(JsonDocument&), String DATA = ""){
     if(DATA.length()) type = POST;
     else type = GET;
     url = URL;
     running = true;
+    lambda = false;
     voidCB = CB;
     call();
     //startRequest();
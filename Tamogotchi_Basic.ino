@@ -12,20 +12,30 @@ const char * cfgPath = "/cfg.txt";
 //#include <ArduinoJson.hpp>
 
 // Include image arrays
-#include "smallDogsAlt.h"
-#include "smallBg.h"
-#include "emoji.h"
-#include "bubble.h"
+#include "packedAssets.h" //the sprite sheets, compressed; run tools/pack.py after changing the images
+#include "skinPack.h"
 #include "timeout.h"
 #include "button.h"
+#include "lighting.h"
+#include "sheet.h"
+#include "tileCache.h"
+#include "trajectory.h"
+#include "wifiScan.h"
+#include "wifiConnect.h"
+#include "timeKeeper.h"
+#include "fixedString.h"
+#include "scene.h"
+#include "handoff.h"
 
 // Include the TFT library - see https://github.com/Bodmer/TFT_eSPI for library information
 #include "SPI.h"
 #include <TFT_eSPI.h>              // Hardware-specific library
+#include "capture.h"
+#include "bench.h"
 TFT_eSPI tft = TFT_eSPI();
 
 ///// Configurable options //////////////
-String openWeatherMapKey = "13814bdc6b51a9b56707ceb3585f3f90"; //you'll need to get this app key from https://openweathermap.org/api_keys
+const char * openWeatherMapKey = "13814bdc6b51a9b56707ceb3585f3f90"; //you'll need to get this app key from https://openweathermap.org/api_keys
 
 // default configuration file; only used if the config.txt file hasn't been created. 
 // Add your wifi SSID and password into the respective arrays at the same index in each
@@ -34,7 +44,10 @@ char cfgJson[] = "{ \
   \"password\":[\"\",\"i<3making\"],\
   \"ssid\":[\"CarletonGuests\",\"Growlberry's Home\"],\
   \"clock\":true,\
-  \"zipcode\":\"55057\"\
+  \"zipcode\":\"55057\",\
+  \"lat\":44.4583,\
+  \"lon\":-93.1616,\
+  \"tz\":-21600\
 }";
 
 
@@ -49,17 +62,49 @@ enum Menu {
 //TFT sprites to render the background and sprites
 TFT_eSprite bgSpr = TFT_eSprite(&tft);
 TFT_eSprite spr = TFT_eSprite(&tft);
-TFT_eSprite dogSpr = TFT_eSprite(&tft);
 TFT_eSprite emojiSpr = TFT_eSprite(&tft);
-TFT_eSprite bubbleSpr = TFT_eSprite(&tft);
+TFT_eSprite baseSpr = TFT_eSprite(&tft); //the background with the static things (poops) baked in; copied into spr every frame
+int basePhase = -1; //the light baseSpr was drawn in
+
+Sheet dogSheet; //8 bit dog frames, with flipped copies of the rows that face left
+Sheet bubbleSheet; //the speech bubble, both ways round
+TileCache bubbleTiles; //the bubble with each emote in it, ready to draw
+
+//frames go from the game to the drawing through snapshots (see scene.h)
+TripleBuffer<Scene> scenes;
+uint32_t sceneSeq = 0;
+Rect pendingDirty; //static changes the drawing hasn't caught up with yet
+uint32_t pendingSeq = 0; //the first scene with all of pendingDirty in it
+std::atomic<uint32_t> drawnSeq{0}; //the last scene drawn
+
+//how a skin change went, for the game side to record (see skinChanged)
+struct SkinChange {
+  int skin;
+  bool ok; //false if there wasn't room, and the dog kept the skin it had
+  int32_t freed, held; //bytes of dog frames let go of and taken, for the heap monitor
+};
+
+#ifdef DUAL_CORE
+//things only the drawing core is allowed to do, sent over from the game
+enum RenderCmdType { CMD_SKIN };
+struct RenderCmd {
+  uint8_t type;
+  int arg;
+};
+
+TaskHandle_t renderTask = NULL;
+SpscQueue<RenderCmd, 8> renderCmds; //game -> drawing
+SpscQueue<uint32_t, 16> frameReports; //drawing -> game: microseconds each frame took
+SpscQueue<SkinChange, 8> skinChanges; //drawing -> game: how the skin changes it was sent went
+#endif
 
 //physical button declarations
 Button leftBut;
 Button midBut;
 Button rightBut;
 
-//Temp string to store keyboard content
-String kbString = "";
+//Temp string to store keyboard content; long enough for a wifi password
+FixedString<64> kbString;
 char kbInd = 65;  //declaration for current character pointer
 
 //longs to store time for menu related functions.
@@ -81,22 +126,22 @@ Menu menu = HIDDEN; //current menu mode flag, not used?
 bool bMenu = false; //bool storing whether the menu is open or not
 
 //Strings for toggle options
-String toggleChoices[] = {"OFF", "ON"};
+const char * toggleChoices[] = {"OFF", "ON"};
 
 //index for toggle options, probably should be a bool
 int toggleInd = 0;
 
+int skinInd = 0; //dog skin shown in the skin menu
+
 //vars for dealing with listing SSIDs
-int ssidInd = 0; //index for currently displayed SSID
-int numSsids = 0; //total number of SSIDs found
+int ssidInd = 0; //index for currently displayed SSID, in wifiScan's list
 int curSSID = 0; //index for saved SSID
+char macAddress[18]; //for the mac menu; it doesn't change, so it's only formatted once
 
 //variables for storing info about current time and temp
-String tempString = "";
+FixedString<8> tempString;
 int timezoneOffset = 0;
-unsigned long sunrise = 0;
-unsigned long sunset = 0;
-bool daytime = true;
+SunTimes sun; //today's sunrise and sunset, worked out on the device (see solar.h)
 
 /*///////////////////////////////////////////////////////////////////////
 The menu is entirely stored in menuDoc as JSON nodes.
@@ -113,6 +158,7 @@ char menuJson[] = "{\"name\":\"main\",\"opts\":[\
   {\"name\":\"settings\",\"icon\":8, \"opts\":[\
     {\"name\":\"clock\", \"icon\":11, \"type\":\"toggle\"},\
     {\"name\":\"weather\", \"icon\":12, \"type\":\"kb\",\"range\":[48,57,48]},\
+    {\"name\":\"skin\", \"icon\":3, \"type\":\"display\"},\
     {\"name\":\"wifi\",\"icon\":10, \"opts\":[ \
       {\"name\":\"mac\",\"type\":\"display\"},\
       {\"name\":\"ssid\",\"type\":\"display\"},\
@@ -128,9 +174,10 @@ DynamicJsonDocument cfgDoc(1024);
 JsonObject level; //JSONObject reference to store the current menu level.
 
 //vars storing info about the ballchase
-float ballTmr = 0;
+Trajectory ballPath; //the ball's flight; the dog runs around with it for ten seconds after it lands
 bool ballChase = 0;
 bool hasBall = 0;
+int ball = -1; //world index of the ball, while it's out
   
 Dog dog; //create our dog instance.
 
@@ -138,8 +185,8 @@ Dog dog; //create our dog instance.
 //function to select the next menu level down.
 void selectLevel(){
   menuLevel++; //increment the level pointer
+  LOGD(EV_MENU_LEVEL, menuLevel, level["ind"].as<int>()); //log where we went
   level = level["opts"][level["ind"].as<int>()]; //set the level to the currently displayed option
-  Serial.println(level["name"].as<String>()); // and print
 }
 
 //function to go to the previous menu level
@@ -149,11 +196,11 @@ void previousLevel(){
     level = level["opts"][level["ind"].as<int>()];
   }
   menuLevel--; //decrement the menu level index.
-  Serial.println(level["name"].as<String>());
+  LOGD(EV_MENU_LEVEL, menuLevel, level["ind"].as<int>());
 }
 
 // print text into the menu area at a specified size.
-void menuText(String prnt, int size = 2){
+void menuText(const char * prnt, int size = 2){
   spr.setTextSize(size); //set the text size
   int twid = spr.textWidth(prnt); // and get the width of the printed text
   spr.setCursor(120 - twid/2, 240-32); //set the cursor so the text is centered
@@ -192,16 +239,38 @@ void readConfig(){
 //function to update the current temperature
 void updateWeather(){
   //make a webrequest to openweather map; you'll need to get your own key, and change it in the code above.
-  web.request("http://api.openweathermap.org/data/2.5/weather?zip="+cfgDoc["zipcode"].as<String>()+",us&units=imperial&appid="+openWeatherMapKey, [](DynamicJsonDocument&doc){
-      tempString = String(doc["main"]["temp"].as<int>()); //get the temp as an integer.
-      timezoneOffset = doc["timezone"].as<int>(); // and pull out the local timezone and sunrise and sunset times.
-      sunrise = doc["sys"]["sunrise"].as<unsigned long>();
-      sunset = doc["sys"]["sunset"].as<unsigned long>();
-      time_t now;
-      time(&now);
-      daytime = (now > sunrise && now < sunset); //check if it's daytime.
+  FixedString<160> url;
+  url.format("http://api.openweathermap.org/data/2.5/weather?zip=%s,us&units=imperial&appid=%s", cfgDoc["zipcode"].as<const char *>(), openWeatherMapKey);
+  web.request(url.c_str(), [](JsonDocument&doc){
+      tempString.format("%d", doc["main"]["temp"].as<int>()); //get the temp as an integer.
+      // and pull out the local timezone and where we are, for working out sunrise and sunset.
+      float lat = doc["coord"]["lat"] | cfgDoc["lat"].as<float>();
+      float lon = doc["coord"]["lon"] | cfgDoc["lon"].as<float>();
+      timezoneOffset = doc["timezone"] | timezoneOffset;
+      if(lat != cfgDoc["lat"].as<float>() || lon != cfgDoc["lon"].as<float>() || timezoneOffset != cfgDoc["tz"].as<int>()){
+        cfgDoc["lat"] = lat, cfgDoc["lon"] = lon, cfgDoc["tz"] = timezoneOffset; //remember them, so it still gets dark without wifi
+        writeConfig();
+        sun.day = -1; //work the sun out again for the new place
+      }
+      timeKeeper.setOffset(timezoneOffset);
+      setDaytime(); //and set the light for the new place
   });
-  setTimeout(updateWeather,600000); //check the weather again in ten minutes.
+  setTimeout(updateWeather,1800000); //check the weather again in half an hour; the sun doesn't need it any more
+}
+
+//work out where the sun is, and set the colour tables to match; fades through dusk around sunrise and sunset.
+//does nothing until the clock has been set.
+void setDaytime(){
+  time_t now = timeKeeper.now();
+  if(!now) return;
+  long today = (now + timezoneOffset) / 86400;
+  if(sun.day != today) sun = solarTimes(today, cfgDoc["lat"] | defaultLat, cfgDoc["lon"] | defaultLon); //once a day
+  lighting.update(now, sun);
+}
+
+void updateLighting(){
+  setDaytime();
+  setTimeout(updateLighting,60000); //and check again in a minute
 }
 
 //====================================================================================
@@ -221,37 +290,39 @@ void setup()
   }
 
   readConfig(); // read in the stored config file
+  trace.begin(); //seed random(), and start recording or playing back a trace (see trace.h)
+  timezoneOffset = cfgDoc["tz"] | 0; //the last time zone we knew, so the clock is right before the weather comes in
+  timeKeeper.setOffset(timezoneOffset);
 
   deserializeJson(menuDoc, menuJson); // parse the menu string from the top of this file. 
+  heapMon.note(HEAP_JSON, menuDoc.capacity());
+  heapMon.note(HEAP_JSON, cfgDoc.capacity());
 
   //serializeJson(cfgDoc, Serial); // print the config file to the serial 
 
   // Initialise the TFT
   tft.init();  // start communication with the display
-  dogSpr.setColorDepth(8); //minimize the size of the sprite by setting an 8 bit color palette
-  bgSpr.setColorDepth(8);
-  spr.setColorDepth(8);
-
-  //allocate memory for each of the sprites
-  dogSpr.createSprite(32,32); //1/4 resolution dog
-  bubbleSpr.createSprite(32,32);
-  emojiSpr.createSprite(16,16);
-  bgSpr.createSprite(120,120); //half resolution background
-  spr.createSprite(240,240); //full screen size frame buffer
-
-  bgSpr.pushImage(0, 0, SMALLBG_WIDTH, SMALLBG_HEIGHT, smallBg); //push the bgImage into the bgSpr, so we can use it to make day/night
-  bubbleSpr.pushImage(0,0, BUBBLE_WIDTH, BUBBLE_HEIGHT, bubble); //store the bubble into a sprite
-
-  scale(&bgSpr,&spr,0,0,2,false); //push a 2x scaled up version of the background into the frame buffer
+  //allocate memory for each of the sprites, 8 bit to keep them small; the blitter reads 8 bit pixels straight out of them
+  makeSprite(emojiSpr, 16,16);
+  makeSprite(bgSpr, 120,120); //half resolution background
+  makeSprite(spr, 240,240); //full screen size frame buffer
+  makeSprite(baseSpr, 240,240); //if this doesn't fit, everything gets drawn every frame, as before
+
+  lighting.begin(); //build the colour tables before anything gets drawn
+  Unpacker unpacker;
+  unpacker.frame(packedBg, 0, (uint8_t *)bgSpr.getPointer()); //unpack the background into the bgSpr, so we can use it to make day/night
+  skinPack.begin(); //find any extra skins in flash
+  skinChanged(setSkin(cfgDoc["skin"] | 0)); //unpack the dog frames once, both ways round
+  bubbleSheet.begin(packedBubble, 0);
+  heapMon.note(HEAP_SHEETS, bubbleSheet.held);
+  Serial.print("Sprite sheets: ");
+  Serial.print(dogSheet.bytes() + bubbleSheet.bytes());
+  Serial.println(" bytes");
+
+  scale(&bgSpr,&spr,0,0,2); //push a 2x scaled up version of the background into the frame buffer
 
   //draw a half opacity black box over the middle of the image.
-  for(int i=0; i<55; i++){
-    for(int j=0; j<spr.width(); j++){
-      uint32_t col = spr.readPixel(j,i+90);
-      col = fastBlend(128, col, TFT_BLACK);
-      spr.drawPixel(j, i+90, col);
-    }
-  }
+  darken(90, 55);
 
   //set the text size and center the text for the splash screen.
   spr.setTextSize(3);
@@ -261,55 +332,22 @@ void setup()
   spr.print("nate-o-gotchi");
 
   //push the frame buffer onto the screen
-  spr.pushSprite(0,0);
-
-  String which = "";
-  String pword = "";
-  bool ssidFound = false;
-
-  //find a local network that matches the name of an SSID in the config file.
-  numSsids = WiFi.scanNetworks();
-  for(int i=0; i<numSsids; i++){ //for all of the found SSIDs
-    for(int j=0; j<cfgDoc["ssid"].size(); j++){ //compare them to the ssids in the config
-      if(cfgDoc["ssid"][j].as<String>() == String(WiFi.SSID(i))){ //if we find a match
-        ssidFound = true; //mark as found
-        which = cfgDoc["ssid"][j].as<String>(); //and store the matching ssid and password
-        pword = cfgDoc["password"][j].as<String>();
-        curSSID = j; //and store the index of the matching config SSID
-        break;
-      }
-    }
-  }
+  captureLabel = "boot";
+  pushFrame(spr);
+  captureLabel = "live";
 
-  if(ssidFound) WiFi.begin(which,pword); //if we found a matching local SSID, try to connect.
+  //get onto one of the saved networks; straight back to the last one if we can (see wifiConnect.h)
+  wifiConnect.begin(cfgDoc["ssid"].as<JsonArray>(), cfgDoc["password"].as<JsonArray>());
+  wifiConnect.connect();
+  if(wifiConnect.saved >= 0) curSSID = wifiConnect.saved; //store the index of the config SSID we're on
+  strlcpy(macAddress, WiFi.macAddress().c_str(), sizeof(macAddress));
 
-  int tryCount = 0; // variable to keep track of connection attempt time.
 
-  while (WiFi.status() != WL_CONNECTED && tryCount < 20 && ssidFound) { //while we're not connected, or for 10 seconds (if an SSID was found)
-    delay(500); //wait.
-    tryCount++;
-    Serial.print(".");
-  }
-  
+  timeKeeper.begin(); //sets the clock in the background, whenever the time servers can be reached (see timeKeeper.h)
 
   if(WiFi.status() == WL_CONNECTED){ //if we connected before the timeout...
     Serial.println(" CONNECTED");
-    updateWeather();
-    configTime(timezoneOffset, 0, "pool.ntp.org", "time.nist.gov"); //configure the current time to the timeserver
-
-    time_t now;
-    while(now < 1703027354){ //and wait for it to be a unix time later than december 19th, 2023
-      time(&now);
-    }
-
-    updateWeather(); //once the time is correct, get the current weather
-    
-
-    Serial.print("Current time is: ");
-    Serial.println(now);
-    Serial.print("Sunset is ");
-    Serial.println(sunset);
-    daytime = (now > sunrise && now < sunset); //update the daytime status.
+    updateWeather(); //get the current weather and time zone; the light gets worked out once the clock is set
   } else {
     Serial.println("TIMED OUT or NOT FOUND");
   }
@@ -325,6 +363,7 @@ void setup()
 
   leftBut.setup(35,[](int state){
     menuTimeout = millis()+30000; //reset the menu timeout to 30 seconds from now.
+    game.wake(); //show the press on the next loop, whatever the frame rate
     if(state){ //if the button was just pressed...
       backPressTimer = millis();
       if(level["type"] == "kb"){ //and the current level is a keyboard select level, 
@@ -337,7 +376,7 @@ void setup()
       }
     } else { //if we just release the back button
       if(!ignoreBackRelease && watchBackPress && level["type"] == "kb"){ //and it is a keyboard level,
-        if(millis()-backPressTimer < 1000) kbString.remove(kbString.length()-1); //and it hasn't been a second since with pressed the button, just delete the last character in the input. 
+        if(millis()-backPressTimer < 1000) kbString.pop(); //and it hasn't been a second since with pressed the button, just delete the last character in the input. 
         //else previousLevel();
       }
       ignoreBackRelease = false;
@@ -351,6 +390,7 @@ void setup()
 
   midBut.setup(16,[](int state){
     menuTimeout = millis()+30000; //keep the menu open for 30 seconds longer
+    game.wake(); //show the press on the next loop, whatever the frame rate
     if(state){ //if we pressed the button
       menuPressTimer = millis(); //store the current time in the menuPress timer
       if(bMenu){ //if the menu is already open
@@ -362,25 +402,25 @@ void setup()
           if(opt["type"] == "kb") kbInd = opt["range"][2].as<int>(); //if it's a keyboard, set the currently displayed character to the options default 
 
           //Set options according to the name of the option
-          if(opt["name"] == "password") kbString = cfgDoc["password"][curSSID].as<String>(); //if it is the password option, set the keyboard input to the current password
-          else if(opt["name"] == "weather") kbString = cfgDoc["zipcode"].as<String>(); //if it's the weather setting, set the keyboard input to the current zipcode from config.
+          if(opt["name"] == "password") kbString = cfgDoc["password"][curSSID].as<const char *>(); //if it is the password option, set the keyboard input to the current password
+          else if(opt["name"] == "weather") kbString = cfgDoc["zipcode"].as<const char *>(); //if it's the weather setting, set the keyboard input to the current zipcode from config.
           else if(opt["name"] == "clock") toggleInd = cfgDoc["clock"].as<bool>(); //if it's the clock config, set it to the current showing state of the clock
-          else if(opt["name"] == "ssid"){ //if it's the SSID option, scan for new wifi hotspots.
-            spr.fillRect(0, 240-36, 240, 36, TFT_BLACK); //make a black rectangle in the frame buffer,
-            menuText("Scanning...",2); //write text onto it.
-            spr.pushSprite(0,0);  //and print it to the screen, so there's feedback about why everything froze. 
-            numSsids = WiFi.scanNetworks();
+          else if(opt["name"] == "skin") skinInd = cfgDoc["skin"] | 0; //start the skin list on the one we're wearing
+          else if(opt["name"] == "ssid"){ //if it's the SSID option, look for new wifi hotspots in the background.
+            ssidInd = 0;
+            wifiScan.start(); //whatever we found last time shows until this finishes
           }
           selectLevel(); //step into the new option.
           ignoreSelectRelease = true; //ignore the release as we step into the next level.
         } else if(level.containsKey("type")){ //if the current level has a type key.
           if(level["name"] == "clock") cfgDoc["clock"] = toggleInd, writeConfig(); //save the current index into the config, and write the config
+          else if(level["name"] == "skin") cfgDoc["skin"] = skinInd, writeConfig(), changeSkin(skinInd); //change into the new skin, and remember it
           else if(level["name"] == "ssid"){ //if the current level is the SSID,
-            String newSSID = WiFi.SSID(ssidInd); //get the name of the new SSID
+            if(!wifiScan.count) return; //nothing found (yet), nothing to pick
+            const char * newSSID = wifiScan.name(ssidInd); //get the name of the new SSID
             bool found = false; //bool to store whether we found the new ssid in the config 
-            Serial.println(newSSID);
             for(int i=0; i<cfgDoc["ssid"].size(); i++){
-              if(cfgDoc["ssid"][i].as<String>() == newSSID){
+              if(cfgDoc["ssid"][i] == newSSID){
                 curSSID = i;
                 found = true; //if we find it, store the index in curSSID
                 break;
@@ -388,22 +428,28 @@ void setup()
             }
             if(!found){ //if we didn't find it, store it.
               curSSID = cfgDoc["ssid"].size();
-              cfgDoc["ssid"][curSSID] = newSSID;
+              cfgDoc["ssid"][curSSID] = (char *)newSSID; //not const, so the json keeps its own copy; the scan list changes
               writeConfig();
             }
+            LOGI(EV_SSID_PICK, ssidInd, curSSID);
           } else if(level["type"] == "kb") watchMenuPress = true;
         } else { //otherwise, let's just do the actions the option wants. Maybe self explanatory.
-          String name = level["opts"][level["ind"].as<int>()]["name"]; //Get the name of the opt.
-          Serial.println(name);
+          JsonVariant name = level["opts"][level["ind"].as<int>()]["name"]; //Get the name of the opt.
+          LOGD(EV_MENU_ACTION, level["ind"].as<int>());
           if(name=="feed"){
             dog.giveFood();
           } else if(name == "play"){
-            ballTmr = millis() + 1000;
-            ballChase = true;
+            int landX, landY;
+            ballLanding(landX, landY);
+            ballPath.throwArc(-32, 60, landX, landY, 40, 1000, game.simTime); //onto the ground in a second, 40 pixels high
+            if(ball < 0) ball = world.spawn(ENT_BALL, -32, 60); //put a ball in the world
+            ballChase = ball >= 0; //if the world is full, there's no ball to chase
             dog.stepTime = 150;
             hasBall = false;
           } else if(name == "poop"){
             curPoops = 0;
+            world.clear(ENT_POOP); //scoop them all up,
+            playArea.clear(); // and free up the ground they were on
             if(dog.note == POOP) dog.note = HEART;
             dog.free();
           }
@@ -437,6 +483,7 @@ void setup()
 
   rightBut.setup(18,[](int state){
     menuTimeout = millis()+30000; //reset the menu close time
+    game.wake(); //show the press on the next loop, whatever the frame rate
     if(state && bMenu){ //if the menu is open
       if(level["opts"]){
         level["ind"] =(level["ind"].as<int>()+1)%level["opts"].size(); //if the current level is a submenu, increment and modulo the index to the number of opts
@@ -446,14 +493,12 @@ void setup()
         } else if(level["type"] == "toggle"){
           toggleInd =!toggleInd; //if it's a toggle, toggle it. 
         } else if(level["name"] == "ssid"){ //increment through the SSID options.
-          ssidInd = (ssidInd+1)%numSsids;
-          Serial.print(ssidInd);
-          Serial.print(" of ");
-          Serial.println(numSsids);
+          if(wifiScan.count) ssidInd = (ssidInd+1)%wifiScan.count;
+          LOGD(EV_SSID_STEP, ssidInd, wifiScan.count);
+        } else if(level["name"] == "skin"){ //step through the skins
+          skinInd = (skinInd+1)%skinCount();
         }
       }
-      drawMenu();
-      spr.pushSprite(0,0); 
     } 
   },20); //20 is the debounce time for the button; any press shorter than 20ms won't be counted.
 
@@ -462,112 +507,243 @@ void setup()
 ////////////////////////////////////////////////////////////////////////
   
 
-  dog.setDrawCB([](){
-    getDogFrame(); //get the current dog frame.
-    scale(&bgSpr,&spr,0,0,2,false); //scale the background into the frame buffer.
+  dog.setTickCB([](){
+    ballTick(game.simTime); //move the ball, and have the dog chase it, on the simulation's fixed tick
+  });
 
-    emojiFrame(POOP); //get teh poop picture.
-    for(int i=0; i<curPoops; i++){ //draw all the poops
-      scale(&emojiSpr,&spr,poops[i].x,poops[i].y,2,false);
+  dog.setDrawCB([](){
+    buildScene(scenes.writing()); //snapshot everything the frame needs,
+    scenes.publish();
+#ifdef DUAL_CORE
+    if(renderTask){ // and let the other core draw it
+      scratch.reset();
+      return;
     }
-    scale(&dogSpr,&spr,dog.x,dog.y,4,dog.shouldMirror()); //scale the dog into the frame buffer
+#endif
+    scenes.update(); // or draw it right here.
+    drawScene(scenes.reading());
+    scratch.reset(); //nothing from this frame is needed any more
+  });
 
-    emojiFrame(dog.state); //get teh dog emotions
-    if(dog.noteTmr > millis() || dog.note){ //draw the bubbles
-      scale(&bubbleSpr,&spr,dog.x+26,dog.y-10,2,dog.left);
-      scale(&emojiSpr,&spr,dog.x+44,dog.y+0,2,false);
-    }
+  for(int i=0; i<cfgDoc["pets"].as<int>(); i++) world.spawnPet(petXmin + random(petXmax-petXmin), petYmin); //add any extra pets from the config
 
-    if(ballChase){ //if we're chasing the ball
-      emojiFrame(PLAY); //get the ball picture
-      if(ballTmr > millis()){ //get the chase timer
-        float pos = (ballTmr -millis())/1000.; //get the percentage of time left in the throw
-        scale(&emojiSpr,&spr,-32+(1.-pos)*272,60 - sin(pos*PI)*40,2,false); //put the ball on an arc depending on the pos percentage
-      } else if(ballTmr + 10000 > millis()){ //for ten seconds after the throw, run around carrying the ball.
-        if(hasBall){
-          scale(&emojiSpr,&spr,dog.x+88,dog.y+68,2,false);
-        } else if(dog.x>=240) hasBall = true;
-        dog.action(RUN,true);
-        dog.left = false;
-      } else ballChase = 0, dog.free(), hasBall = false;
+  updateLighting(); //set the light for the time of day, and keep it updated every minute
+
+  Serial.println("\r\nInitialisation done.");
+  heapMon.report(); //where the heap starts out
+
+#ifdef FRAME_CAPTURE
+  runScenarios(); //capture a frame of each scripted scenario (see scenarios.ino)
+#endif
+#ifdef RUN_BENCHMARKS
+  runBenchmarks(); //time the hot paths and print the results (see benchmarks.ino)
+#endif
+
+  trace.startClock();
+
+#ifdef DUAL_CORE
+  //from here on, frames are drawn and pushed on core 0, and the game, buttons, wifi and flash stay on this one (core 1)
+  game.renderElsewhere = true;
+  xTaskCreatePinnedToCore(renderLoop, "render", 8192, NULL, 1, &renderTask, 0);
+#endif
+
+  //let the dog run around, with the simulation starting from now rather than from boot.
+  game.start(millis());
+  dog.free();
+}
+
+#ifdef DUAL_CORE
+//the drawing core: draw every new scene, and do anything the game asked for that touches what's being drawn from
+void renderLoop(void * param){
+  for(;;){
+    RenderCmd cmd;
+    while(renderCmds.pop(cmd)){
+      if(cmd.type == CMD_SKIN) skinChanges.push(setSkin(cmd.arg)); //the game side records it
+    }
+    if(!scenes.update()){
+      vTaskDelay(1); //nothing new; give the idle task a go
+      continue;
     }
+    uint32_t t = micros();
+    drawScene(scenes.reading());
+    frameReports.push(micros() - t);
+  }
+}
+#endif
 
-    if(cfgDoc["clock"].as<bool>() && WiFi.status() == WL_CONNECTED){ //if the wifi connected, and we're displaying the clock
-      struct tm timeinfo;
-      if(!getLocalTime(&timeinfo)){//get the current time
-        Serial.println("Failed to obtain time");
-        return;
-      }
+//where the ball goes in the dog's mouth, given where the dog is and which way it faces
+int ballMouthX(int dogX, bool faceLeft){
+  return dogX + (faceLeft ? 8 : 88);
+}
 
-      //make a 50% opaque black rectangle at the top of the screen
-      for(int i=0; i<55; i++){
-        for(int j=0; j<spr.width(); j++){
-          uint32_t col = spr.readPixel(j,i);
-          col = fastBlend(128, col, TFT_BLACK);
-          spr.drawPixel(j, i, col);
-        }
-      }
+//can the ball land with the dog's mouth on it when the dog's at dogX on row dogY, and be reached from either side?
+bool ballFits(int dogX, int dogY){
+  int bx = ballMouthX(dogX, false);
+  return playArea.walkable(dogX, dogY) && playArea.walkable(bx - 8, dogY) && playArea.onPanel(bx, dogY+68, 32, 32);
+}
 
-      //format the time and print it.
-      char timeHM[6];
-      strftime(timeHM,6, "%H:%M", &timeinfo);
-      spr.setTextSize(4);
-      int twid = spr.textWidth(timeHM);
-      spr.setCursor(120 - twid/2, 20);
-      spr.setTextColor(TFT_WHITE);
-      spr.print(timeHM);
-      spr.setTextSize(2);
-
-      //print the temperature string at the top of the page
-      twid = spr.textWidth(tempString);
-      spr.setCursor(120 - twid/2, 2);
-      spr.setTextColor(TFT_WHITE);
-      spr.print(tempString);
-      spr.drawArc(120+twid/2+2, 4, 2, 1, 0, 360, TFT_WHITE, TFT_BLACK, true);
+//pick where a thrown ball comes down: on the dog's row, somewhere the dog can run to and pick it up from
+//either side, with the ball fully on the screen (see playArea.h). It used to fly off the right side, which put it
+//off the round panel; this is on purpose. If nowhere random fits, the first spot along the row that does is used.
+void ballLanding(int & X, int & Y){
+  Y = dog.y+68;
+  for(int t=0; t<8; t++){
+    int dogX = petXmin + random(petXmax-petXmin);
+    if(ballFits(dogX, dog.y)){
+      X = ballMouthX(dogX, false);
+      return;
+    }
+  }
+  for(int dogX = petXmin; dogX < petXmax; dogX++){
+    if(ballFits(dogX, dog.y)){
+      X = ballMouthX(dogX, false);
+      return;
     }
+  }
+  X = ballMouthX(dog.x, dog.left); //not on the walking area's rows at all
+}
 
-    drawMenu();
+//if the ball's been thrown, move it along, and have the dog chase it
+void ballTick(unsigned long now){
+  if(!ballChase) return;
+  if(ballPath.since(now) >= 10000){ //ten seconds after it lands, the game's over
+    ballChase = 0, dog.free(), hasBall = false, world.remove(ball), ball = -1;
+    return;
+  }
+  if(!ballPath.done(now)){ //still in the air
+    ballPath.sample(now, world.x[ball], world.y[ball]); //put the ball where it is along the arc
+    world.depth[ball] = 240; //it's in the air, so it goes over everything
+  } else if(!hasBall){
+    world.depth[ball] = 32; //on the ground
+    //got it once it's anywhere between where the mouth is facing left and facing right, ie the dog's run over it
+    int bx = world.x[ball];
+    if(bx >= ballMouthX(dog.x, true) - 16 && bx <= ballMouthX(dog.x, false) + 16) hasBall = true;
+  }
+  if(hasBall){ //run around carrying it, turning round at the edges of the yard
+    world.x[ball] = ballMouthX(dog.x, dog.left), world.y[ball] = dog.y+68; //buildScene() moves it to where the dog's drawn
+    world.depth[ball] = 64; //sorts just in front of the dog, so it's in its mouth
+    if(dog.act != RUN) dog.action(RUN, now, true);
+  } else { //run towards where it's coming down
+    int bx = ballPath.px[trajectorySteps];
+    bool toLeft = dog.left;
+    if(bx > ballMouthX(dog.x, false)) toLeft = false;
+    else if(bx < ballMouthX(dog.x, true)) toLeft = true;
+    if(dog.act != RUN || dog.left != toLeft) dog.left = toLeft, dog.action(RUN, now, true);
+  }
+}
 
-    //push the frame buffer to the screen.
-    spr.pushSprite(0,0);
-  });
+//copy everything the next frame needs out of the game
+void buildScene(Scene & s){
+  s.seq = ++sceneSeq;
+  if(drawnSeq.load() >= pendingSeq) pendingDirty.clear(); //it's all been drawn
+  if(!world.dirty.empty()){ //static things came or went; keep sending them until a scene with them in gets drawn
+    Rect & d = world.dirty;
+    pendingDirty.add(d.x0, d.y0, d.x1-d.x0, d.y1-d.y0);
+    pendingSeq = s.seq;
+    world.dirty.clear();
+  }
+  s.world = world;
+  s.dirty = pendingDirty;
+  s.lightPhase = lighting.target;
+  s.dogX = world.x[dog.ent], s.dogY = world.y[dog.ent]; //where the dog's drawn, so the bubble follows it in between ticks
+  s.dogLeft = dog.left;
+  //a carried ball goes in the mouth of the dog as it's drawn (in between ticks, see Dog::sync()), so it doesn't jitter against it
+  if(hasBall) s.world.x[ball] = ballMouthX(s.dogX, s.dogLeft), s.world.y[ball] = s.dogY+68;
+  s.dogState = dog.state;
+  s.bubble = dog.noteTmr > game.simTime || dog.note;
+  s.clock = cfgDoc["clock"].as<bool>() && timeKeeper.valid(); //if we're displaying the clock, and it's been set (it keeps going without wifi)
+  memcpy(s.hm, timeKeeper.hm, sizeof(s.hm));
+  strlcpy(s.temp, tempString.c_str(), sizeof(s.temp));
+  describeMenu(s.menu);
+}
 
-  Serial.println("\r\nInitialisation done.");
+//draw a scene into the frame buffer, and push it to the screen
+void drawScene(Scene & s){
+  if(s.lightPhase >= 0) lighting.applyPhase(s.lightPhase); //rebuilds the colour tables if the light changed
+  drawBase(s); //the background and everything that doesn't move
+
+  World & w = s.world;
+  w.sort(); //sort everything back to front, 
+  for(int i=0; i<w.numOrder; i++) drawEntity(w, w.order[i]); // and draw it in that order.
+
+  if(s.bubble) drawBubble(s); //draw the bubble with the dog's emotions in it
+
+  if(s.clock){
+    //make a 50% opaque black rectangle at the top of the screen
+    darken(0, 55);
+
+    //print the time; timeKeeper formats it once a minute.
+    spr.setTextSize(4);
+    int twid = spr.textWidth(s.hm);
+    spr.setCursor(120 - twid/2, 20);
+    spr.setTextColor(TFT_WHITE);
+    spr.print(s.hm);
+    spr.setTextSize(2);
+
+    //print the temperature string at the top of the page
+    twid = spr.textWidth(s.temp);
+    spr.setCursor(120 - twid/2, 2);
+    spr.setTextColor(TFT_WHITE);
+    spr.print(s.temp);
+    spr.drawArc(120+twid/2+2, 4, 2, 1, 0, 360, TFT_WHITE, TFT_BLACK, true);
+  }
 
-  //let the dog run around.
-  dog.free();
+  drawMenu(s.menu);
+
+  //push the frame buffer to the screen.
+  pushFrame(spr);
+  drawnSeq.store(s.seq);
 }
 
-void drawMenu(){
-  if(bMenu){ //if the menu is open
-    spr.fillRect(0, 240-36, 240, 36, TFT_BLACK); //draw the black rectangle at the bottom of the page
-    JsonObject cur = level["opts"][level["ind"].as<int>()].as<JsonObject>(); //get the selected option
-    if(cur.containsKey("icon")){ //if the option has an icon, draw it.
-      emojiFrame(cur["icon"].as<int>());
-      scale(&emojiSpr,&spr,120-16,240-34,2,false);
-    } else if(level.containsKey("type")){ //handle "type" options
-      if(level["name"] == "mac") menuText(WiFi.macAddress(),1); //display the mac address
-      else if(level["name"] == "ssid"){
-        menuText(WiFi.SSID(ssidInd)); //display the SSID at the ssidInd index
-      }
-      if(level["type"] == "kb"){ //if we're in a kb input, draw the input string and the next char (next char is in blue)
-        spr.setTextSize(2);
-        int twid = spr.textWidth(kbString)+tft.textWidth(String(kbInd));
-        if(twid > 200) spr.setTextSize(1);
-        twid = spr.textWidth(kbString)+tft.textWidth(String(kbInd));
-        spr.setCursor(120 - twid/2, 240-26);
-        spr.setTextColor(TFT_WHITE);
-        spr.print(kbString);
-        spr.setTextColor(TFT_BLUE);
-        spr.print(String(kbInd));
-      } else if(level["type"] == "toggle"){
-        menuText(toggleChoices[toggleInd]); //display the toggle string (on or off)
-      }
-    } else { //if there is no icon, and not type, just draw the name.
-      menuText(cur["name"].as<String>());
+//work out what the menu bar shows, from where we are in the menu
+void describeMenu(MenuView & m){
+  m.open = bMenu;
+  m.icon = -1;
+  m.size = 2;
+  m.text[0] = 0;
+  m.kb = false;
+  if(!bMenu) return;
+  JsonObject cur = level["opts"][level["ind"].as<int>()].as<JsonObject>(); //get the selected option
+  if(cur.containsKey("icon")){ //if the option has an icon, show it.
+    m.icon = cur["icon"].as<int>();
+  } else if(level.containsKey("type")){ //handle "type" options
+    if(level["name"] == "mac") strlcpy(m.text, macAddress, sizeof(m.text)), m.size = 1; //display the mac address
+    else if(level["name"] == "ssid"){
+      wifiScan.refresh(15000); //keep the list fresh while someone's looking at it
+      strlcpy(m.text, wifiScan.count ? wifiScan.name(ssidInd) : "Scanning...", sizeof(m.text)); //display the SSID at the ssidInd index
+    } else if(level["name"] == "skin") skinName(skinInd, m.text);
+    if(level["type"] == "kb"){ //if we're in a kb input, show the input string and the next char
+      m.kb = true;
+      strlcpy(m.kbText, kbString.c_str(), sizeof(m.kbText));
+      m.kbNext = kbInd;
+    } else if(level["type"] == "toggle"){
+      strlcpy(m.text, toggleChoices[toggleInd], sizeof(m.text)); //display the toggle string (on or off)
     }
-    
-    if(menuTimeout < millis()) bMenu = false, menuLevel = 0; //close the menu after timeout expires.
+  } else { //if there is no icon, and not type, just show the name.
+    const char * name = cur["name"].as<const char *>();
+    strlcpy(m.text, name ? name : "", sizeof(m.text));
+  }
+}
+
+void drawMenu(MenuView & m){
+  if(!m.open) return;
+  spr.fillRect(0, 240-36, 240, 36, TFT_BLACK); //draw the black rectangle at the bottom of the page
+  if(m.icon >= 0){
+    blitPacked(packedEmojis, m.icon, &spr, 120-16, 240-34, 2);
+    return;
+  }
+  if(m.text[0]) menuText(m.text, m.size);
+  if(m.kb){ //draw the input string and the next char (next char is in blue)
+    char next[2] = {m.kbNext, 0};
+    spr.setTextSize(2);
+    int twid = spr.textWidth(m.kbText)+tft.textWidth(next);
+    if(twid > 200) spr.setTextSize(1);
+    twid = spr.textWidth(m.kbText)+tft.textWidth(next);
+    spr.setCursor(120 - twid/2, 240-26);
+    spr.setTextColor(TFT_WHITE);
+    spr.print(m.kbText);
+    spr.setTextColor(TFT_BLUE);
+    spr.print(next);
   }
 }
 
@@ -577,55 +753,255 @@ void drawMenu(){
 //====================================================================================
 void loop()
 {
-  leftBut.idle(); //watch the left button
-  rightBut.idle(); //watch the right button
-  midBut.idle(); //watch the middle button
+  trace.idle();
+  if(trace.replaying) replayButtons(); //the recorded presses instead of the real ones
+  else {
+    leftBut.idle(); //watch the left button
+    rightBut.idle(); //watch the right button
+    midBut.idle(); //watch the middle button
+  }
+  wifiScan.idle(ssidInd); //pick up wifi scan results, keeping the menu on the same network
+  if(bMenu && menuTimeout < millis()) bMenu = false, menuLevel = 0; //close the menu after timeout expires.
+  game.update(renderMode(), millis()); //draw faster or slower, depending on what's going on
+#ifdef DUAL_CORE
+  uint32_t us;
+  while(frameReports.pop(us)) game.rendered(us); //how long the other core is taking over frames
+  SkinChange sc;
+  while(skinChanges.pop(sc)) skinChanged(sc);
+#endif
+  if(timeKeeper.idle()) setDaytime(); //keep the clock ticking, and check the sky whenever it's set
   dog.idle(); //run the dog control functions and draw stuff
   idleTimers(); //check the timers.
+  heapMon.idle(); //watch the heap for fragmentation
+  eventLog.drain(); //send whatever got logged, as far as the serial buffer has room
 
   //monitor the press timers, for long press functions. This should be integrated as part of the button class.
   if(watchBackPress && millis()-backPressTimer > 1000) watchBackPress = false, ignoreBackRelease = true, previousLevel();
   if(watchMenuPress && millis()-menuPressTimer > 1000){
     watchMenuPress = false;
     ignoreSelectRelease = true;
-    if(level["name"]=="password") cfgDoc["password"][curSSID] = kbString;
-    else if(level["name"]=="weather") cfgDoc["zipcode"] = kbString;
+    if(level["name"]=="password") cfgDoc["password"][curSSID] = kbString.buf; //char *, so the json copies it
+    else if(level["name"]=="weather") cfgDoc["zipcode"] = kbString.buf;
     writeConfig();
     previousLevel();
   }
 }
 
-void getDogFrame(){
-  dogSpr.pushImage(-32*(dog.counter), -32*dog.act, SMALLDOGS_WIDTH, SMALLDOGS_HEIGHT, smallDogs); //push the dog image into the sprite at the correct offset for the frame.
+//press and release the buttons as the trace being played back says to
+void replayButtons(){
+  uint8_t pin;
+  bool pressed;
+  Button * buttons[] = {&leftBut, &midBut, &rightBut};
+  while(trace.nextButton(pin, pressed)){
+    for(Button * b : buttons) if(b->pin == pin) b->fire(pressed);
+  }
+}
+
+//how often to draw, from what the dog's up to (see gameLoop.h)
+RenderMode renderMode(){
+  if(ballChase || dog.act == RUN || dog.motion.pathing) return RENDER_ACTIVE;
+  if(!bMenu && (dog.act == SLEEP || dog.bypass)) return RENDER_IDLE;
+  return RENDER_NORMAL;
+}
+
+//make an 8 bit sprite, and count it against the sprites' share of the heap
+void makeSprite(TFT_eSprite & s, int w, int h){
+  s.setColorDepth(8);
+  if(s.createSprite(w, h)) heapMon.note(HEAP_SPRITES, w*h);
+}
+
+//change skins from the game side; the dog frames belong to whoever draws, so on two cores, it's sent over
+void changeSkin(int i){
+#ifdef DUAL_CORE
+  if(renderTask){
+    renderCmds.push({CMD_SKIN, i});
+    return;
+  }
+#endif
+  skinChanged(setSkin(i));
+}
+
+//the game side of a skin change: count the dog frames against the heap, and log it if it didn't fit
+void skinChanged(const SkinChange & c){
+  if(c.held) heapMon.note(HEAP_SHEETS, c.held); //the new frames were allocated before the old ones were freed
+  if(c.freed) heapMon.note(HEAP_SHEETS, -c.freed);
+  if(!c.ok) LOGW(EV_SKIN_FAILED, c.skin);
+}
+
+//dog skins: the two built into the sketch, then any in the skin pack (see skinPack.h)
+int skinCount(){
+  return 2 + skinPack.count;
+}
+
+void skinName(int i, char * out){
+  if(i == 0) strcpy(out, "default");
+  else if(i == 1) strcpy(out, "alt");
+  else skinPack.name(i-2, out);
+}
+
+//put the dog in skin i. Pack skins are read in place from flash, so this only costs the unpacking.
+//if there wasn't room to unpack it, the dog stays in the skin it had. On two cores this runs on the drawing core, so it
+//leaves the heap monitor and the log alone, and hands back what happened for skinChanged() on the game core.
+//the default skin is smallDogsAlt.h, the dog the sketch has always drawn; "alt" is smallDogs.h.
+SkinChange setSkin(int i){
+  PackedSheet sheet;
+  if(i == 1) sheet = packedDogs;
+  else if(i < 2 || !skinPack.sheet(i-2, sheet, packedDogsAlt)) sheet = packedDogsAlt; //the built in one, or if the pack's changed under us
+  int32_t was = dogSheet.held;
+  bool ok = dogSheet.begin(sheet, firstFlipRow);
+  return {i, ok, ok ? was : 0, ok ? dogSheet.held : 0};
+}
+
+//the pixels of pet i's current frame, already facing the right way
+const uint8_t * getDogFrame(World & w, int i){
+  return dogSheet.frame(w.counter[i], w.act[i], w.mirror(i));
+}
+
+//start the frame with the background layer. If there's room for baseSpr, the background and static things are drawn
+//into it only when they change (see bakeBase), and this is one copy; otherwise the background is scaled up every frame.
+void drawBase(Scene & s){
+  if(!baseSpr.created()){
+    scale(&bgSpr,&spr,0,0,2); //scale the background into the frame buffer.
+    return;
+  }
+  bakeBase(s);
+  memcpy(spr.getPointer(), baseSpr.getPointer(), 240*240);
+}
+
+//redraw the parts of baseSpr that changed: all of it when the light changes, or just where static things came or went.
+void bakeBase(Scene & s){
+  World & w = s.world;
+  if(basePhase != lighting.phase){
+    basePhase = lighting.phase;
+    s.dirty.add(0, 0, 240, 240);
+  }
+  if(s.dirty.empty()) return;
+  Rect r = s.dirty;
+  r.x0 = max(r.x0, 0), r.y0 = max(r.y0, 0);
+  r.x1 = min(r.x1, 240), r.y1 = min(r.y1, 240);
+  s.dirty.clear();
+  if(r.empty()) return; //all off screen
+
+  blitClipped((const uint8_t *)bgSpr.getPointer(), 120, 120, &baseSpr, 0, 0, 2, r);
+  emojiFrame(POOP);
+  for(int i=0; i<w.count; i++){ //poops don't overlap (see PlayArea::mark), so order doesn't matter
+    if(w.kind[i] != ENT_POOP || !r.overlaps(w.x[i], w.y[i], 32, 32)) continue;
+    blitClipped((const uint8_t *)emojiSpr.getPointer(), 16, 16, &baseSpr, w.x[i], w.y[i], 2, r);
+  }
+}
+
+//draw one thing from the world into the frame buffer
+void drawEntity(World & w, int i){
+  if(w.isStatic(i) && baseSpr.created()) return; //already baked into the background
+  int size = entSize[w.kind[i]];
+  if(!playArea.visible(w.x[i], w.y[i], size, size)) return; //skip anything that's entirely off the round screen
+  switch(w.kind[i]){
+    case ENT_PET:
+      blit(getDogFrame(w, i),32,32,&spr,w.x[i]+w.mirror(i),w.y[i],4); //flipped frames sit one pixel right, as they always have
+      break;
+    case ENT_POOP:
+      blitPacked(packedEmojis, POOP, &spr, w.x[i], w.y[i], 2);
+      break;
+    case ENT_BALL:
+      blitPacked(packedEmojis, PLAY, &spr, w.x[i], w.y[i], 2);
+      break;
+    default: break;
+  }
+}
+
+//draw the speech bubble with the dog's emote in it. The bubble and emote are put together once per
+//emote, facing and light, and kept in bubbleTiles, so most frames this is just copying runs of pixels.
+void drawBubble(Scene & s){
+  int X = s.dogX+26+s.dogLeft; //flipped frames sit one pixel right, as they always have
+  uint32_t key = s.dogState | s.dogLeft<<4 | lighting.phase<<5;
+  Tile * t = bubbleTiles.find(key);
+  if(!t){
+    t = bubbleTiles.start(key);
+    emojiFrame(s.dogState); //get the dog emotions
+    bubbleTiles.layer(t, bubbleSheet.frame(0,0,s.dogLeft), 32, 32, 0, 0, 2);
+    bubbleTiles.layer(t, (const uint8_t *)emojiSpr.getPointer(), 16, 16, 18-s.dogLeft, 10, 2); //the emote goes at dog.x+44
+    if(!bubbleTiles.finish(t)){ //too busy to keep; draw it the long way
+      blit(bubbleSheet.frame(0,0,s.dogLeft),32,32,&spr,X,s.dogY-10,2);
+      scale(&emojiSpr,&spr,s.dogX+44,s.dogY,2);
+      return;
+    }
+  }
+  bubbleTiles.draw(t, &spr, X, s.dogY-10);
+}
+
+//darken h rows of the frame buffer, starting at row y, to half brightness (behind the clock and the splash text)
+void darken(int y, int h){
+  for(int i=0; i<h; i++){
+    for(int j=0; j<spr.width(); j++){
+      uint32_t col = spr.readPixel(j,i+y);
+      col = fastBlend(128, col, TFT_BLACK);
+      spr.drawPixel(j, i+y, col);
+    }
+  }
 }
 
+//unpack emoji num into emojiSpr, for when it's needed as a whole (the bubble cache, and baking poops)
 void emojiFrame(int num){
-  emojiSpr.pushImage(-16*num, 0, EMOJIS_WIDTH, EMOJIS_HEIGHT, emojis); //each icon is 16 pixels wide; -16*num offsets to the numth icon.
-}
-
-void scale(TFT_eSprite * src, TFT_eSprite * dest, int x, int y, int fac, bool mirror){
-  for(int i=0; i<src->height(); i++){ //for each row of the source sprite
-    for(int j=0; j<src->width(); j++){ //for each pixel in the row
-      uint32_t col = src->readPixel(j,i); //get the current color
-      bool shadow = false;
-      if(col == TFT_BLACK){ //if the pixel is true black, set the shadow flag
-        shadow = true;
-      } 
-      if(col != TFT_GREEN){ //if the pixel is not full green (meaning green pixels aren't drawn, so they're transparent, effectively)
-        if(!daytime) col = fastBlend(128, col, TFT_NAVY); //blend the pixel color from the source image with navy, if it's after sunset
-        for(int h=0; h<fac; h++){ //these for-loops scale each pixel up by a factor of fac
-          for(int w=0; w<fac; w++){ //this makes each pixel from src cover fac*fac pixels in dest.
-            int xaug = j*fac + w; //j is the x-coordinate of the src pixel
-            if(mirror) xaug = src->width()*fac-xaug; //if we are drawing the image mirrored, reverse the coordinate across the source width
-            if(shadow){ //if the shadow flag is set, blend the destination color with black
-              uint32_t bgcol = dest->readPixel(x+xaug,y+i*fac+h);
-              col = fastBlend(128, bgcol, TFT_BLACK);
-            }
-            dest->drawPixel(x+xaug, y+i*fac+h,col); //draw the scaled pixel.
-          }
-        }
+  Unpacker unpacker;
+  unpacker.frame(packedEmojis, num, (uint8_t *)emojiSpr.getPointer());
+}
+
+//8 bit (RGB332) colours with special meanings in sprites
+const uint8_t CLEAR8 = 0x1C; //TFT_GREEN; not drawn, so it's transparent
+const uint8_t SHADOW8 = 0x00; //TFT_BLACK; darkens whatever is behind it
+
+//draw an 8 bit sprite into dest at x, y, scaled up by fac.
+void scale(TFT_eSprite * src, TFT_eSprite * dest, int x, int y, int fac){
+  blit((const uint8_t *)src->getPointer(), src->width(), src->height(), dest, x, y, fac);
+}
+
+//draw sw by sh 8 bit pixels into dest at x, y, scaled up by fac, working straight on the sprite buffer.
+//every source colour goes through the lighting table (see lighting.h), so night mode costs nothing extra.
+//there's no mirroring in here; flipped images come pre-flipped from a Sheet.
+void blit(const uint8_t * sbuf, int sw, int sh, TFT_eSprite * dest, int x, int y, int fac){
+  Rect all;
+  all.add(0, 0, dest->width(), dest->height());
+  blitClipped(sbuf, sw, sh, dest, x, y, fac, all);
+}
+
+//blit, only touching the pixels of dest inside clip (which has to be inside dest).
+void blitClipped(const uint8_t * sbuf, int sw, int sh, TFT_eSprite * dest, int x, int y, int fac, Rect clip){
+  for(int i=0; i<sh; i++) blitRow(sbuf + i*sw, sw, dest, x, y + i*fac, fac, clip); //for each row of the source sprite
+}
+
+//draw frame n of a packed sheet, unpacking it a row at a time straight into the blitter.
+void blitPacked(const PackedSheet & sheet, int n, TFT_eSprite * dest, int x, int y, int fac){
+  static Unpacker unpacker; //static; the window is 256 bytes, so it's kept off the stack
+  uint8_t row[128]; //the one row we're drawing
+  if(sheet.fw > sizeof(row)) return; //too wide to stream; unpack it into a sprite instead
+  Rect all;
+  all.add(0, 0, dest->width(), dest->height());
+  unpacker.begin(sheet, n);
+  for(int i=0; i<sheet.fh; i++){
+    unpacker.read(row, sheet.fw);
+    blitRow(row, sheet.fw, dest, x, y + i*fac, fac, all);
+  }
+}
+
+//one row of sw source pixels, scaled up by fac, to dest at x, y.
+void blitRow(const uint8_t * row, int sw, TFT_eSprite * dest, int x, int y, int fac, Rect & clip){
+  uint8_t * dbuf = (uint8_t *)dest->getPointer();
+  int dw = dest->width();
+  const uint8_t * lut = lighting.lut;
+  const uint8_t * shade = lighting.shadow;
+
+  for(int h=0; h<fac; h++){ //each source row covers fac rows of dest
+    int dy = y + h;
+    if(dy < clip.y0 || dy >= clip.y1) continue; //off the top or bottom
+    uint8_t * drow = dbuf + dy*dw;
+    for(int j=0; j<sw; j++){ //for each pixel in the row
+      uint8_t col = row[j];
+      if(col == CLEAR8) continue; //green pixels aren't drawn, so they're transparent, effectively
+      for(int w=0; w<fac; w++){ //and each pixel covers fac pixels across
+        int dx = x + j*fac + w; //j is the x-coordinate of the src pixel
+        if(dx < clip.x0 || dx >= clip.x1) continue;
+        drow[dx] = (col == SHADOW8) ? shade[drow[dx]] : lut[col]; //shadows darken the destination, everything else is lit
       }
     }
   }
 }
-
@@ -0,0 +1,106 @@
+#ifndef ANIMATION_OBJ
+#define ANIMATION_OBJ
+
+////////////////////////////////////////////////////////////////////////
+// Data driven sprite animation.
+// Each clip is a list of frames (a column of the sprite sheet, and how long to show it),
+// plus whether it loops, plays once, or goes back and forth. The frame to show is worked out
+// from the time since the clip started, so it keeps its timing however often we draw.
+////////////////////////////////////////////////////////////////////////
+
+#include "arduino.h"
+
+enum AnimMode : uint8_t {
+  ANIM_LOOP, //0,1,2,3,0,1,2,3...
+  ANIM_ONCE, //0,1,2,3 and stay on 3; fires the clip's end event
+  ANIM_PINGPONG //0,1,2,3,2,1,0,1...
+};
+
+struct AnimFrame {
+  uint8_t col; //column in the sprite sheet
+  uint16_t ms; //how long it's shown
+};
+
+struct AnimClip {
+  uint8_t first, count; //where the clip's frames start in the frame table, and how many there are
+  AnimMode mode;
+  uint8_t endEvent; //event fired when a one shot clip finishes (0 for none)
+};
+
+//how many steps in one pass through a clip; ping pong goes there and back without repeating the ends.
+inline int clipSteps(const AnimClip & c){
+  return (c.mode == ANIM_PINGPONG && c.count > 1) ? 2*c.count - 2 : c.count;
+}
+
+//which entry of the clip step s lands on
+inline int clipIndex(const AnimClip & c, int s){
+  return (s < c.count) ? s : 2*c.count - 2 - s;
+}
+
+//length of one pass through a clip, in milliseconds
+inline uint32_t clipLength(const AnimClip & c, const AnimFrame * frames){
+  uint32_t len = 0;
+  for(int s=0; s<clipSteps(c); s++) len += frames[c.first + clipIndex(c, s)].ms;
+  return len;
+}
+
+//the sheet column to show, elapsed milliseconds into a clip
+inline uint8_t clipFrame(const AnimClip & c, const AnimFrame * frames, uint32_t elapsed){
+  uint32_t len = clipLength(c, frames);
+  if(!len) return frames[c.first].col;
+  if(c.mode == ANIM_ONCE){
+    if(elapsed >= len) return frames[c.first + c.count - 1].col; //finished, hold the last frame
+  } else elapsed %= len;
+
+  for(int s=0; s<clipSteps(c); s++){
+    const AnimFrame & f = frames[c.first + clipIndex(c, s)];
+    if(elapsed < f.ms) return f.col;
+    elapsed -= f.ms;
+  }
+  return frames[c.first + c.count - 1].col;
+}
+
+//plays clips from a table, one at a time.
+class Animator {
+  public:
+  const AnimClip * clips;
+  const AnimFrame * frames;
+  uint8_t clip; //current clip
+  unsigned long start; //when it started
+  bool ended; //a one shot clip has finished and fired its event
+
+  Animator(const AnimClip * c, const AnimFrame * f){
+    clips = c;
+    frames = f;
+    clip = 0;
+    start = 0;
+    ended = false;
+  }
+
+  void play(uint8_t which, unsigned long now){
+    clip = which;
+    start = now;
+    ended = false;
+  }
+
+  //the column to show right now
+  uint8_t frame(unsigned long now){
+    return clipFrame(clips[clip], frames, now - start);
+  }
+
+  //how long the current clip's first frame is shown; handy as a redraw interval
+  uint16_t frameTime(){
+    return frames[clips[clip].first].ms;
+  }
+
+  //check if a one shot clip just finished; returns its end event once, 0 otherwise.
+  uint8_t update(unsigned long now){
+    const AnimClip & c = clips[clip];
+    if(c.mode != ANIM_ONCE || ended) return 0;
+    if(now - start < clipLength(c, frames)) return 0;
+    ended = true;
+    return c.endEvent;
+  }
+};
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef ARENA_OBJ
+#define ARENA_OBJ
+
+////////////////////////////////////////////////////////////////////////
+// Scratch memory for things that only live for one frame or one web request.
+// Allocating is just moving a pointer along a fixed buffer, and everything is freed at once with reset(),
+// so short lived allocations never go on the heap and leave holes between the long lived ones.
+// Don't keep anything from it past the end of the frame or request that made it.
+////////////////////////////////////////////////////////////////////////
+
+#include "arduino.h"
+
+class Arena {
+  public:
+  uint8_t * buf;
+  size_t size;
+  size_t used = 0;
+  size_t last = 0; //where the newest allocation starts, so it can grow in place
+  size_t high = 0; //most ever in use at once
+  uint32_t allocs = 0, fails = 0; //since boot
+
+  Arena(uint8_t * b, size_t n){
+    buf = b, size = n;
+  }
+
+  //n bytes, 4 byte aligned; NULL if it doesn't fit
+  void * alloc(size_t n){
+    n = (n + 3) & ~3;
+    if(used + n > size){
+      fails++;
+      return NULL;
+    }
+    last = used;
+    used += n;
+    allocs++;
+    if(used > high) high = used;
+    return buf + last;
+  }
+
+  //resize p to n bytes in place; only the newest allocation can change size, NULL for anything else
+  void * grow(void * p, size_t n){
+    n = (n + 3) & ~3;
+    if(p != buf + last || last + n > size) return NULL;
+    used = last + n;
+    if(used > high) high = used;
+    return p;
+  }
+
+  //free everything
+  void reset(){
+    used = last = 0;
+  }
+};
+
+uint8_t scratchBuf[3072];
+Arena scratch(scratchBuf, sizeof(scratchBuf)); //reset at the end of every frame and every web request
+
+#endif
@@ -0,0 +1,95 @@
+#ifndef BEHAVIOUR_OBJ
+#define BEHAVIOUR_OBJ
+
+////////////////////////////////////////////////////////////////////////
+// Table driven behaviour for the dog.
+// Every rule says "when doing <from>, switch to <move>" with a base weight, plus how much
+// hunger, happiness and tiredness push that weight up or down. When the shuffle timer runs out,
+// one rule for the current state is picked at random, weighted by the dog's mood.
+// The rules are a flat const array, so picking one is a short scan with no allocation.
+////////////////////////////////////////////////////////////////////////
+
+#include "arduino.h"
+
+//what the dog is doing, from the behaviour engine's point of view
+enum BehaviourState : uint8_t {
+  B_WALK,
+  B_RUN,
+  B_SIT,
+  B_SLEEP,
+  B_OTHER //in between things (starting to sit, walking to a spot); nothing gets picked
+};
+
+//what the dog can decide to do next
+enum BehaviourMove : uint8_t {
+  MOVE_STAY, //keep doing the same thing
+  MOVE_WALK,
+  MOVE_RUN,
+  MOVE_SIT, //sit down right where it is
+  MOVE_GOSIT, //walk to the middle of the screen, then sit
+  MOVE_SLEEP,
+  MOVE_NAP //walk to the middle of the screen, sit a while, then sleep
+};
+
+struct BehaviourRule {
+  BehaviourState from;
+  BehaviourMove move;
+  uint8_t weight; //base weight
+  int8_t hungerW, happyW, tiredW; //added to the weight for every 64 points of hunger, happiness, and tiredness
+  uint8_t dur; //minimum time before the next shuffle, in seconds; the actual time is between dur and 2*dur
+};
+
+//the rules. With a calm, fed dog every state has roughly the same odds it always had (1 in 3 each),
+//tired dogs drift towards sitting and sleeping, and happy dogs get the zoomies more often.
+const BehaviourRule dogRules[] = {
+//  from     move        weight hunger happy tired dur
+  { B_WALK,  MOVE_STAY,   8,    0,     0,   -1,    5 },
+  { B_WALK,  MOVE_RUN,    6,   -2,     1,   -3,    5 },
+  { B_WALK,  MOVE_GOSIT,  8,    1,     0,    3,   30 },
+  { B_WALK,  MOVE_NAP,    0,    0,     0,    4,   60 }, //only once the dog's getting tired
+  { B_SIT,   MOVE_STAY,   8,    0,     0,    0,    5 },
+  { B_SIT,   MOVE_SLEEP,  8,    0,    -1,    4,   60 },
+  { B_SIT,   MOVE_WALK,   6,    1,     1,   -3,    5 },
+  { B_SLEEP, MOVE_STAY,   8,    0,     0,    4,    5 },
+  { B_SLEEP, MOVE_SIT,    8,    2,     0,   -2,    5 },
+  { B_SLEEP, MOVE_RUN,    6,   -2,     1,   -4,    5 },
+  { B_RUN,   MOVE_GOSIT,  8,    0,     0,    0,    5 }
+};
+
+const int numDogRules = sizeof(dogRules)/sizeof(dogRules[0]);
+
+class Behaviour {
+  public:
+  const BehaviourRule* rules;
+  int numRules;
+
+  Behaviour(const BehaviourRule* r, int n){
+    rules = r;
+    numRules = n;
+  }
+
+  //weight of a rule for the given mood; never negative, so a rule can be switched off by mood, but never inverted
+  int weigh(const BehaviourRule & r, uint8_t hunger, uint8_t happiness, uint8_t tiredness){
+    int w = r.weight + (r.hungerW*hunger + r.happyW*happiness + r.tiredW*tiredness)/64;
+    return w > 0 ? w : 0;
+  }
+
+  //pick the next rule for state <from>. Returns the index of the rule, or -1 if there's nothing to pick (or everything weighs 0).
+  int pick(BehaviourState from, uint8_t hunger, uint8_t happiness, uint8_t tiredness){
+    int total = 0;
+    for(int i=0; i<numRules; i++){
+      if(rules[i].from == from) total += weigh(rules[i], hunger, happiness, tiredness);
+    }
+    if(total <= 0) return -1;
+
+    int r = random(total); //one random number per pick, so a seeded random() gives the same choices every time
+    for(int i=0; i<numRules; i++){
+      if(rules[i].from != from) continue;
+      r -= weigh(rules[i], hunger, happiness, tiredness);
+      if(r < 0) return i;
+    }
+    return -1;
+  }
+};
+
+#endif
@@ -0,0 +1,94 @@
+#ifndef BENCH_OBJ
+#define BENCH_OBJ
+
+////////////////////////////////////////////////////////////////////////
+// Tiny timing harness for the hot paths.
+// BENCH(name, iterations, code...) runs code that many times, timing each run with micros(),
+// and prints one line of JSON per kernel. Build with RUN_BENCHMARKS defined to run the kernels
+// in benchmarks.ino at boot; tools/bench.py compares the output against a saved baseline.
+// ALLOCS(name, iterations, code...) does the same for heap use: it counts calls to new, and the heap
+// blocks left allocated afterwards, and prints an ALLOC line. Paths that should never touch the heap
+// (a frame, a button press) are checked with it, and bench.py fails if any of them do.
+// checkReport() prints a CHECK line for an on-device test: how many cases it tried, and how many failed.
+////////////////////////////////////////////////////////////////////////
+
+#include "arduino.h"
+#include "esp_heap_caps.h"
+
+//#define RUN_BENCHMARKS //uncomment to time the kernels at boot
+
+struct BenchResult {
+  const char * name;
+  uint32_t iters;
+  uint32_t total, best, worst; //microseconds
+};
+
+//print a result as a line of JSON, prefixed with BENCH so it's easy to pick out of the rest of the serial output.
+void benchReport(const BenchResult & r){
+  char line[160];
+  snprintf(line, sizeof(line), "BENCH {\"name\":\"%s\",\"iters\":%lu,\"us\":%.2f,\"min_us\":%lu,\"max_us\":%lu}",
+    r.name, (unsigned long)r.iters, r.iters ? (float)r.total / r.iters : 0.f, (unsigned long)r.best, (unsigned long)r.worst);
+  Serial.println(line);
+}
+
+//time a block of code; everything it needs has to be in scope where the macro is used.
+#define BENCH(NAME, ITERS, ...) do { \
+  BenchResult _r = {NAME, ITERS, 0, 0xffffffff, 0}; \
+  for(uint32_t _i=0; _i<(ITERS); _i++){ \
+    uint32_t _t = micros(); \
+    __VA_ARGS__; \
+    _t = micros() - _t; \
+    _r.total += _t; \
+    if(_t < _r.best) _r.best = _t; \
+    if(_t > _r.worst) _r.worst = _t; \
+  } \
+  benchReport(_r); \
+} while(0)
+
+#ifdef RUN_BENCHMARKS
+volatile uint32_t benchNews = 0; //calls to new since boot
+
+//count every new; malloc itself can't be hooked without rebuilding the core, so a String's
+//malloc and free inside the code only shows up if it's still holding the memory at the end.
+void * operator new(size_t n){
+  benchNews++;
+  return malloc(n);
+}
+
+void * operator new[](size_t n){
+  benchNews++;
+  return malloc(n);
+}
+#endif
+
+//heap blocks in use right now
+uint32_t heapBlocks(){
+  multi_heap_info_t info;
+  heap_caps_get_info(&info, MALLOC_CAP_DEFAULT);
+  return info.allocated_blocks;
+}
+
+void allocReport(const char * name, uint32_t iters, uint32_t news, int32_t blocks){
+  char line[120];
+  snprintf(line, sizeof(line), "ALLOC {\"name\":\"%s\",\"iters\":%lu,\"news\":%lu,\"blocks\":%ld}",
+    name, (unsigned long)iters, (unsigned long)news, (long)blocks);
+  Serial.println(line);
+}
+
+//print the result of an on-device check; bench.py fails if any case did
+void checkReport(const char * name, uint32_t cases, uint32_t failed){
+  char line[120];
+  snprintf(line, sizeof(line), "CHECK {\"name\":\"%s\",\"cases\":%lu,\"failed\":%lu}", name, (unsigned long)cases, (unsigned long)failed);
+  Serial.println(line);
+}
+
+//run a block of code and count its allocations; the code runs once first, so anything it sets up for good isn't counted.
+#define ALLOCS(NAME, ITERS, ...) do { \
+  __VA_ARGS__; \
+  uint32_t _news = benchNews; \
+  uint32_t _blocks = heapBlocks(); \
+  for(uint32_t _i=0; _i<(ITERS); _i++){ __VA_ARGS__; } \
+  allocReport(NAME, ITERS, benchNews - _news, (int32_t)(heapBlocks() - _blocks)); \
+} while(0)
+
+#endif
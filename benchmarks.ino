@@ -0,0 +1,216 @@
+#ifdef RUN_BENCHMARKS
+////////////////////////////////////////////////////////////////////////
+// Kernel timings (see bench.h). Runs once at the end of setup() when RUN_BENCHMARKS is defined,
+// and prints one BENCH line per kernel. Save the serial output, record a baseline once with
+//   tools/bench.py update output.txt baseline.json
+// and after a change, "tools/bench.py check output.txt baseline.json" fails on any slowdown.
+////////////////////////////////////////////////////////////////////////
+
+//a weather response as it comes back from openweathermap, for timing the parser
+const char weatherSample[] = "{\"coord\":{\"lon\":-93.1616,\"lat\":44.4583},\"weather\":[{\"id\":800,\"main\":\"Clear\","
+  "\"description\":\"clear sky\",\"icon\":\"01d\"}],\"base\":\"stations\",\"main\":{\"temp\":41.52,\"feels_like\":36.1,"
+  "\"temp_min\":39.2,\"temp_max\":43.81,\"pressure\":1021,\"humidity\":62},\"visibility\":10000,\"wind\":{\"speed\":8.05,"
+  "\"deg\":300},\"clouds\":{\"all\":0},\"dt\":1703027354,\"sys\":{\"type\":2,\"id\":2005472,\"country\":\"US\","
+  "\"sunrise\":1703001923,\"sunset\":1703033409},\"timezone\":-21600,\"id\":0,\"name\":\"Northfield\",\"cod\":200}";
+
+void benchNothing(){}
+
+//run the dog's ticks over ms of game time, as fast as they'll go; returns the game time its script took (or ms if it didn't finish)
+unsigned long simulateDog(unsigned long ms){
+  unsigned long start = game.simTime;
+  for(unsigned long t = 0; t < ms; t += simTick){
+    game.simTime = start + t; //anything the dog starts from outside a tick goes by this clock too
+    dog.tick(game.simTime);
+    if(!dog.script.running()) return t;
+  }
+  return ms;
+}
+
+//nothing the play area hands out is ever off the round panel (see playArea.h): the walking area itself, and every
+//poop spot and ball landing from everywhere the dog can stand, facing either way, and poops until the yard is full
+void checkPlayArea(){
+  uint32_t cases = 0, failed = 0;
+  for(int cy=0; cy<gridSize; cy++){
+    for(int cx=0; cx<gridSize; cx++){
+      if(!(walkMask[cy] >> cx & 1)) continue;
+      cases++;
+      if(!(panelMask[cy] >> cx & 1)) failed++;
+    }
+  }
+  checkReport("walk_mask_on_panel", cases, failed);
+
+  int wasX = dog.x, wasY = dog.y;
+  bool wasLeft = dog.left;
+  PlayArea wasArea = playArea;
+  playArea.clear();
+  uint32_t poops = 0, poopsOff = 0, balls = 0, ballsOff = 0;
+  int PX, PY;
+  for(int Y = petYmin; Y <= petYmax; Y += 2){
+    for(int X = petXmin; X <= petXmax; X += 2){
+      if(!playArea.walkable(X, Y)) continue;
+      dog.x = X, dog.y = Y;
+      for(int l=0; l<2; l++){
+        dog.left = l;
+        poops++;
+        if(!dog.poopSpot(PX, PY) || !playArea.onPanel(PX, PY, 32, 32)) poopsOff++;
+        balls++;
+        ballLanding(PX, PY);
+        if(!playArea.onPanel(PX, PY, 32, 32)) ballsOff++;
+      }
+    }
+  }
+  dog.x = 56, dog.y = 60;
+  while(dog.poopSpot(PX, PY)){ //every spot it picks is free, so this fills the yard and stops
+    poops++;
+    if(!playArea.isFree(PX, PY, 32, 32)){
+      poopsOff++;
+      break;
+    }
+    playArea.mark(PX, PY, 32, 32);
+  }
+  checkReport("poop_spot_on_panel", poops, poopsOff);
+  checkReport("ball_landing_on_panel", balls, ballsOff);
+  playArea = wasArea;
+  dog.x = wasX, dog.y = wasY, dog.left = wasLeft;
+}
+
+void runBenchmarks(){
+  Serial.println("BENCH start");
+  int wasPhase = lighting.phase;
+
+  //sources for the scale kernels: the real dog frame, a flat colour (no shadow pixels) and all black (all shadow)
+  TFT_eSprite flatSpr = TFT_eSprite(&tft);
+  TFT_eSprite shadowSpr = TFT_eSprite(&tft);
+  flatSpr.setColorDepth(8);
+  shadowSpr.setColorDepth(8);
+  flatSpr.createSprite(32,32);
+  shadowSpr.createSprite(32,32);
+  flatSpr.fillSprite(TFT_WHITE);
+  shadowSpr.fillSprite(TFT_BLACK);
+  const uint8_t * dogFrame = dogSheet.frame(0, SIT_RIGHT, false);
+  const uint8_t * dogFlipped = dogSheet.frame(0, SIT_RIGHT, true);
+  Scene & scene = scenes.reading(); //the kernels that draw from a scene use a fresh one (the drawing task isn't running yet)
+  buildScene(scene);
+
+  BENCH("scale_x2", 50, scale(&flatSpr,&spr,100,100,2));
+  BENCH("scale_x2_shadow", 50, scale(&shadowSpr,&spr,100,100,2));
+  BENCH("scale_x4", 20, scale(&flatSpr,&spr,56,60,4));
+  BENCH("scale_x4_shadow", 20, scale(&shadowSpr,&spr,56,60,4));
+  BENCH("scale_x4_dog", 20, blit(dogFrame,32,32,&spr,56,60,4));
+  BENCH("scale_x4_dog_mirror", 20, blit(dogFlipped,32,32,&spr,57,60,4));
+  BENCH("bubble_mirror", 50, blit(bubbleSheet.frame(0,0,true),32,32,&spr,83,50,2));
+  BENCH("bubble_uncached", 50, bubbleTiles.clear(), drawBubble(scene));
+  BENCH("bubble_cached", 50, drawBubble(scene));
+  lighting.setPhase(LIGHT_NIGHT);
+  BENCH("scale_x2_night", 50, scale(&flatSpr,&spr,100,100,2));
+  BENCH("scale_x4_night", 20, scale(&flatSpr,&spr,56,60,4));
+  BENCH("scale_x4_dog_night", 20, blit(dogFrame,32,32,&spr,56,60,4));
+  lighting.setPhase(wasPhase);
+  BENCH("scale_bg", 5, scale(&bgSpr,&spr,0,0,2));
+
+  volatile uint32_t sink = 0; //keeps the compiler from throwing the blend away
+  BENCH("fastBlend_row", 100, for(int j=0; j<240; j++) sink += fastBlend(128, spr.readPixel(j,120), TFT_NAVY));
+
+  BENCH("lighting_rebuild", 20, lighting.phase = -1, lighting.setPhase(LIGHT_DUSK + 64));
+  lighting.setPhase(wasPhase);
+
+  BENCH("getDogFrame", 100, getDogFrame(scene.world, dog.ent));
+  BENCH("emojiFrame", 100, emojiFrame(POOP));
+  static uint8_t unpacked[32*32];
+  Unpacker unpacker;
+  BENCH("unpack_dog_frame", 100, unpacker.frame(packedDogsAlt, 5, unpacked));
+  BENCH("blitPacked_emoji_x2", 100, blitPacked(packedEmojis, PLAY, &spr, 100, 100, 2));
+  BENCH("blit_emoji_x2", 100, scale(&emojiSpr, &spr, 100, 100, 2));
+  BENCH("ball_throw", 100, ballPath.throwArc(-32, 60, 240, 60, 40, 1000, millis()));
+  int bx, by;
+  BENCH("ball_sample", 1000, ballPath.sample(millis() - 300, bx, by));
+  BENCH("darken_clock", 20, darken(0, 55));
+
+  //ten timeouts that won't fire during the run
+  int ids[10];
+  for(int i=0; i<10; i++) ids[i] = setTimeout(benchNothing, 3600000);
+  BENCH("idleTimers_10", 1000, idleTimers());
+  BENCH("timeKeeper_idle", 1000, timeKeeper.idle());
+  for(int i=0; i<10; i++) clearTimeout(ids[i]);
+
+  //one loop's worth of dog logic, without drawing
+  timeOutFunc * draw = dog.drawCB;
+  dog.drawCB = NULL;
+  BENCH("dog_idle", 1000, dog.idle());
+  BENCH("dog_tick", 1000, dog.tick(game.simTime += simTick)); //one fixed simulation tick (see gameLoop.h)
+
+  //a whole nap script, in game time: walk to the middle, sit, wait 30 seconds, sleep. It shouldn't touch the heap,
+  //and should take 30 seconds and the walk (a few seconds) to get to sleep
+  unsigned long napTime = 0;
+  ALLOCS("dog_nap", 3, dog.free(), dog.nap(), napTime = simulateDog(60000));
+  char line[64];
+  snprintf(line, sizeof(line), "SCRIPT nap: %lu ms, %s", napTime, dog.act == SLEEP ? "asleep" : "not asleep");
+  Serial.println(line);
+  dog.free();
+  dog.drawCB = draw;
+
+  //the world's per tick update with 1, 8 and 32 pets (the dog's one of them; 32 fills the world), and a whole frame
+  //with 8, which should still keep up with the frame rate
+  static World wasWorld; //static; it's too big to want on the stack
+  wasWorld = world;
+  for(int i=0; i<world.count; i++) if(world.kind[i] == ENT_PET && !world.driven[i]) world.remove(i); //just the dog
+  const int petCounts[] = {1, 8, 32};
+  const char * petBenches[] = {"world_update_1", "world_update_8", "world_update_32"};
+  unsigned long worldTime = game.simTime;
+  for(int k=0; k<3; k++){
+    while(world.countOf(ENT_PET) < petCounts[k] && world.spawnPet(petXmin + random(petXmax-petXmin), petYmin) >= 0);
+    BENCH(petBenches[k], 200, world.update(worldTime += simTick));
+    if(petCounts[k] == 8) BENCH("frame_8_pets", 20, (*dog.drawCB)());
+  }
+  world = wasWorld;
+
+  //logging: a record into a ring of its own against the line it replaced going straight out, and whole loops
+  //(min_us and max_us show the jitter); the ring is emptied after every record so nothing's dropped
+  static EventLog benchLog;
+  Serial.flush();
+  eventLog.flush();
+  BENCH("log_add", 1000, benchLog.add(LOG_INFO, EV_SHUFFLE, 1, 2, 3); benchLog.clear());
+  BENCH("serial_println", 20, Serial.println("-------Shuffling--------"));
+  Serial.flush();
+  BENCH("loop", 200, loop());
+
+  //whole frames, from the background to the screen, with no poops and with a full yard
+  world.clear(ENT_POOP);
+  BENCH("frame_0_poops", 20, (*dog.drawCB)());
+  for(int i=0; i<maxPoops; i++) world.spawn(ENT_POOP, 24 + i*40, 172);
+  BENCH("frame_5_poops", 20, (*dog.drawCB)());
+  world.clear(ENT_POOP);
+  BENCH("bake_all", 5, basePhase = -1, bakeBase(scene));
+
+  //nothing on a frame or a button press should touch the heap
+  ALLOCS("frame", 20, (*dog.drawCB)());
+  for(int i=0; i<maxPoops; i++) world.spawn(ENT_POOP, 24 + i*40, 172);
+  ALLOCS("frame_5_poops", 20, (*dog.drawCB)());
+  world.clear(ENT_POOP);
+  tempString = "72"; //so the clock draws the temperature too
+  ALLOCS("frame_clock", 20, (*dog.drawCB)());
+  bool wasClock = cfgDoc["clock"];
+  cfgDoc["clock"] = false;
+  ALLOCS("frame_no_clock", 20, (*dog.drawCB)());
+  cfgDoc["clock"] = wasClock;
+  //open the menu, step along it and close it again
+  ALLOCS("buttons_menu", 20, (*midBut.pressCB)(1), (*midBut.pressCB)(0), (*rightBut.pressCB)(1), (*rightBut.pressCB)(0),
+    (*leftBut.pressCB)(1), (*leftBut.pressCB)(0));
+  ALLOCS("frame_menu", 20, bMenu = true, menuLevel = 1, level = menuDoc.as<JsonObject>(), (*dog.drawCB)());
+  bMenu = false, menuLevel = 0;
+
+  DynamicJsonDocument doc(2000);
+  BENCH("json_menu", 50, deserializeJson(doc, (const char *)menuJson)); //const, so the source isn't parsed in place
+  BENCH("json_config", 50, deserializeJson(doc, (const char *)cfgJson));
+  BENCH("json_weather", 50, deserializeJson(doc, weatherSample));
+  //the same, parsed into the scratch arena the way web requests are now, which shouldn't touch the heap
+  BENCH("json_weather_scratch", 50, { ScratchJsonDocument d(2000); deserializeJson(d, weatherSample); } scratch.reset());
+  ALLOCS("json_weather_scratch", 20, { ScratchJsonDocument d(2000); deserializeJson(d, weatherSample); } scratch.reset());
+
+  checkPlayArea();
+
+  flatSpr.deleteSprite();
+  shadowSpr.deleteSprite();
+  Serial.println("BENCH done");
+}
+#endif
@@ -7,6 +7,8 @@
 ////////////////////////////////////////////////////
 
 #include "arduino.h"
+#include "heapMonitor.h"
+#include "trace.h"
 
 //stuff to make lambda functions storable.
 namespace DigitalButton {
@@ -69,7 +71,8 @@ public:
 
   template<typename C> 
   void setCallback( const C & cb){
-    pressCB = new DigitalButton::fxn<C>(cb);
+    pressCB = new DigitalButton::fxn<C>(cb); //once per button, for good
+    heapMon.note(HEAP_CALLBACKS, sizeof(DigitalButton::fxn<C>));
   }
 
   void setCallback( void (* cb)(int)){
@@ -84,11 +87,16 @@ public:
 
     if(debounceTimer < millis() && lastFired != state){ //if the debounceTimer is less than the current time, and the state isn't the same as the last time the callback fired,
       lastFired  = state; // set teh lastFired state to the current state
-      //and fire the callbacks, with state inverted, so state is whether or not the button is pressed.
-      if(pressCB) (*pressCB)(!state);
-      else if(callback) callback(!state);
+      fire(!state); //and fire the callbacks, with state inverted, so state is whether or not the button is pressed.
     }
   }
+
+  //call the callbacks for a press (1) or release (0); idle() does this, and so does a trace being played back
+  void fire(int pressed){
+    trace.button(pin, pressed);
+    if(pressCB) (*pressCB)(pressed);
+    else if(callback) callback(pressed);
+  }
 };
 
 #endif
\ No newline at end of file
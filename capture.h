@@ -0,0 +1,36 @@
+#ifndef FRAME_CAPTURE_OBJ
+#define FRAME_CAPTURE_OBJ
+
+////////////////////////////////////////////////////////////////////////
+// Frame capture, to check that rendering changes don't change the picture.
+// Every frame goes to the screen through pushFrame(). If the sketch is built with FRAME_CAPTURE
+// defined, each frame is also written to the serial port as a raw packet:
+//   "FRM1", label length (1 byte), label, width and height (2 bytes each, little endian),
+//   then width*height bytes of 8 bit (RGB332) pixels, straight out of the sprite.
+// tools/frames.py turns a capture into images and compares them against a folder of known good ones.
+////////////////////////////////////////////////////////////////////////
+
+#include "arduino.h"
+#include <TFT_eSPI.h>
+
+//#define FRAME_CAPTURE //uncomment to capture frames over serial
+
+const char * captureLabel = "live"; //name written with each captured frame; the scenario runner sets this
+
+//push a finished frame buffer to the screen (and capture it, if turned on)
+void pushFrame(TFT_eSprite & frame){
+  frame.pushSprite(0,0);
+#ifdef FRAME_CAPTURE
+  uint16_t w = frame.width(), h = frame.height();
+  uint8_t len = strlen(captureLabel);
+  uint8_t head[4] = {(uint8_t)w, (uint8_t)(w >> 8), (uint8_t)h, (uint8_t)(h >> 8)};
+  Serial.write((const uint8_t *)"FRM1", 4);
+  Serial.write(&len, 1);
+  Serial.write((const uint8_t *)captureLabel, len);
+  Serial.write(head, 4);
+  Serial.write((const uint8_t *)frame.getPointer(), (size_t)w*h); //the sprite is 8 bit, so this is one byte per pixel
+  Serial.flush();
+#endif
+}
+
+#endif
@@ -6,6 +6,13 @@
 ////////////////////////////////////////////////////////////////////////
 
 #include "timeout.h"
+#include "world.h"
+#include "behaviour.h"
+#include "motion.h"
+#include "eventLog.h"
+#include "heapMonitor.h"
+#include "gameLoop.h"
+#include "script.h"
 
 //enums for the dog actions
 enum Action {
@@ -32,23 +39,16 @@ enum Emote {
   GRUMPY
 };
 
-//class to store the locations of the poops.
-class Poop {
-  public:
-  int x,y;
-  Poop(){
-    x=0;
-    y=0;
-  }
-  void move(int X, int Y){
-    x=X;
-    y=Y;
-  }
+//the dog's scripts (see script.h), for Script::id
+enum DogScript : uint8_t {
+  SCRIPT_NONE,
+  SCRIPT_GOSIT, //walk to the middle and sit
+  SCRIPT_SAD, //walk to the middle and sulk
+  SCRIPT_NAP //walk to the middle, sit a while, then sleep
 };
 
-//vars for storing info about poop locations.
+//vars for storing info about poops; the poops themselves live in the world as ENT_POOP entities.
 const int maxPoops = 5;;
-Poop poops[maxPoops];
 int curPoops = 0;
 
 
@@ -58,20 +58,23 @@ class Dog{
   //declare all the things as public, because who cares.
   public:
   int x,y,dx,dy, xdest, ydest;  //variables to store current location, current velocity, and destination coordinates
-  int xmin, ymin, xmax, ymax; // directional boundries
   int counter;  //frame counter variable, to store which sprite is shown
-  int maxCounts; //max steps per animation
+  Animator anim = Animator(dogClips, dogFrames); //works out counter from the time since the action started (see smallDogsAnim.h)
   Action act; // holds the current action of the dog
   Emote state; // holds the current emotion
-  bool once, bypass, bShuffling; //a variety of bool declarations
-  timeOutFunc* sitCB; //callback for what to do once the dog sits.
-  timeOutFunc* gotoCB; //callback storage for what to do once the dog gets to it's destination
+  bool bypass, bShuffling; //a variety of bool declarations
+  Script script; //what the dog is in the middle of doing, if anything takes more than one step
   timeOutFunc* drawCB; //callback for rendering
-  int stepTime = 250; //default time in milliseconds between animation steps
-  unsigned long lastStep = 0; // stores the time the last step was taken
+  timeOutFunc* tickCB; //callback for game logic outside the dog (like the ball), once a tick, at game.simTime
+  int stepTime = 250; //default time in milliseconds between walk, mood and poop checks; follows the frame time of the current animation
+  unsigned long lastStep = 0; // stores the time of the last checks
+  int prevX = 0, prevY = 0; //where the dog was at the tick before last, for drawing in between ticks
   unsigned long hngrTmr, playTmr, trdTmr, poopTmr, noteTmr,changeTmr, shuffleTmr; //a bunch of time storage variables
-  bool speak, freeMove, goX, goY, left,gotoFlag, poopFlag, busy; // more bool flags
+  bool speak, freeMove, left,gotoFlag, poopFlag, busy; // more bool flags
   Emote note = HEART; // stores the emotions stored in the speech bubble
+  int ent; //index of the dog in the world entity store
+  Behaviour brain = Behaviour(dogRules, numDogRules); //picks what to do next when shuffling
+  Motion motion; //fixed point position and velocity; x and y are copied out of this every move
 
   //stores the emotional states of the dog
   char hunger,happiness,tiredness;
@@ -82,70 +85,50 @@ class Dog{
     dx=15;
     dy=0;
     counter = 0;
-    maxCounts = 4;
-    once = bypass = false;
+    bypass = false;
     act = WALK_RIGHT; //walk right by default
+    anim.play(act, 0);
     state=HAPPY; // happy by default
     hunger = 0;
     happiness = 255;
     tiredness = 0;
     hngrTmr=playTmr=trdTmr=poopTmr=0;
-    drawCB = NULL;
-    xmin=-128;
-    ymin = 60;
-    xmax = 240;
-    ymax = 100;
+    drawCB = tickCB = NULL;
     xdest = ydest = 0;
     freeMove = true;
-    goX = goY = false;
     left = gotoFlag = poopFlag = busy = false;
     bShuffling = false;
+    motion.set(x, y);
+    motion.setVelocity(dx, dy);
+    ent = world.spawn(ENT_PET, x, y); //claim a slot in the world,
+    world.driven[ent] = true; // and tell the world we'll move it ourselves.
   }
 
-  //functions to store lambda functions as callbacks.
-  template<typename C>
-  void setSitCB(const C & CB){
-    sitCB = new function<C>(CB);
-  }
-
+  //function to store a lambda function as the draw callback.
   template<typename C>
-  void setGotoCB(const C & CB){
-    gotoCB = new function<C>(CB);
+  void setDrawCB(const C & CB){
+    drawCB = new function<C>(CB); //once, for good
+    heapMon.note(HEAP_CALLBACKS, sizeof(function<C>));
   }
 
+  //same, for the tick callback
   template<typename C>
-  void setDrawCB(const C & CB){
-    drawCB = new function<C>(CB);
+  void setTickCB(const C & CB){
+    tickCB = new function<C>(CB); //once, for good
+    heapMon.note(HEAP_CALLBACKS, sizeof(function<C>));
   }
 
-  // check the step timer to see if we're ready to take the next step.
-  bool stepReady(){
-    return millis()>lastStep + stepTime;
+  // check the step timer to see if it's time for the walk, mood and poop checks.
+  bool stepReady(unsigned long now){
+    return now>lastStep + stepTime;
   }
 
-  //function to actually move the dog
-  void step(){
+  //function to pick the animation frame for the current time, and handle the end of one shot animations.
+  //runs every tick, so frames change when the clip says, not whenever the step timer comes round.
+  void step(unsigned long now){
     if(!bypass){ //if we are allowing the dog to be moved (ie, haven't set the bypass flag)
-      lastStep = millis(); //record the current time as the time the last step was taken
-      x+=dx; //increment x and y by dx and dy respectively.
-      y+=dy;
-      xmin = (act==8) ? -150 : -64; //set the minimum and maximum x values, depending on the current action (the dog has more area to run than walk)
-      xmax = (act==8) ? 300 : 240-64;
-      y = constrain(y,ymin, ymax); // constrain the x and y values to their respective mins and maxs
-      x = constrain(x,xmin+(y-ymin), xmax-(y-ymin));
-      if(++counter>=maxCounts){ // if the incremented frame counter exceeds the maximum number of frames for the current animation
-        counter = 0; //reset the frame counter
-        if(once){ //if we only are doing the action once (which only happens when sitting)
-          once = false; //reset the flag
-          (*sitCB)(); // and call the sit callback
-        }
-      }
-      //if we are going to a destination 
-      if(goY && ((act==WALK_UP && ydest - y >=0) || (act==WALK_DWN && ydest - y <=0))){ //first check the y axis to see if we're at the destination
-        goY = false, yComplete(); //if we are, mark that we're done moving in x, and call the yComplete function.
-      } else if(goX && ((act==WALK_LEFT && xdest - x >=0) || (act==WALK_RIGHT && xdest - x <=0)) && gotoFlag){ //otherwise, check if x is complete
-        goX = false, gotoFlag = false, (*gotoCB)(); //if it is, mark it as complete, mark the goto cycle as complete, and call the gotoCB
-      } 
+      counter = anim.frame(now);
+      if(anim.update(now) == EVT_SAT) action(SIT_RIGHT, now); //once the dog has sat down, stay sitting
     } else { //if we aren't allowing the dog to be moved (ie, it's sad), 
       counter = 3; //set the frame pointer to the sad dog frame (it's the fourth frame (zero-indexed) of the SIT_RIGHT animation)
       act = SIT_RIGHT;
@@ -153,139 +136,221 @@ class Dog{
     
   }
 
-  //function to change the dog behavior
-  void action(Action which, bool override = false){
+  //function to actually move the dog. This runs every tick, and moves by the time since the last one.
+  void move(unsigned long now){
+    if(bypass){ //sad dogs don't move
+      motion.last = now;
+      return;
+    }
+    bool arrived = motion.update(now);
+    int nx = motion.px(), ny = motion.py();
+
+    //paths stay inside the walking area by themselves; a running dog wraps round the screen, and anything else
+    //stops at the edge of the walking area (see playArea.h). A dog that isn't in the area yet (walking on at boot,
+    //or back after a run) can move freely until it is.
+    if(!motion.pathing && act == RUN){ // if the dog is running off one side, wrap it around to the other side
+      if(!left && nx > runXmax-(ny-petYmin)) nx = runXmin+(ny-petYmin), motion.set(nx, ny);
+      else if(left && nx < runXmin+(ny-petYmin)) nx = runXmax-(ny-petYmin), motion.set(nx, ny);
+      x = nx, y = ny;
+    } else if(!motion.pathing && !playArea.walkable(nx, ny) && playArea.walkable(x, y)) motion.set(x, y); //stay where we were
+    else x = nx, y = ny;
+
+    if(arrived) gotoFlag = false; //we got to where goTo sent us; the script waiting on it carries on from here
+  }
+
+  //function to change the dog behavior. now is the simulation time (see gameLoop.h), which the animation starts from
+  void action(Action which, unsigned long now, bool override = false){
+    if(which != act || which == STARTSIT) anim.play(which, now); //start the new animation from its first frame (unless we're already doing it)
     act = which; // assign the new behavior
-    stepTime = 150; //and set a default frame time
+    stepTime = anim.frameTime(); //and step as often as the animation changes frames
     switch(which){ //set the velocity (dx and dy) and a variety of other flags based on new action
       case WALK_DWN: dx=0, dy=10; break; 
       case WALK_RIGHT: dx=10, dy=0, left = false; break; //left flag controls whether or not animation is flipped.
       case WALK_UP: dx=0, dy=-10; break;
       case WALK_LEFT: dx=-10, dy=0, left=true; break; //left flag controls whether or not animation is flipped.
       case SIT_FOR: dx=0, dy=0; break;
-      case STARTSIT: dx=0, dy=0, once = true; break; //once flag set, so this action only happens once.
-      case SIT_RIGHT: dx=0, dy=0, maxCounts=2, stepTime = 500; break; //make the steps take longer, and only set max counts to 2, 
-      case SLEEP: dx=0, dy=0, maxCounts=2, stepTime = 1000; break; // since there are only two frames for sitting and sleeping.
+      case STARTSIT: dx=0, dy=0; break; //plays once, then the EVT_SAT event sits us down for good
+      case SIT_RIGHT: dx=0, dy=0; break; //sitting and sleeping have slower frames;
+      case SLEEP: dx=0, dy=0; break; // the frame times are in smallDogsAnim.h
       case RUN: { //if the dog is now running,
         if(left) dx=-30; //set the x velocity to negative or positive, base on
         else dx = 30;
         //dx = pow(-1,(int)left)*-30; //not used, for readability
-        dy=0, maxCounts=3, state=HEART; break; //dogs love to run
+        dy=0, state=HEART; break; //dogs love to run
       }
     }
-    if(act<=5) maxCounts = 4; // if act is any of the walk modes, set num steps to 4
-    if(override) bShuffling = false, busy = true; //if we're forcing a specific mode, stop the shuffle, and set busy to true.
+    motion.pathing = false; //a new action stops any path we were on (goTo starts its path after this)
+    gotoFlag = false;
+    motion.setVelocity(dx, dy);
+    if(override) bShuffling = false, busy = true, script.stop(); //if we're forcing a specific mode, stop the shuffle and any script, and set busy to true.
   }
 
   //function to make the dog sit
-  void sit(){
-    setSitCB([this](){ //set the callback to set the dog action to sitting after startsit finishes. 
-      this->action(SIT_RIGHT);
-    });
-    action(STARTSIT); //make the dog start to sit.
+  void sit(unsigned long now){
+    action(STARTSIT, now); //make the dog start to sit; step() switches to SIT_RIGHT when the animation ends.
+  }
+
+  //copy the position and animation state into the world, so it gets sorted and drawn with everything else.
+  //a is how far we are from the last tick to the next, out of 256 (see gameLoop.h)
+  void sync(int a = 256){
+    if(abs(x - prevX) < 64 && abs(y - prevY) < 64){ //in between the last two ticks; not across a jump (ie a scenario putting the dog somewhere)
+      world.x[ent] = prevX + (x - prevX) * a / 256;
+      world.y[ent] = prevY + (y - prevY) * a / 256;
+    } else world.x[ent] = x, world.y[ent] = y;
+    world.act[ent] = act;
+    world.counter[ent] = counter;
+    world.left[ent] = left;
   }
 
   bool shouldMirror(){
-    return left && (act >= 5); //if the dog was/is moving left, and we're no longer in any of the walk modes, return true
+    return left && (act >= firstFlipRow); //if the dog was/is moving left, and we're no longer in any of the walk modes, return true
   }
 
-  //function for randomizing the walk directions
-  void changeWalk(){
-    int nw = 0; //init a variable for a new walk direction
-    changeTmr = millis()+1000+random(5000); //set a timer for a random time between 1 and 6 seconds from now, to change directions again.
-    do { //generate a new random number at least once
-      nw = random(4);
-    } while (nw == act); //keep generating if the current walk state is equal to the newly generated state.
-    action((Action)nw); //make the new walk state happen
+  //function for randomizing the walk directions. Only directions that keep the dog in its area are picked,
+  //so this always finishes after checking the four of them.
+  void changeWalk(unsigned long now){
+    changeTmr = now+1000+random(5000); //set a timer for a random time between 1 and 6 seconds from now, to change directions again.
+    int fits[4]; //walk directions that would keep the dog inside its area
+    int n = 0;
+    for(int w=0; w<4; w++){
+      if(w != act && world.petFits(x+walkDx[w], y+walkDy[w])) fits[n++] = w;
+    }
+    if(n) action((Action)fits[random(n)], now); //make the new walk state happen
+    else if(!playArea.walkable(x, y)) action(x < (petXmin+petXmax)/2 ? WALK_RIGHT : WALK_LEFT, now); //off the area (ie after a run); head back on
   }
 
   //function to make the dog sad.
   void sad(){
-    goTo(120-64,60,[this](){ //when saddened, the dog will go to the middle of the screen
-      Serial.println("Got saddened");
-      this->freeMove = false; //stop moving freely
-      this->act = SIT_RIGHT; //sit facing forward,
-      this->bypass = true; // and stop updating the animations
-      this->counter = 3;
-      notify(10000000); //it will tell you why it's sad for 1000 seconds.
-    });
-    
+    script.start(SCRIPT_SAD);
   }
 
-  void notify(unsigned long noteTime){
-    noteTmr = millis()+noteTime; //set the notification timer for noteTime milliseconds from now
+  void sadScript(unsigned long now){
+    SCRIPT_BEGIN(script);
+    goTo(120-64, 60, now); //when saddened, the dog will go to the middle of the screen
+    SCRIPT_WAIT(script, arrived());
+    LOGI(EV_SAD);
+    freeMove = false; //stop moving freely
+    act = SIT_RIGHT; //sit facing forward,
+    bypass = true; // and stop updating the animations
+    counter = 3;
+    notify(10000000, now); //it will tell you why it's sad for 1000 seconds.
+    SCRIPT_END(script);
   }
 
-  // function to randomly shuffle through all of the available dog actions.
-  void shuffle(){
-    int nxt = random(3); //generate a pseudorandom number. On zero, the same action continues.
-    int dur = 5000; //and establish a default duration for the new action
-    
-    //print out some useful info, like whether or not we're running out of ram
-    Serial.println("-------Shuffling--------");
-    Serial.println(ESP.getFreeHeap());
-    Serial.println(act);
-    Serial.println(nxt);
-
-    if(act < 4){ //if the dog is walking
-      if(nxt == 1) action(RUN); //1 in 3 chance of starting to run
-      else if(nxt == 2){ //1 in 3 chance of sitting
-        busy = true; //if we decide to sit, mark us as busy until we move to the center of the screen
-        dur = 30000; //and set the sit duration to at least 30 seconds
-        goTo(120-64, 60, [this](){ // tell the dog to go to the center of the screen
-          this->sit(); //once there, sit down
-          this->busy = false; //clear the busy flag
-          Serial.println("Sat");
-        });
-      } 
-    } else if(act == SIT_RIGHT){ //if we were sitting
-      if(nxt == 1) action(SLEEP), dur=60000; //1 in 3 chance of going to sleep for at least 1 minute
-      else if(nxt == 2) action(WALK_RIGHT); //1 in 3 chance of starting to walk
-    } else if(act == SLEEP){ //if we were sleeping
-      if(nxt == 1) action(SIT_RIGHT); //1 in 3 chance of sitting up
-      else if(nxt == 2) action(RUN); //1 in 3 chance of starting to do zoomies
-    } else if(act == RUN){ //if we were running, always go to the center of the screen and sit down.
-      busy = true, goTo(120-64, 60, [this](){
-        this->sit();
-        this->busy = false;
-        Serial.println("Sat");
-      });
+  void notify(unsigned long noteTime, unsigned long now){
+    noteTmr = now+noteTime; //set the notification timer for noteTime milliseconds from now
+  }
+
+  //what the behaviour engine thinks we're doing right now
+  BehaviourState behaviourState(){
+    if(act < 4) return B_WALK;
+    if(act == RUN) return B_RUN;
+    if(act == SIT_RIGHT) return B_SIT;
+    if(act == SLEEP) return B_SLEEP;
+    return B_OTHER;
+  }
+
+  //walk to the middle of the screen and sit down there.
+  void goSit(){
+    script.start(SCRIPT_GOSIT);
+  }
+
+  void goSitScript(unsigned long now){
+    SCRIPT_BEGIN(script);
+    busy = true; //mark us as busy until we get to the center of the screen
+    goTo(120-64, 60, now, EASE_OUT); // tell the dog to go to the center of the screen, slowing down as it gets there
+    SCRIPT_WAIT(script, arrived());
+    sit(now); //once there, sit down
+    busy = false; //clear the busy flag
+    LOGD(EV_SAT);
+    SCRIPT_END(script);
+  }
+
+  //walk to the middle of the screen, sit and think about it for 30 seconds, then go to sleep.
+  void nap(){
+    script.start(SCRIPT_NAP);
+  }
+
+  void napScript(unsigned long now){
+    SCRIPT_BEGIN(script);
+    busy = true;
+    goTo(120-64, 60, now, EASE_OUT);
+    SCRIPT_WAIT(script, arrived());
+    busy = false;
+    sit(now);
+    SCRIPT_WAIT(script, act != STARTSIT); //all the way down
+    SCRIPT_SLEEP(script, now, 30000);
+    action(SLEEP, now);
+    LOGD(EV_NAP);
+    SCRIPT_END(script);
+  }
+
+  //carry on with whatever script is running; once a tick
+  void runScript(unsigned long now){
+    switch(script.id){
+      case SCRIPT_GOSIT: goSitScript(now); break;
+      case SCRIPT_SAD: sadScript(now); break;
+      case SCRIPT_NAP: napScript(now); break;
+      default: script.stop(); break;
     }
-    int totDur = random(dur) + dur;
-    shuffleTmr = millis() + totDur; //shuffle the actions again in dur to dur*2 milliseconds
+  }
+
+  // function to pick the next dog action, using the behaviour rules and the dog's mood.
+  void shuffle(unsigned long now){
+    int dur = 5; //default duration for the next action, in seconds
+    int rule = brain.pick(behaviourState(), hunger, happiness, tiredness);
+
+    //log some useful info, like whether or not we're running out of ram
+    LOGI(EV_SHUFFLE, act, rule, ESP.getFreeHeap());
+
+    if(rule >= 0){
+      const BehaviourRule & r = brain.rules[rule];
+      dur = r.dur;
+      switch(r.move){
+        case MOVE_STAY: break;
+        case MOVE_WALK: action(WALK_RIGHT, now); break;
+        case MOVE_RUN: action(RUN, now); break;
+        case MOVE_SIT: action(SIT_RIGHT, now); break;
+        case MOVE_GOSIT: goSit(); break;
+        case MOVE_SLEEP: action(SLEEP, now); break;
+        case MOVE_NAP: nap(); break;
+      }
+    }
+    unsigned long totDur = random(dur*1000UL) + dur*1000UL;
+    shuffleTmr = now + totDur; //shuffle the actions again in dur to dur*2 seconds
   }
 
   //release the dog to do as it pleases (begin shuffling the actions)
   void free(){
+    unsigned long now = game.simTime; //from outside the tick (ie a button), so whenever the last tick was
     bypass = 0; //clear the bypass flag
     freeMove = true; //let it move around as it pleases
-    action(WALK_RIGHT); //as long as it walks to the right first.
+    action(WALK_RIGHT, now); //as long as it walks to the right first.
     state = HEART; // make it happy
     busy = false; //and not busy
-    notify(3000); //let it tell us it's happy for 3 seconds.
+    script.stop(); //and not in the middle of anything
+    notify(3000, now); //let it tell us it's happy for 3 seconds.
     bShuffling = true;
-    shuffleTmr = millis() + random(5000)+5000; //and start the shuffling in 5-10 seconds.
-  }
-
-  //function called once the y moves of the goto are complete
-  void yComplete(){
-    Serial.println("At y");
-    Action xAct = WALK_RIGHT;
-    if(this->xdest < this->x) xAct = WALK_LEFT; //say whether to walk right or left, depending on where the x destination is.
-    goX = true;
-    this->action(xAct); //start moving in that direction.
+    shuffleTmr = now + random(5000)+5000; //and start the shuffling in 5-10 seconds.
   }
 
-  //function for telling the dog where to go.
-  template<typename C>
-  void goTo(int xDest, int yDest, const C & CB){
+  //function for telling the dog where to go. It walks straight there, facing whichever way it's mostly going.
+  //scripts wait for arrived() to find out when it gets there.
+  void goTo(int xDest, int yDest, unsigned long now, uint8_t curve = EASE_LINEAR){
     xdest = xDest; //set the x and y destination values.
     ydest = yDest;
-    gotoFlag = true; 
-    Action yAct = (ydest > y) ? WALK_DWN : WALK_UP; //make the dog walk down if the destination is below the dog, otherwise walk up
-    setGotoCB(CB); //set the destination callback.
-    goY = true;
-    action(yAct);
+    int ddx = xdest - x, ddy = ydest - y;
+    Action dir;
+    if(abs(ddx) >= abs(ddy)) dir = (ddx < 0) ? WALK_LEFT : WALK_RIGHT;
+    else dir = (ddy > 0) ? WALK_DWN : WALK_UP;
+    action(dir, now);
+    gotoFlag = true;
+    motion.pathTo(xdest, ydest, 10, now, curve); //walking speed is 10 pixels a step
+  }
+
+  //true once the dog has got to where goTo sent it (or something else set it doing something new on the way)
+  bool arrived(){
+    return !gotoFlag;
   }
 
   //function to feed the dog.
@@ -294,51 +359,107 @@ class Dog{
     else state = HAPPY; //but if it is hungry, it gets happy.
     if(note == FOOD) note = HEART; //if the dog was talking about food, make it talk about being happy.
     hunger = 0; //reset the hunger timer.
-    notify(2000); //and tell us about it's emotional state for 2 seconds.
+    notify(2000, game.simTime); //and tell us about it's emotional state for 2 seconds.
+  }
+
+  //turn the dog around at the edges of its area, and every so often while it walks.
+  void walkAbout(unsigned long now){
+    if(act<4 && freeMove && !motion.pathing){ //if we're walking around and freely moving
+      //if the dog is about to reach the edge of its area, or the random walk direction timer has expired, change the walk direction.
+      if(!world.petFits(x+dx, y+dy) || changeTmr < now) changeWalk(now);
+    }
+  }
+
+  //update hunger, happiness and tiredness; these feed into what the behaviour rules pick.
+  void moodTick(unsigned long now){
+    //if the hungry timer has elapsed
+    if(now>hngrTmr && !busy){
+      hngrTmr = now + 180000; //set the timer to expire again in 3 minutes.
+      if(hunger < 255) hunger++; // if the dog is not maximally hungry, increment hunger.
+      if(hunger == 50) state = FOOD, note=FOOD; // if the dog is a little hungry, make it think about food
+      else if(hunger == 150) state = GRUMPY, note=FOOD; //if it's quite hungry, make it grumpy
+      else if(hunger == 240) state = MAD, note = FOOD, sad();//, //if it's very hungry, make the dog sad.
+    }
+
+    //every 30 seconds, running and walking make the dog tired, and sleep rests it.
+    if(now>trdTmr){
+      trdTmr = now + 30000;
+      int t = (uint8_t)tiredness;
+      if(act == RUN) t += 8;
+      else if(act < 4) t += 2;
+      else if(act == SLEEP) t -= 12;
+      tiredness = constrain(t, 0, 255);
+      if((uint8_t)happiness > 0 && (uint8_t)hunger > 100) happiness--; //a hungry dog slowly gets less happy
+    }
+  }
+
+  //the free spot for a poop nearest to just behind the dog, on the strip of ground the dog's feet walk on.
+  //every 8 pixel cell in the strip is tried, so this finds a spot wherever the dog is, as long as there's one at all.
+  bool poopSpot(int & PX, int & PY){
+    int wantX = x + (left ? 128+16 : -16), wantY = y + petAnchorY;
+    long best = -1;
+    for(int Y = petYmin+petAnchorY; Y <= petYmax+petAnchorY; Y += cellSize){
+      for(int X = 0; X <= 240-32; X += cellSize){
+        if(!playArea.isFree(X, Y, 32, 32)) continue; //on the screen, and not on another poop
+        long d = (long)(X-wantX)*(X-wantX) + (long)(Y-wantY)*(Y-wantY);
+        if(best < 0 || d < best) best = d, PX = X, PY = Y;
+      }
+    }
+    return best >= 0;
+  }
+
+  //drop a poop every few hours
+  void poopTick(unsigned long now){
+    if(now>poopTmr && act != SLEEP && !busy){ //if the poop timer has elapsed
+      LOGI(EV_POOP_TIMER, curPoops);
+      poopTmr = now+10800000; // set the poop timer to expire in three hours
+      int PX, PY;
+      if(curPoops<maxPoops){ //if we haven't exceeded the maximum number of poops,
+        if(poopSpot(PX, PY)){
+          world.spawn(ENT_POOP, PX, PY); //drop a poop there
+          playArea.mark(PX, PY, 32, 32); //and mark the spot as taken
+          curPoops++; //and increment the poop counter.
+        } else poopTmr = now+60000; //the yard's full up; try again in a minute.
+      } else busy = true, state = MAD, sad(), note=POOP; //if we have exceeded the max poops, make the dog sad.
+    }
   }
 
   /////////////////////////////////////////////////////////////
   //this is the function which is called in the main loop.
   /////////////////////////////////////////////////////////////
   void idle(){
-    if(stepReady()){ //if we're ready for the next step
-      step(); // take the step.
-
-      if(act<4 && freeMove){ //if we're walking around and freely moving
-        int yOffset = (y-ymin); // yOffset makes the dogs x range smaller the further down the screen it goes, to make it stay within the circular bounds of the screen.
-        while(x +dx + yOffset > xmax || x+dx - yOffset < xmin || y + dy > ymax || y + dy < ymin) changeWalk(); //if the dog has reached the edge of its area, change the walk direction.
-        if(changeTmr < millis()){ //or if the random walk direction timer has expired, make it change direction, even if not at an edge.
-          changeWalk();
-        }
-      }
-      if(act == RUN){ // if the dog is running
-        if(!left && x+dx>xmax-(y-ymin)) x=xmin; // to the right, and it will exceed it's bounded area on the next step, move it to the left edge of the screen
-        else if(left && x+dx<xmin+(y-ymin)) x=xmax; // to the left, and it will exceed it's bounded area on the next step, move it to the right edge of the screen
-      }
+    unsigned long now = millis();
+    uint32_t t = micros();
+    while(game.tickDue(now)) tick(game.simTime); //catch the simulation up to now, a fixed tick at a time
+    game.busy(micros() - t);
+
+    if(game.frameDue(now)){ //and draw, as often as the game loop says
+      t = micros();
+      sync(game.alpha(now)); //hand the position to the world, in between the last two ticks,
+      if(drawCB) (*drawCB)(); // and call the rendering callback
+      game.frameDone(now, micros() - t);
+    }
+  }
 
-      //if the hungry timer has elapsed
-      if(millis()>hngrTmr && !busy){
-        hngrTmr = millis() + 180000; //set the timer to expire again in 3 minutes.
-        if(hunger < 255) hunger++; // if the dog is not maximally hungry, increment hunger.
-        if(hunger == 50) state = FOOD, note=FOOD; // if the dog is a little hungry, make it think about food
-        else if(hunger == 150) state = GRUMPY, note=FOOD; //if it's quite hungry, make it grumpy
-        else if(hunger == 240) state = MAD, note = FOOD, sad();//, //if it's very hungry, make the dog sad.
-      }
+  //one simulation tick
+  void tick(unsigned long now){
+    prevX = x, prevY = y;
+    move(now);
 
-      if(millis()>poopTmr && act != SLEEP && !busy){ //if the poop timer has elapsed
-        Serial.println(curPoops);
-        poopTmr = millis()+10800000; // set the poop timer to expire in three hours
-        if(curPoops<maxPoops){ //if we haven't exceeded the maximum number of poops,
-          int leftOffset = left?128+16:-16;
-          poops[curPoops].move(x+leftOffset,y+112); //move a poop to a position behind the dog
-          curPoops++; //and increment the poop counter.
-        } else busy = true, state = MAD, sad(), note=POOP; //if we have exceeded the max poops, make the dog sad.
-      }
+    step(now); //the animation frame, every tick
 
-      if(drawCB) (*drawCB)(); // call the rendering callback
+    if(stepReady(now)){ //if it's time for the slower checks
+      lastStep = now;
+      walkAbout(now);
+      moodTick(now);
+      poopTick(now);
     }
-     
-    if(bShuffling && shuffleTmr < millis()) shuffle(); //if we're shuffling actions, and the timer has expired, shuffle the next action.
+    world.update(now); //the other pets tick along with us
+    if(tickCB) (*tickCB)(); // and so does anything else in the game
+
+    if(bShuffling && shuffleTmr < now && !script.running()) shuffle(now); //if we're shuffling actions, and the timer has expired, shuffle the next action.
+
+    if(script.running()) runScript(now); //last, so a script started this tick gets going straight away
   }
 };
 
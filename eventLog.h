@@ -0,0 +1,139 @@
+#ifndef EVENT_LOG_OBJ
+#define EVENT_LOG_OBJ
+
+////////////////////////////////////////////////////////////////////////
+// Logging that doesn't hold up the loop. Serial.println waits for the UART once its buffer is full,
+// which at 115200 baud is most of a millisecond per line. Instead, each log call puts a small binary
+// record (time, event, up to three numbers) in a ring buffer, and drain() writes them out from the loop,
+// only as many as the serial buffer has room for, so it never waits either.
+//
+// Records go out as a sync byte (0xA5, which plain text never contains) and the raw LogRecord, mixed in
+// with any ordinary prints. tools/logdecode.py turns them back into text, using the formats below.
+//
+// The level is picked at compile time: define LOG_LEVEL before this is included (LOG_DEBUG for everything,
+// LOG_OFF for nothing). Calls below the level compile to nothing.
+////////////////////////////////////////////////////////////////////////
+
+#include "arduino.h"
+
+#define LOG_DEBUG 0
+#define LOG_INFO 1
+#define LOG_WARN 2
+#define LOG_ERROR 3
+#define LOG_OFF 4
+
+//#define LOG_LEVEL LOG_DEBUG //uncomment to log everything
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_INFO
+#endif
+
+//every event, with the format logdecode.py prints it with; the args fill in the %d's in order.
+//only add to the end, so old captures still decode.
+#define LOG_EVENTS(X) \
+  X(EV_DROPPED, "dropped %d records, the buffer was full") \
+  X(EV_SHUFFLE, "shuffling: act %d, rule %d, %d bytes free") \
+  X(EV_SAD, "got saddened") \
+  X(EV_SAT, "sat") \
+  X(EV_POOP_TIMER, "poop timer, %d poops") \
+  X(EV_HTTP_CALL, "http call, type %d") \
+  X(EV_HTTP_ERROR, "http error %d") \
+  X(EV_JSON_ERROR, "deserializeJson() failed, code %d") \
+  X(EV_MENU_LEVEL, "menu level %d, option %d") \
+  X(EV_MENU_ACTION, "menu action, option %d") \
+  X(EV_SSID_PICK, "picked network %d of the scan, saved as %d") \
+  X(EV_SSID_STEP, "network %d of %d") \
+  X(EV_HEAP, "heap: %d bytes free, largest block %d, %d%% fragmented") \
+  X(EV_HEAP_MIN, "heap lows since boot: %d bytes free, largest block %d") \
+  X(EV_HEAP_LOW, "heap getting chopped up: largest block %d, of %d free") \
+  X(EV_HEAP_SPRITES, "  sprites: %d allocations, %d bytes, peak %d") \
+  X(EV_HEAP_SHEETS, "  sprite sheets: %d allocations, %d bytes, peak %d") \
+  X(EV_HEAP_JSON, "  json documents: %d allocations, %d bytes, peak %d") \
+  X(EV_HEAP_CALLBACKS, "  callbacks: %d allocations, %d bytes, peak %d") \
+  X(EV_SCRATCH, "  scratch arena: peak %d of %d bytes, %d allocations didn't fit") \
+  X(EV_RENDER_IDLE, "idle rendering: %d fps x10, %d%% cpu, over %d s") \
+  X(EV_RENDER_NORMAL, "normal rendering: %d fps x10, %d%% cpu, over %d s") \
+  X(EV_RENDER_ACTIVE, "active rendering: %d fps x10, %d%% cpu, over %d s") \
+  X(EV_NAP, "nap: asleep") \
+  X(EV_TRACE_START, "trace: mode %d (1 recording, 2 replaying), seed %d") \
+  X(EV_TRACE_SKIP, "trace: the session went differently at %d ms; skipped a reply") \
+  X(EV_TRACE_END, "trace: replay finished after %d ms") \
+  X(EV_TRACE_CUT, "trace: a %d byte reply didn't fit in %d bytes; the trace won't replay") \
+  X(EV_TRACE_REFUSED, "trace: record at %d ms is cut off or damaged; not replaying") \
+  X(EV_SKIN_FAILED, "no room to unpack skin %d; kept the old one")
+
+#define LOG_ENUM(name, fmt) name,
+enum LogEvent : uint8_t {
+  LOG_EVENTS(LOG_ENUM)
+};
+#undef LOG_ENUM
+
+const uint8_t logSync = 0xA5;
+
+struct LogRecord {
+  uint32_t ms; //millis() when it happened
+  uint8_t event;
+  uint8_t level;
+  uint16_t pad;
+  int32_t args[3];
+};
+
+const int logSize = 64; //records; a power of two
+
+class EventLog {
+  public:
+  LogRecord ring[logSize];
+  uint32_t head = 0, tail = 0; //written and sent; they only ever count up
+  uint32_t dropped = 0; //records lost to a full buffer since the last drain
+
+  void add(uint8_t level, LogEvent event, int32_t a = 0, int32_t b = 0, int32_t c = 0){
+    if(head - tail >= logSize){ //full; the old records are more useful than the new ones
+      dropped++;
+      return;
+    }
+    LogRecord & r = ring[head % logSize];
+    r.ms = millis();
+    r.event = event, r.level = level, r.pad = 0;
+    r.args[0] = a, r.args[1] = b, r.args[2] = c;
+    head++;
+  }
+
+  //send what fits in the serial buffer, and leave the rest for next time
+  void drain(){
+    if(dropped && head - tail < logSize){
+      uint32_t d = dropped;
+      dropped = 0;
+      add(LOG_WARN, EV_DROPPED, d);
+    }
+    while(tail != head && Serial.availableForWrite() > (int)sizeof(LogRecord)){
+      Serial.write(logSync);
+      Serial.write((const uint8_t *)&ring[tail % logSize], sizeof(LogRecord));
+      tail++;
+    }
+  }
+
+  //throw away everything that hasn't been sent
+  void clear(){
+    head = tail = dropped = 0;
+  }
+
+  //send everything, waiting if it has to; for before a restart or a long block
+  void flush(){
+    while(tail != head){
+      Serial.write(logSync);
+      Serial.write((const uint8_t *)&ring[tail % logSize], sizeof(LogRecord));
+      tail++;
+    }
+  }
+};
+
+EventLog eventLog;
+
+//the calls to use; the check is on constants, so anything below LOG_LEVEL is thrown away by the compiler
+#define LOG_AT(LEVEL, ...) do { if(LEVEL >= LOG_LEVEL) eventLog.add(LEVEL, __VA_ARGS__); } while(0)
+#define LOGD(...) LOG_AT(LOG_DEBUG, __VA_ARGS__)
+#define LOGI(...) LOG_AT(LOG_INFO, __VA_ARGS__)
+#define LOGW(...) LOG_AT(LOG_WARN, __VA_ARGS__)
+#define LOGE(...) LOG_AT(LOG_ERROR, __VA_ARGS__)
+
+#endif
@@ -0,0 +1,111 @@
+#ifndef FIXED_STRING_OBJ
+#define FIXED_STRING_OBJ
+
+////////////////////////////////////////////////////////////////////////
+// A string with its characters inside it, for the text that gets built every frame or every button press.
+// Arduino Strings go on the heap, and every += or String(number) can reallocate; these never do.
+// Anything past the capacity is cut off rather than overflowing; full() tells you if that happened.
+////////////////////////////////////////////////////////////////////////
+
+#include "arduino.h"
+#include <stdarg.h>
+
+template<int N>
+class FixedString {
+  public:
+  char buf[N+1]; //always zero terminated
+  int len = 0;
+  bool cut = false; //something didn't fit
+
+  FixedString(){
+    buf[0] = 0;
+  }
+
+  FixedString(const char * s){
+    set(s);
+  }
+
+  void clear(){
+    len = 0;
+    buf[0] = 0;
+    cut = false;
+  }
+
+  //replace the contents; NULL (ie a missing json key) just empties it
+  FixedString & set(const char * s){
+    clear();
+    return add(s);
+  }
+
+  FixedString & add(const char * s){
+    if(!s) return *this;
+    while(*s && len < N) buf[len++] = *s++;
+    if(*s) cut = true;
+    buf[len] = 0;
+    return *this;
+  }
+
+  FixedString & add(char c){
+    if(len < N) buf[len++] = c, buf[len] = 0;
+    else cut = true;
+    return *this;
+  }
+
+  FixedString & add(int i){
+    return addf("%d", i);
+  }
+
+  //printf onto the end
+  FixedString & addf(const char * fmt, ...){
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(buf + len, N+1 - len, fmt, args);
+    va_end(args);
+    if(n < 0) n = 0;
+    if(len + n > N) cut = true, n = N - len;
+    len += n;
+    return *this;
+  }
+
+  //printf over the contents
+  template<typename ... A>
+  FixedString & format(const char * fmt, A ... args){
+    clear();
+    return addf(fmt, args...);
+  }
+
+  //take the last character off
+  void pop(){
+    if(len) buf[--len] = 0;
+  }
+
+  FixedString & operator=(const char * s){
+    return set(s);
+  }
+
+  FixedString & operator+=(const char * s){
+    return add(s);
+  }
+
+  FixedString & operator+=(char c){
+    return add(c);
+  }
+
+  bool operator==(const char * s) const {
+    return s && !strcmp(buf, s);
+  }
+
+  const char * c_str() const {
+    return buf;
+  }
+
+  int length() const {
+    return len;
+  }
+
+  bool full() const {
+    return cut;
+  }
+};
+
+#endif
@@ -0,0 +1,104 @@
+#ifndef FIXMATH
+#define FIXMATH
+
+////////////////////////////////////////////////////////////////////////
+// Small fixed point math helpers, so the per-frame code doesn't need floats.
+// Numbers are Q16.16: the top 16 bits are the whole part, the bottom 16 the fraction.
+// A fraction of 0-1 (like how far along a path we are) is 0 to FIX_ONE.
+////////////////////////////////////////////////////////////////////////
+
+#include "arduino.h"
+
+typedef int32_t fix16;
+
+const fix16 FIX_ONE = 65536;
+const fix16 FIX_HALF = 32768;
+
+inline fix16 toFix(int v){
+  return (fix16)v * FIX_ONE;
+}
+
+//round to the nearest whole number
+inline int fromFix(fix16 v){
+  return (v + FIX_HALF) >> 16;
+}
+
+inline fix16 fixMul(fix16 a, fix16 b){
+  return (fix16)(((int64_t)a * b) >> 16);
+}
+
+inline fix16 fixDiv(fix16 a, fix16 b){
+  return (fix16)(((int64_t)a << 16) / b);
+}
+
+//fraction of the way from 0 to total, as 0-FIX_ONE; clamped, so it's safe to call after the end.
+inline fix16 fixFrac(unsigned long part, unsigned long total){
+  if(!total || part >= total) return FIX_ONE;
+  return (fix16)(((uint64_t)part << 16) / total);
+}
+
+//linear interpolation from a to b, with t from 0 to FIX_ONE
+inline fix16 fixLerp(fix16 a, fix16 b, fix16 t){
+  return a + fixMul(b - a, t);
+}
+
+//easing curves; these reshape a 0-FIX_ONE fraction so things speed up or slow down smoothly.
+enum Ease : uint8_t {
+  EASE_LINEAR,
+  EASE_IN, //starts slow
+  EASE_OUT, //ends slow
+  EASE_INOUT //starts and ends slow
+};
+
+inline fix16 ease(uint8_t curve, fix16 t){
+  switch(curve){
+    case EASE_IN: return fixMul(t, t);
+    case EASE_OUT: return FIX_ONE - fixMul(FIX_ONE - t, FIX_ONE - t);
+    case EASE_INOUT: return fixMul(fixMul(t, t), 3*FIX_ONE - 2*t); //smoothstep, 3t^2 - 2t^3
+    default: return t;
+  }
+}
+
+//angles are in turns, as a 16 bit number: 0 is 0 degrees, 16384 is 90, 32768 is 180, and it wraps around at 65536.
+const uint16_t TURN_QUARTER = 16384;
+const uint16_t TURN_HALF = 32768;
+
+//a quarter of a sine wave in 64 steps, in Q16.16; the other three quarters are reflections of it.
+const fix16 sinTable[65] = {
+  0, 1608, 3216, 4821, 6424, 8022, 9616, 11204, 12785, 14359, 15924, 17479, 19024, 20557, 22078, 23586,
+  25080, 26558, 28020, 29466, 30893, 32303, 33692, 35062, 36410, 37736, 39040, 40320, 41576, 42806, 44011, 45190,
+  46341, 47464, 48559, 49624, 50660, 51665, 52639, 53581, 54491, 55368, 56212, 57022, 57798, 58538, 59244, 59914,
+  60547, 61145, 61705, 62228, 62714, 63162, 63572, 63944, 64277, 64571, 64827, 65043, 65220, 65358, 65457, 65516,
+  65536
+};
+
+//sine of an angle in turns, -FIX_ONE to FIX_ONE, interpolated between table steps
+inline fix16 fixSin(uint16_t a){
+  bool neg = a >= TURN_HALF;
+  a &= TURN_HALF - 1; //fold the second half onto the first
+  if(a > TURN_QUARTER) a = TURN_HALF - a; //and the second quarter onto the first
+  int i = a >> 8; //64 steps per quarter, so 256 angle units per step
+  fix16 s = sinTable[i];
+  if(i < 64) s += ((sinTable[i+1] - s) * (int32_t)(a & 255)) >> 8;
+  return neg ? -s : s;
+}
+
+inline fix16 fixCos(uint16_t a){
+  return fixSin(a + TURN_QUARTER);
+}
+
+//integer square root, for path lengths. Only used when a path is planned, never per frame.
+inline uint32_t isqrt(uint32_t v){
+  uint32_t r = 0, bit = 1UL << 30;
+  while(bit > v) bit >>= 2;
+  while(bit){
+    if(v >= r + bit){
+      v -= r + bit;
+      r = (r >> 1) + bit;
+    } else r >>= 1;
+    bit >>= 2;
+  }
+  return r;
+}
+
+#endif
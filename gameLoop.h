@@ -0,0 +1,127 @@
+#ifndef GAME_LOOP_OBJ
+#define GAME_LOOP_OBJ
+
+////////////////////////////////////////////////////////////////////////
+// Timing for the simulation and the drawing, kept apart.
+// The simulation runs in fixed ticks of simTick milliseconds, however often the loop comes round,
+// so the dog moves and the timers run the same at any frame rate. Frames are drawn on their own
+// clock, with positions interpolated between the last two ticks so movement stays smooth.
+// How often we draw depends on what's going on: a sleeping dog doesn't need 15 frames a second, and
+// a running one or a thrown ball looks better with 30. If frames take too long to hit the rate, the
+// governor stretches the frame time so drawing never takes more than maxRenderShare of the CPU.
+////////////////////////////////////////////////////////////////////////
+
+#include "arduino.h"
+#include "eventLog.h"
+#include "trace.h"
+
+const unsigned long simTick = 20; //milliseconds per simulation tick (50 a second)
+const int maxCatchUp = 10; //ticks to run at once after a stall; past that, the simulation skips ahead
+
+//render rates, from least to most going on; in the same order as their EV_RENDER_ events
+enum RenderMode {
+  RENDER_IDLE, //asleep, or sad, with the menu closed
+  RENDER_NORMAL, //walking about, sitting, the menu
+  RENDER_ACTIVE, //running, chasing the ball, walking somewhere on purpose
+  RENDER_MODES
+};
+
+const uint16_t renderTimes[RENDER_MODES] = {500, 66, 33}; //milliseconds between frames: 2, 15 and 30 a second
+const int maxRenderShare = 80; //percent of the time drawing is allowed to take
+const unsigned long renderReportTime = 60000;
+
+struct RenderStats {
+  uint32_t ms; //time spent in this mode
+  uint32_t frames;
+  uint32_t busyUs; //time spent drawing and ticking in it
+};
+
+class GameLoop {
+  public:
+  unsigned long simTime = 0; //time of the latest tick
+  unsigned long lastFrame = 0;
+  unsigned long lastUpdate = 0, nextReport = renderReportTime;
+  RenderMode mode = RENDER_NORMAL;
+  uint32_t frameCost = 0; //average microseconds to draw a frame, as a running average
+  bool woken = false; //draw the next frame straight away
+  bool renderElsewhere = false; //frames are drawn on the other core; frameDone() is only handing them over
+  RenderStats stats[RENDER_MODES] = {};
+
+  //pick the render rate for what's going on; call every loop
+  void update(RenderMode m, unsigned long now){
+    stats[mode].ms += now - lastUpdate;
+    lastUpdate = now;
+    mode = m;
+    if((long)(now - nextReport) >= 0){
+      nextReport = now + renderReportTime;
+      report();
+    }
+  }
+
+  //start the simulation at now, ie once setup's done, so it doesn't begin by catching up on the whole boot
+  void start(unsigned long now){
+    simTime = lastFrame = lastUpdate = now;
+  }
+
+  //true when the simulation is a tick or more behind now; advances simTime by a tick
+  bool tickDue(unsigned long now){
+    if(now - simTime > simTick*maxCatchUp) simTime = now - simTick; //too far behind to catch up; skip to just one tick
+    if(now - simTime < simTick) return false;
+    simTime += simTick;
+    return true;
+  }
+
+  //how far now is between the last tick and the next, out of 256; for interpolating
+  int alpha(unsigned long now){
+    return min((unsigned long)256, (now - simTime) * 256 / simTick);
+  }
+
+  //milliseconds between frames right now: the mode's rate, or slower if frames are too slow to keep up with it
+  uint32_t frameTime(){
+    return max((uint32_t)renderTimes[mode], frameCost / (10 * maxRenderShare));
+  }
+
+  bool frameDue(unsigned long now){
+    return woken || now - lastFrame >= frameTime();
+  }
+
+  //draw the next frame as soon as possible, ie after a button press
+  void wake(){
+    woken = true;
+  }
+
+  void frameDone(unsigned long now, uint32_t us){
+    lastFrame = now;
+    woken = false;
+    stats[mode].frames++;
+    if(renderElsewhere) stats[mode].busyUs += us; //the handover; the drawing itself comes in through rendered()
+    else rendered(us);
+  }
+
+  //a frame took us microseconds to draw
+  void rendered(uint32_t us){
+    frameCost = frameCost ? (frameCost*7 + us) / 8 : us;
+    stats[mode].busyUs += us;
+    trace.frame(us);
+  }
+
+  //simulation time counts against the mode too
+  void busy(uint32_t us){
+    stats[mode].busyUs += us;
+    trace.tick(us);
+  }
+
+  //frames a second (times ten) and CPU share in each mode since the last report, through the event log
+  void report(){
+    for(int i=0; i<RENDER_MODES; i++){
+      RenderStats & s = stats[i];
+      if(!s.ms) continue;
+      LOGI((LogEvent)(EV_RENDER_IDLE + i), s.frames * 10000 / s.ms, s.busyUs / (s.ms * 10), s.ms / 1000);
+      s = RenderStats();
+    }
+  }
+};
+
+GameLoop game;
+
+#endif
@@ -0,0 +1,71 @@
+#ifndef HANDOFF_OBJ
+#define HANDOFF_OBJ
+
+////////////////////////////////////////////////////////////////////////
+// Passing things between two cores (or two threads) without locks.
+// SpscQueue is a ring of N items with one side pushing and the other popping; neither ever waits,
+// a full queue just refuses the push. TripleBuffer hands whole snapshots from a writer to a reader:
+// the writer always has a buffer to fill, the reader always has the newest finished one to read,
+// and the third is the one in between, swapped atomically. Neither side ever sees a half written one.
+// Only std::atomic, so the same code runs on the chip and on a PC under a thread sanitizer.
+////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <stdint.h>
+
+template<typename T, int N> //N a power of two
+class SpscQueue {
+  public:
+  T items[N];
+  std::atomic<uint32_t> head{0}, tail{0}; //pushed and popped; they only ever count up
+
+  //producer side; false if the queue is full
+  bool push(const T & v){
+    uint32_t h = head.load(std::memory_order_relaxed);
+    if(h - tail.load(std::memory_order_acquire) >= N) return false;
+    items[h % N] = v;
+    head.store(h + 1, std::memory_order_release);
+    return true;
+  }
+
+  //consumer side; false if there's nothing there
+  bool pop(T & v){
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    if(t == head.load(std::memory_order_acquire)) return false;
+    v = items[t % N];
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+  }
+};
+
+template<typename T>
+class TripleBuffer {
+  public:
+  T bufs[3];
+  std::atomic<uint8_t> middle{1}; //the buffer in between, plus freshBit if it's newer than what the reader has
+  uint8_t back = 0; //the writer's
+  uint8_t front = 2; //the reader's
+  static const uint8_t freshBit = 4;
+
+  //writer side: fill this in, then publish()
+  T & writing(){
+    return bufs[back];
+  }
+
+  void publish(){
+    back = middle.exchange(back | freshBit, std::memory_order_acq_rel) & 3;
+  }
+
+  //reader side: pick up the newest published buffer, if there's one we haven't had; then read reading()
+  bool update(){
+    if(!(middle.load(std::memory_order_relaxed) & freshBit)) return false;
+    front = middle.exchange(front, std::memory_order_acq_rel) & 3;
+    return true;
+  }
+
+  T & reading(){
+    return bufs[front];
+  }
+};
+
+#endif
@@ -0,0 +1,90 @@
+#ifndef HEAP_MONITOR_OBJ
+#define HEAP_MONITOR_OBJ
+
+////////////////////////////////////////////////////////////////////////
+// Keeps an eye on the heap, so we can see it getting chopped up long before an allocation fails.
+// Free memory on its own doesn't say much: what runs out first is the largest free block, once
+// long and short lived allocations have been mixed together for a while. This tracks both, with
+// their lowest points since boot, and how much each part of the sketch has asked for.
+// Everything goes out through the event log (see eventLog.h) every few minutes.
+////////////////////////////////////////////////////////////////////////
+
+#include "arduino.h"
+#include "esp_heap_caps.h"
+#include "eventLog.h"
+#include "arena.h"
+
+//the parts of the sketch that allocate, in the same order as their EV_HEAP_ events
+enum HeapUser {
+  HEAP_SPRITES,
+  HEAP_SHEETS,
+  HEAP_JSON,
+  HEAP_CALLBACKS,
+  HEAP_USERS
+};
+
+struct HeapTally {
+  int32_t allocs; //currently held
+  int32_t bytes;
+  int32_t peak; //most bytes ever held
+};
+
+const unsigned long heapSampleTime = 5000; //walking the heap isn't free, so only every few seconds
+const unsigned long heapReportTime = 600000;
+const uint32_t heapLowBlock = 16384; //warn when the largest block gets this small; a full screen sprite is 57600
+
+class HeapMonitor {
+  public:
+  HeapTally users[HEAP_USERS] = {};
+  uint32_t freeBytes = 0, largest = 0; //as of the last sample
+  uint32_t minFree = 0xffffffff, minLargest = 0xffffffff; //lowest since boot
+  unsigned long nextSample = 0, nextReport = 0;
+  bool warned = false;
+
+  //count an allocation (bytes > 0) or a free (bytes < 0) against one of the users
+  void note(HeapUser u, int32_t bytes){
+    HeapTally & t = users[u];
+    t.allocs += bytes > 0 ? 1 : -1;
+    t.bytes += bytes;
+    if(t.bytes > t.peak) t.peak = t.bytes;
+  }
+
+  void sample(){
+    freeBytes = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    largest = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+    minFree = heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT); //the heap keeps this one itself, so it catches the dips between samples
+    if(largest < minLargest) minLargest = largest;
+    if(largest < heapLowBlock && !warned){
+      warned = true;
+      LOGW(EV_HEAP_LOW, largest, freeBytes);
+    } else if(largest >= heapLowBlock) warned = false;
+  }
+
+  //how chopped up the free memory is: 0 is one big block, near 100 is all crumbs
+  int fragmentation(){
+    return freeBytes ? 100 - (int)((uint64_t)largest * 100 / freeBytes) : 0;
+  }
+
+  void report(){
+    sample();
+    LOGI(EV_HEAP, freeBytes, largest, fragmentation());
+    LOGI(EV_HEAP_MIN, minFree, minLargest);
+    for(int i=0; i<HEAP_USERS; i++) LOGI((LogEvent)(EV_HEAP_SPRITES + i), users[i].allocs, users[i].bytes, users[i].peak);
+    LOGI(EV_SCRATCH, scratch.high, scratch.size, scratch.fails);
+  }
+
+  //sample every few seconds, and report every ten minutes; call every loop
+  void idle(){
+    unsigned long now = millis();
+    if((long)(now - nextSample) < 0) return;
+    nextSample = now + heapSampleTime;
+    if((long)(now - nextReport) >= 0){
+      nextReport = now + heapReportTime;
+      report();
+    } else sample();
+  }
+};
+
+HeapMonitor heapMon;
+
+#endif
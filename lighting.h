@@ -0,0 +1,103 @@
+#ifndef LIGHTING_OBJ
+#define LIGHTING_OBJ
+
+////////////////////////////////////////////////////////////////////////
+// Colour lookup tables for day, dusk and night.
+// The sprites are 8 bit (RGB332), so tinting a pixel for the time of day only depends on its colour.
+// Instead of blending every pixel with navy as it's drawn, we work out a 256 entry table once,
+// whenever the light changes, and the blitter does one table lookup per pixel.
+// Through twilight (see solar.h), the table is rebuilt by blending between the day, dusk and night tables,
+// so the screen fades between them instead of switching all at once.
+////////////////////////////////////////////////////////////////////////
+
+#include "arduino.h"
+#include <TFT_eSPI.h>
+#include "solar.h"
+
+//points along the day/night cycle; anything in between is a mix of the two closest
+const int LIGHT_DAY = 0;
+const int LIGHT_DUSK = 256;
+const int LIGHT_NIGHT = 512;
+
+const uint16_t duskTint = 0xFB20; //orange
+
+//same conversions TFT_eSPI uses for 8 bit sprites (color8to16 and color16to8), so table colours match drawPixel exactly
+inline uint16_t expand332(uint8_t c){
+  const uint8_t blue[] = {0, 11, 21, 31};
+  return (c & 0xE0)<<8 | (c & 0xC0)<<5 | (c & 0x1C)<<6 | (c & 0x1C)<<3 | blue[c & 0x03];
+}
+
+inline uint8_t pack332(uint16_t c){
+  return ((c & 0xE000)>>8) | ((c & 0x0700)>>6) | ((c & 0x0018)>>3);
+}
+
+class Lighting {
+  public:
+  uint8_t lut[256]; //source colour -> colour to draw, for the current light
+  uint8_t shadow[256]; //background colour -> background darkened by half, for shadow pixels
+  int phase; //current point in the cycle, LIGHT_DAY to LIGHT_NIGHT
+  int target; //where the game wants the light; the drawing side catches phase up to it (see scene.h)
+
+  Lighting(){
+    phase = target = -1;
+  }
+
+  //build the shadow table, and start out in daylight
+  void begin(){
+    for(int c=0; c<256; c++) shadow[c] = pack332(fastBlend(128, expand332(c), TFT_BLACK));
+    setPhase(LIGHT_DAY);
+  }
+
+  //the colour c is drawn as at one of the three key points
+  uint16_t key(int which, uint16_t c){
+    if(which == LIGHT_DUSK) return fastBlend(192, c, duskTint);
+    if(which == LIGHT_NIGHT) return fastBlend(128, c, TFT_NAVY); //this is exactly the old night tint
+    return c;
+  }
+
+  //move the light to a point in the cycle straight away, from the game side: sets target, and builds the table for it
+  void setPhase(int p){
+    target = constrain(p, LIGHT_DAY, LIGHT_NIGHT);
+    applyPhase(target);
+  }
+
+  //rebuild the table for a point in the cycle. Only does anything when the light actually changes.
+  //this is the drawing side's half: it never touches target, which belongs to the game (under DUAL_CORE
+  //they're on different cores, and a stale scene mustn't undo a newer target).
+  void applyPhase(int p){
+    p = constrain(p, LIGHT_DAY, LIGHT_NIGHT);
+    if(p == phase) return;
+    phase = p;
+    int from = (p < LIGHT_DUSK) ? LIGHT_DAY : LIGHT_DUSK; //the key points either side of p
+    int f = p - from; //0-256 of the way to the next key point
+    for(int c=0; c<256; c++){
+      uint16_t col = expand332(c);
+      uint16_t a = key(from, col);
+      if(f == 0) lut[c] = pack332(a);
+      else if(f >= 256) lut[c] = pack332(key(from + 256, col));
+      else lut[c] = pack332(fastBlend(256 - f, a, key(from + 256, col)));
+    }
+  }
+
+  //where in the cycle we are at time now (unix seconds). It's dusk at sunrise and sunset, full night at the ends
+  //of civil twilight, and full day as long after sunrise (and before sunset) as twilight lasts.
+  int phaseAt(long now, SunTimes & sun){
+    if(sun.polar) return sun.polar > 0 ? LIGHT_DAY : LIGHT_NIGHT;
+    long morning = max(sun.rise - sun.dawn, 1L), evening = max(sun.dusk - sun.set, 1L);
+    if(now < sun.dawn || now >= sun.dusk) return LIGHT_NIGHT;
+    if(now < sun.rise) return LIGHT_NIGHT - (now - sun.dawn) * 256 / morning; //night -> dusk
+    if(now < sun.rise + morning) return LIGHT_DUSK - (now - sun.rise) * 256 / morning; //dusk -> day
+    if(now < sun.set - evening) return LIGHT_DAY;
+    if(now < sun.set) return LIGHT_DUSK - (sun.set - now) * 256 / evening; //day -> dusk
+    return LIGHT_DUSK + (now - sun.set) * 256 / evening; //dusk -> night
+  }
+
+  //update the table for the time now; steps of 16 keep us from rebuilding it every minute during twilight for no visible change
+  void update(long now, SunTimes & sun){
+    target = phaseAt(now, sun) & ~15; //the tables get rebuilt when the next frame is drawn
+  }
+};
+
+Lighting lighting;
+
+#endif
@@ -0,0 +1,80 @@
+#ifndef MOTION_OBJ
+#define MOTION_OBJ
+
+////////////////////////////////////////////////////////////////////////
+// Time based movement for things that walk around.
+// Positions are fixed point, and move by velocity * elapsed time, so the speed doesn't depend
+// on how often update() is called or how often we draw. Paths go in a straight line from
+// where we are to a destination, over a time worked out from the distance, with optional easing.
+////////////////////////////////////////////////////////////////////////
+
+#include "fixmath.h"
+
+//speeds are given the way the dog's actions always have: pixels per 150 millisecond step.
+const int motionStepTime = 150;
+
+class Motion {
+  public:
+  fix16 x, y; //position in pixels
+  fix16 vx, vy; //velocity in pixels per millisecond
+  unsigned long last; //time of the last update
+
+  bool pathing; //following a path instead of the velocity
+  fix16 x0, y0, x1, y1; //start and end of the path
+  unsigned long pathStart, pathTime; //when the path started, and how long it takes in milliseconds
+  uint8_t curve; //easing along the path
+
+  Motion(){
+    x = y = vx = vy = 0;
+    last = 0;
+    pathing = false;
+  }
+
+  void set(int X, int Y){
+    x = toFix(X), y = toFix(Y);
+  }
+
+  int px(){ return fromFix(x); }
+  int py(){ return fromFix(y); }
+
+  //set the velocity from a per-step distance (like dx and dy on the dog)
+  void setVelocity(int dxStep, int dyStep){
+    vx = toFix(dxStep) / motionStepTime;
+    vy = toFix(dyStep) / motionStepTime;
+  }
+
+  //plan a straight path to X, Y at speed pixels per step. Both ends are inside a convex area (the walking area is
+  //a trapezoid), so every point in between is too.
+  void pathTo(int X, int Y, int speed, unsigned long now, uint8_t ease = EASE_LINEAR){
+    x0 = x, y0 = y;
+    x1 = toFix(X), y1 = toFix(Y);
+    int ddx = X - px(), ddy = Y - py();
+    uint32_t dist = isqrt(ddx*ddx + ddy*ddy);
+    pathTime = speed > 0 ? dist * motionStepTime / speed : 0;
+    pathStart = now;
+    curve = ease;
+    pathing = true;
+  }
+
+  //move along the velocity or path. Returns true once, when a path is finished.
+  bool update(unsigned long now){
+    unsigned long dt = now - last;
+    last = now;
+    if(pathing){
+      fix16 t = ease(curve, fixFrac(now - pathStart, pathTime));
+      x = fixLerp(x0, x1, t);
+      y = fixLerp(y0, y1, t);
+      if(now - pathStart >= pathTime){
+        pathing = false;
+        return true;
+      }
+      return false;
+    }
+    if(dt > 1000) dt = 1000; //don't jump across the screen after a long stall
+    x += vx * (fix16)dt;
+    y += vy * (fix16)dt;
+    return false;
+  }
+};
+
+#endif
@@ -0,0 +1,1268 @@
+#ifndef PACKED_ASSETS
+#define PACKED_ASSETS
+
+// Generated by tools/pack.py from the 16 bit image headers; don't edit, run the packer again.
+// 8 bit (RGB332) frames, each compressed on its own (see unpack.h).
+
+#include "unpack.h"
+
+// smallDogs.h: 32x32 frames, 4 across, 9 down; 9157 bytes, from 73728
+static const uint32_t packedDogsOffsets[] PROGMEM = {
+  0, 239, 459, 689, 909, 1213, 1528, 1832, 2145, 2388, 2619, 2860,
+  3091, 3398, 3710, 4013, 4324, 4542, 4769, 5002, 5232, 5537, 5826, 6109,
+  6386, 6667, 6943, 7201, 7427, 7696, 7970, 7988, 8264, 8571, 8864, 9139,
+  9157,
+};
+static const uint8_t packedDogsData[] PROGMEM = {
+  0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xc6, 0x00, 0x02, 0x48, 0x48, 0x48, 0x9a, 0x1e, 0x02, 0xfb, 0xfb, 0xd5, 0x99, 0x20, 0x80, 0x3e, 0x02, 0x88,
+  0x48, 0x1c, 0x96, 0x21, 0x05, 0x48, 0xd5, 0x48, 0x88, 0x88, 0x88, 0x80, 0x05, 0x94, 0x1e, 0x00, 0xb1, 0x80, 0x5d, 0x04, 0x48, 0x48, 0xd5, 0xfb,
+  0xb1, 0x93, 0x20, 0x02, 0x48, 0xb1, 0xd1, 0x83, 0x00, 0x95, 0x1f, 0x04, 0xd1, 0xd1, 0xfb, 0xd1, 0xd5, 0x80, 0x03, 0x00, 0xd1, 0x92, 0x1f, 0x03,
+  0x48, 0xd1, 0xd5, 0x88, 0x80, 0x03, 0x02, 0xd1, 0x48, 0x88, 0x80, 0x03, 0x92, 0x1f, 0x04, 0xfb, 0xd5, 0xd5, 0xd5, 0x48, 0x80, 0x03, 0x00, 0xfb,
+  0x93, 0x1f, 0x03, 0xfb, 0xff, 0xfb, 0x88, 0x82, 0x01, 0x01, 0xff, 0xfb, 0x91, 0x1f, 0x00, 0x44, 0x80, 0x17, 0x83, 0xbf, 0x02, 0xff, 0xfb, 0x44,
+  0x90, 0x1f, 0x00, 0x00, 0x80, 0x20, 0x02, 0xff, 0xfb, 0xf2, 0x81, 0x04, 0x01, 0x44, 0x00, 0x92, 0x1f, 0x00, 0xd1, 0x80, 0x1b, 0x80, 0x00, 0x01,
+  0xfb, 0xd1, 0x91, 0x1f, 0x0d, 0x00, 0x00, 0x44, 0x88, 0xd1, 0xd5, 0xfb, 0xfb, 0xfb, 0xd5, 0xd1, 0x88, 0x44, 0x00, 0x8f, 0x20, 0x80, 0x1f, 0x00,
+  0xd1, 0x80, 0x1d, 0x00, 0xff, 0x80, 0x03, 0x80, 0x3f, 0x91, 0x1f, 0x81, 0x20, 0x05, 0x44, 0x44, 0x44, 0xfb, 0xd1, 0x24, 0x80, 0x0b, 0x95, 0x1f,
+  0x80, 0xa5, 0x97, 0x1f, 0x01, 0x88, 0xd5, 0x80, 0x1f, 0x01, 0xd5, 0x88, 0x92, 0x1f, 0x81, 0x80, 0x01, 0xff, 0xff, 0x80, 0x1f, 0x01, 0xff, 0xff,
+  0x80, 0x1f, 0x91, 0xdf, 0x80, 0x20, 0x80, 0x98, 0x01, 0x00, 0x24, 0x93, 0x3e, 0x82, 0x20, 0x85, 0x00, 0x91, 0x1e, 0x87, 0x21, 0x89, 0x12, 0x00,
+  0x1c, 0xff, 0x00, 0xff, 0x00, 0xe7, 0x00, 0x02, 0x48, 0x48, 0x48, 0x9a, 0x1e, 0x02, 0xfb, 0xd5, 0xfb, 0x98, 0x20, 0x80, 0x3d, 0x00, 0x88, 0x98,
+  0x41, 0x05, 0x48, 0xd5, 0x48, 0x88, 0x88, 0x88, 0x80, 0x05, 0x94, 0x1e, 0x02, 0xb1, 0xfb, 0xd5, 0x80, 0x3d, 0x02, 0xd5, 0xfb, 0xb1, 0x93, 0x20,
+  0x02, 0x48, 0xb1, 0xd1, 0x83, 0x00, 0x95, 0x1f, 0x04, 0xd1, 0xd1, 0xfb, 0xd1, 0xd5, 0x80, 0x03, 0x00, 0xd1, 0x92, 0x1f, 0x03, 0x48, 0xd1, 0xd5,
+  0x88, 0x80, 0x03, 0x02, 0xd1, 0x48, 0x88, 0x80, 0x03, 0x92, 0x1f, 0x04, 0xfb, 0xd5, 0xd5, 0xd5, 0x48, 0x80, 0x03, 0x00, 0xfb, 0x93, 0x1f, 0x03,
+  0xfb, 0xff, 0xfb, 0x88, 0x82, 0x01, 0x01, 0xff, 0xfb, 0x91, 0x1f, 0x00, 0x44, 0x80, 0x17, 0x83, 0xbf, 0x02, 0xff, 0xfb, 0x44, 0x90, 0x1f, 0x07,
+  0x00, 0x44, 0xd1, 0xff, 0xff, 0xfb, 0xf2, 0xfb, 0x80, 0x04, 0x01, 0x44, 0x00, 0x90, 0x1e, 0x05, 0x00, 0x44, 0x88, 0xd1, 0xd5, 0xff, 0x80, 0x00,
+  0x03, 0xfb, 0xd1, 0x44, 0x00, 0x8f, 0x20, 0x00, 0x00, 0x80, 0x20, 0x01, 0xd1, 0xfb, 0x81, 0x63, 0x01, 0xd1, 0x88, 0x97, 0x1f, 0x02, 0x44, 0x44,
+  0x44, 0x82, 0x3e, 0x93, 0x1f, 0x00, 0x88, 0x80, 0x1a, 0x00, 0x44, 0x82, 0x3e, 0x93, 0x1f, 0x00, 0xfb, 0x80, 0x99, 0x02, 0x44, 0xff, 0xd5, 0x92,
+  0x1f, 0x82, 0x20, 0x80, 0x19, 0x02, 0x44, 0xff, 0xff, 0x91, 0x7e, 0x82, 0x1f, 0x82, 0x00, 0x81, 0x24, 0x91, 0x1f, 0x86, 0x20, 0x94, 0x1e, 0x87,
+  0x21, 0x89, 0x12, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xc8, 0x00, 0x02, 0x48, 0x48, 0x48, 0x9a, 0x1e, 0x02, 0xd5, 0xfb, 0xfb, 0x97, 0x20, 0x03,
+  0x48, 0x1c, 0x48, 0x88, 0x98, 0x40, 0x05, 0x48, 0xd5, 0x48, 0x88, 0x88, 0x88, 0x80, 0x05, 0x94, 0x1e, 0x02, 0xb1, 0xfb, 0xd5, 0x80, 0x3d, 0x02,
+  0xd5, 0xfb, 0xb1, 0x93, 0x20, 0x02, 0x48, 0xb1, 0xd1, 0x83, 0x00, 0x95, 0x1f, 0x04, 0xd1, 0xd1, 0xfb, 0xd1, 0xd5, 0x80, 0x03, 0x00, 0xd1, 0x92,
+  0x1f, 0x03, 0x48, 0xd1, 0xd5, 0x88, 0x80, 0x03, 0x02, 0xd1, 0x48, 0x88, 0x80, 0x03, 0x92, 0x1f, 0x04, 0xfb, 0xd5, 0xd5, 0xd5, 0x48, 0x80, 0x03,
+  0x00, 0xfb, 0x93, 0x1f, 0x03, 0xfb, 0xff, 0xfb, 0x88, 0x82, 0x01, 0x01, 0xff, 0xfb, 0x91, 0x1f, 0x00, 0x44, 0x80, 0x17, 0x83, 0xbf, 0x02, 0xff,
+  0xfb, 0x44, 0x90, 0x1f, 0x00, 0x00, 0x80, 0x20, 0x02, 0xff, 0xfb, 0xf2, 0x81, 0x04, 0x01, 0x44, 0x00, 0x92, 0x1f, 0x00, 0xd1, 0x80, 0x1b, 0x80,
+  0x00, 0x01, 0xfb, 0xd1, 0x91, 0x1f, 0x0d, 0x00, 0x00, 0x44, 0x88, 0xd1, 0xd5, 0xfb, 0xfb, 0xfb, 0xd5, 0xd1, 0x88, 0x44, 0x00, 0x8f, 0x20, 0x80,
+  0x1f, 0x00, 0xd1, 0x80, 0x1d, 0x00, 0xff, 0x80, 0x03, 0x80, 0x3f, 0x91, 0x1f, 0x81, 0x20, 0x02, 0x44, 0x44, 0x44, 0x82, 0x1e, 0x96, 0x1f, 0x80,
+  0xa5, 0x97, 0x1f, 0x01, 0x88, 0xd5, 0x80, 0x1f, 0x00, 0xd5, 0x81, 0x7e, 0x93, 0xa0, 0x01, 0xff, 0xff, 0x80, 0x1f, 0x81, 0x04, 0x92, 0xdf, 0x80,
+  0x20, 0x81, 0x39, 0x82, 0x04, 0x90, 0x1f, 0x81, 0x20, 0x85, 0x00, 0x91, 0x1e, 0x87, 0x21, 0x89, 0x12, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xe7,
+  0x00, 0x02, 0x48, 0x48, 0x48, 0x9a, 0x1e, 0x02, 0xfb, 0xd5, 0xfb, 0x98, 0x20, 0x80, 0x3d, 0x00, 0x88, 0x98, 0x41, 0x05, 0x48, 0xd5, 0x48, 0x88,
+  0x88, 0x88, 0x80, 0x05, 0x94, 0x1e, 0x02, 0xb1, 0xfb, 0xd5, 0x80, 0x3d, 0x02, 0xd5, 0xfb, 0xb1, 0x93, 0x20, 0x02, 0x48, 0xb1, 0xd1, 0x83, 0x00,
+  0x95, 0x1f, 0x04, 0xd1, 0xd1, 0xfb, 0xd1, 0xd5, 0x80, 0x03, 0x00, 0xd1, 0x92, 0x1f, 0x03, 0x48, 0xd1, 0xd5, 0x88, 0x80, 0x03, 0x02, 0xd1, 0x48,
+  0x88, 0x80, 0x03, 0x92, 0x1f, 0x04, 0xfb, 0xd5, 0xd5, 0xd5, 0x48, 0x80, 0x03, 0x00, 0xfb, 0x93, 0x1f, 0x03, 0xfb, 0xff, 0xfb, 0x88, 0x82, 0x01,
+  0x01, 0xff, 0xfb, 0x91, 0x1f, 0x00, 0x44, 0x80, 0x17, 0x83, 0xbf, 0x02, 0xff, 0xfb, 0x44, 0x90, 0x1f, 0x00, 0x00, 0x80, 0x20, 0x02, 0xff, 0xfb,
+  0xf2, 0x80, 0x04, 0x02, 0xd1, 0x44, 0x00, 0x90, 0x1e, 0x02, 0x00, 0x44, 0xd1, 0x80, 0x1b, 0x06, 0xff, 0xff, 0xd5, 0xd1, 0x88, 0x44, 0x00, 0x8f,
+  0x20, 0x80, 0x1f, 0x01, 0x88, 0xd1, 0x81, 0x5b, 0x00, 0xfb, 0x80, 0x3e, 0x92, 0x1f, 0x81, 0x40, 0x02, 0x44, 0x44, 0x44, 0x98, 0x1f, 0x00, 0x88,
+  0x80, 0x1a, 0x00, 0x44, 0x82, 0x5e, 0x93, 0x1f, 0x01, 0xd5, 0xff, 0x80, 0x1f, 0x01, 0xfb, 0xfb, 0x92, 0x1f, 0x81, 0x80, 0x00, 0xff, 0x80, 0x1f,
+  0x01, 0x00, 0x44, 0x93, 0x1e, 0x82, 0x40, 0x81, 0x1a, 0x82, 0x00, 0x90, 0x1f, 0x81, 0x20, 0x99, 0x1e, 0x87, 0x21, 0x89, 0x12, 0x00, 0x1c, 0xff,
+  0x00, 0xff, 0x00, 0xca, 0x00, 0x00, 0x48, 0x88, 0x05, 0x91, 0x1e, 0x00, 0xd5, 0x81, 0x1a, 0x01, 0x48, 0xb1, 0x8b, 0x20, 0x00, 0x48, 0x80, 0x00,
+  0x83, 0x08, 0x02, 0xd1, 0xfb, 0xd5, 0x80, 0x0b, 0x00, 0xd1, 0x8b, 0x1f, 0x02, 0x48, 0xff, 0xfb, 0x80, 0x16, 0x83, 0x1f, 0x01, 0xd5, 0xd1, 0x81,
+  0x00, 0x84, 0x2e, 0x85, 0x1e, 0x03, 0xd5, 0xb1, 0xb1, 0xd1, 0x84, 0x58, 0x02, 0xd1, 0xd1, 0xfb, 0x80, 0x23, 0x00, 0xfb, 0x88, 0x1f, 0x03, 0x48,
+  0xfb, 0xd1, 0x88, 0x81, 0x60, 0x81, 0x00, 0x01, 0x88, 0xd1, 0x80, 0x0b, 0x80, 0x1f, 0x01, 0x48, 0x88, 0x87, 0x20, 0x04, 0x48, 0xfb, 0x88, 0x48,
+  0x88, 0x80, 0x37, 0x02, 0xd1, 0xb1, 0xb1, 0x80, 0x3e, 0x02, 0xd5, 0xfb, 0xd5, 0x81, 0x00, 0x00, 0xd1, 0x88, 0x1f, 0x01, 0xd5, 0xb1, 0x80, 0x36,
+  0x00, 0xd1, 0x81, 0x14, 0x80, 0x26, 0x00, 0xfb, 0x81, 0x8b, 0x01, 0xd5, 0x48, 0x88, 0x60, 0x01, 0x48, 0xd1, 0x81, 0x36, 0x83, 0x35, 0x06, 0xb1,
+  0xfb, 0xff, 0xff, 0xd5, 0x88, 0xfb, 0x80, 0x02, 0x89, 0x80, 0x00, 0x48, 0x83, 0x1d, 0x81, 0x20, 0x80, 0x1f, 0x01, 0xfb, 0xfb, 0x80, 0x88, 0x83,
+  0xce, 0x86, 0x61, 0x8a, 0x20, 0x02, 0xff, 0xfb, 0xf2, 0x89, 0x3e, 0x82, 0xf5, 0x80, 0x19, 0x82, 0x82, 0x83, 0x20, 0x00, 0xff, 0x8a, 0x1e, 0x80,
+  0xf5, 0x82, 0x18, 0x00, 0xfb, 0x83, 0x21, 0x02, 0xfb, 0xff, 0x48, 0x8b, 0x1e, 0x02, 0x1c, 0x44, 0x44, 0x81, 0x1e, 0x02, 0x48, 0x44, 0x44, 0x83,
+  0x20, 0x8d, 0x1e, 0x01, 0x1c, 0x00, 0x81, 0x1f, 0x04, 0x48, 0x48, 0x44, 0x00, 0x44, 0x81, 0x1f, 0x02, 0x48, 0x88, 0x44, 0x8c, 0x1e, 0x81, 0x1f,
+  0x00, 0x48, 0x80, 0x16, 0x80, 0x08, 0x00, 0xd1, 0x80, 0x1e, 0x80, 0x08, 0x8d, 0x1f, 0x80, 0x16, 0x84, 0x1f, 0x80, 0x47, 0x91, 0x1f, 0x00, 0x88,
+  0x80, 0x7c, 0x82, 0x1f, 0x83, 0x08, 0x8d, 0x1f, 0x01, 0xfb, 0xff, 0x80, 0x7c, 0x81, 0x1f, 0x84, 0x08, 0x8e, 0x80, 0x81, 0x1c, 0x81, 0x00, 0x83,
+  0x08, 0x8c, 0xbf, 0x80, 0x20, 0x8a, 0x00, 0x8d, 0x1e, 0x8a, 0x22, 0x8a, 0x15, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xea, 0x00, 0x00, 0x48, 0x88,
+  0x05, 0x91, 0x1e, 0x00, 0xd5, 0x81, 0x1a, 0x01, 0x48, 0xb1, 0x8b, 0x20, 0x01, 0x48, 0x48, 0x84, 0x0f, 0x03, 0x48, 0xd1, 0xfb, 0xd5, 0x80, 0x0c,
+  0x00, 0xd1, 0x8b, 0x1f, 0x03, 0x48, 0xfb, 0xfb, 0xfb, 0x84, 0x57, 0x02, 0xd1, 0xd5, 0xd1, 0x81, 0x00, 0x85, 0x2f, 0x83, 0x14, 0x03, 0xff, 0xd5,
+  0xb1, 0xb1, 0x83, 0x31, 0x04, 0x48, 0xb1, 0xd1, 0xd1, 0xfb, 0x80, 0x23, 0x84, 0x2e, 0x85, 0x1e, 0x00, 0x88, 0x80, 0x53, 0x82, 0x00, 0x03, 0x88,
+  0xd1, 0xd1, 0x88, 0x81, 0x43, 0x01, 0x48, 0x88, 0x87, 0x20, 0x04, 0x48, 0xfb, 0x88, 0x48, 0x88, 0x80, 0x37, 0x00, 0xd1, 0x80, 0x43, 0x04, 0xb1,
+  0xd1, 0xd5, 0xfb, 0xd5, 0x81, 0x00, 0x00, 0xd1, 0x8a, 0x1f, 0x80, 0x36, 0x00, 0xd1, 0x81, 0x14, 0x80, 0x26, 0x02, 0xfb, 0xff, 0xfb, 0x80, 0x21,
+  0x00, 0x48, 0x88, 0x60, 0x80, 0xd2, 0x80, 0x36, 0x83, 0x35, 0x02, 0xb1, 0xfb, 0xff, 0x80, 0x6d, 0x00, 0xfb, 0x80, 0x02, 0x88, 0x1f, 0x01, 0xd1,
+  0x48, 0x83, 0x1d, 0x81, 0x20, 0x80, 0x1f, 0x80, 0xcb, 0x00, 0x48, 0x80, 0x33, 0x89, 0xfd, 0x86, 0x1f, 0x82, 0x20, 0x02, 0xff, 0xfb, 0xf2, 0x89,
+  0xbf, 0x81, 0x61, 0x81, 0x19, 0x82, 0x82, 0x83, 0x20, 0x00, 0xff, 0x8a, 0x1e, 0x80, 0x61, 0x81, 0x17, 0x01, 0xfb, 0xfb, 0x83, 0x21, 0x03, 0xfb,
+  0xff, 0x44, 0x44, 0x8a, 0x1e, 0x01, 0x1c, 0x44, 0x80, 0xf1, 0x80, 0x74, 0x01, 0x44, 0x44, 0x82, 0x20, 0x02, 0x44, 0x44, 0x00, 0x8b, 0x1e, 0x09,
+  0x00, 0x44, 0xb1, 0xd1, 0xad, 0x44, 0x44, 0x48, 0x44, 0x00, 0x80, 0x21, 0x80, 0x1f, 0x01, 0x00, 0x00, 0x8b, 0x20, 0x03, 0x00, 0x44, 0x88, 0xad,
+  0x80, 0x1b, 0x01, 0x88, 0x88, 0x80, 0x04, 0x80, 0x6a, 0x00, 0xd1, 0x80, 0x20, 0x8c, 0x1f, 0x00, 0xfb, 0x81, 0x33, 0x00, 0x44, 0x80, 0x39, 0x03,
+  0x44, 0xad, 0x44, 0xad, 0x80, 0x26, 0x8d, 0x1f, 0x00, 0xff, 0x81, 0x1f, 0x80, 0x5d, 0x82, 0x02, 0x80, 0x9f, 0x8c, 0x80, 0x00, 0x44, 0x80, 0x16,
+  0x87, 0x00, 0x80, 0x0d, 0x8b, 0x1e, 0x80, 0x41, 0x8b, 0x00, 0x8d, 0x1e, 0x8a, 0x22, 0x8a, 0x15, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xca, 0x00,
+  0x00, 0x48, 0x88, 0x05, 0x91, 0x1e, 0x00, 0xd5, 0x81, 0x1a, 0x01, 0x48, 0xb1, 0x8b, 0x20, 0x00, 0x48, 0x80, 0x00, 0x83, 0x08, 0x02, 0xd1, 0xfb,
+  0xd5, 0x80, 0x0b, 0x00, 0xd1, 0x8b, 0x1f, 0x02, 0x48, 0xff, 0xfb, 0x80, 0x16, 0x83, 0x1f, 0x01, 0xd5, 0xd1, 0x81, 0x00, 0x84, 0x2e, 0x85, 0x1e,
+  0x03, 0xd5, 0xb1, 0xb1, 0xd1, 0x84, 0x58, 0x02, 0xd1, 0xd1, 0xfb, 0x80, 0x23, 0x00, 0xfb, 0x88, 0x1f, 0x03, 0x48, 0xfb, 0xd1, 0x88, 0x81, 0x60,
+  0x81, 0x00, 0x01, 0x88, 0xd1, 0x80, 0x0b, 0x80, 0x1f, 0x01, 0x48, 0x88, 0x87, 0x20, 0x04, 0x48, 0xfb, 0x88, 0x48, 0x88, 0x80, 0x37, 0x02, 0xd1,
+  0xb1, 0xb1, 0x80, 0x3e, 0x02, 0xd5, 0xfb, 0xd5, 0x81, 0x00, 0x00, 0xd1, 0x88, 0x1f, 0x01, 0xd5, 0xb1, 0x80, 0x36, 0x00, 0xd1, 0x81, 0x14, 0x80,
+  0x26, 0x00, 0xfb, 0x81, 0x8b, 0x01, 0xd5, 0x48, 0x88, 0x60, 0x01, 0x48, 0xd1, 0x81, 0x36, 0x83, 0x35, 0x06, 0xb1, 0xfb, 0xff, 0xff, 0xd5, 0x88,
+  0xfb, 0x80, 0x02, 0x89, 0x80, 0x00, 0x48, 0x83, 0x1d, 0x81, 0x20, 0x80, 0x1f, 0x01, 0xfb, 0xfb, 0x80, 0x88, 0x83, 0xce, 0x86, 0x61, 0x8a, 0x20,
+  0x02, 0xff, 0xfb, 0xf2, 0x89, 0x3e, 0x82, 0xf5, 0x80, 0x19, 0x82, 0x82, 0x83, 0x20, 0x00, 0xff, 0x8a, 0x1e, 0x80, 0xf5, 0x82, 0x18, 0x00, 0xfb,
+  0x83, 0x21, 0x02, 0xfb, 0xff, 0x48, 0x8b, 0x1e, 0x02, 0x1c, 0x44, 0x44, 0x81, 0x1e, 0x02, 0x48, 0x44, 0x44, 0x83, 0x20, 0x8d, 0x1e, 0x01, 0x1c,
+  0x00, 0x81, 0x1f, 0x04, 0x48, 0x48, 0x44, 0x00, 0x44, 0x81, 0x1f, 0x02, 0x48, 0x88, 0x44, 0x8c, 0x1e, 0x81, 0x1f, 0x00, 0x48, 0x80, 0x16, 0x80,
+  0x08, 0x00, 0xd1, 0x80, 0x1e, 0x80, 0x08, 0x8d, 0x1f, 0x80, 0x16, 0x84, 0x1f, 0x80, 0x47, 0x91, 0x1f, 0x00, 0x88, 0x80, 0x7c, 0x82, 0x1f, 0x83,
+  0x08, 0x8d, 0x1f, 0x01, 0xfb, 0xff, 0x80, 0x7c, 0x81, 0x1f, 0x84, 0x08, 0x8e, 0x80, 0x81, 0x1c, 0x81, 0x00, 0x83, 0x08, 0x8c, 0xbf, 0x80, 0x20,
+  0x8a, 0x00, 0x8d, 0x1e, 0x8a, 0x22, 0x8a, 0x15, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xea, 0x00, 0x00, 0x48, 0x88, 0x05, 0x91, 0x1e, 0x00, 0xd5,
+  0x81, 0x1a, 0x01, 0x48, 0xb1, 0x8b, 0x20, 0x01, 0x48, 0x48, 0x84, 0x0f, 0x03, 0x48, 0xd1, 0xfb, 0xd5, 0x80, 0x0c, 0x00, 0xd1, 0x8b, 0x1f, 0x03,
+  0x48, 0xfb, 0xfb, 0xfb, 0x84, 0x57, 0x02, 0xd1, 0xd5, 0xd1, 0x81, 0x00, 0x85, 0x2f, 0x83, 0x14, 0x03, 0xff, 0xd5, 0xb1, 0xb1, 0x83, 0x31, 0x04,
+  0x48, 0xb1, 0xd1, 0xd1, 0xfb, 0x80, 0x23, 0x84, 0x2e, 0x85, 0x1e, 0x00, 0x88, 0x80, 0x53, 0x82, 0x00, 0x03, 0x88, 0xd1, 0xd1, 0x88, 0x81, 0x43,
+  0x01, 0x48, 0x88, 0x87, 0x20, 0x04, 0x48, 0xfb, 0x88, 0x48, 0x88, 0x80, 0x37, 0x00, 0xd1, 0x80, 0x75, 0x04, 0xb1, 0xd1, 0xd5, 0xfb, 0xd5, 0x81,
+  0x00, 0x00, 0xd1, 0x8a, 0x1f, 0x80, 0x36, 0x00, 0xd1, 0x81, 0x15, 0x80, 0x26, 0x02, 0xfb, 0xff, 0xfb, 0x80, 0x21, 0x00, 0x48, 0x88, 0x60, 0x80,
+  0xd2, 0x80, 0x36, 0x83, 0x35, 0x02, 0xb1, 0xfb, 0xff, 0x80, 0x6d, 0x00, 0xfb, 0x80, 0x02, 0x88, 0x1f, 0x02, 0xd1, 0x48, 0xb1, 0x83, 0x1e, 0x80,
+  0x20, 0x80, 0x1f, 0x80, 0xcb, 0x00, 0x48, 0x80, 0x33, 0x89, 0xfd, 0x00, 0x88, 0x85, 0x1f, 0x82, 0x20, 0x02, 0xff, 0xfb, 0xf2, 0x89, 0xbf, 0x80,
+  0x00, 0x00, 0x44, 0x82, 0x5f, 0x82, 0x83, 0x82, 0x20, 0x00, 0xff, 0x8b, 0x1e, 0x01, 0x00, 0x00, 0x81, 0x20, 0x02, 0xd1, 0xfb, 0xfb, 0x82, 0x21,
+  0x02, 0xfb, 0xff, 0x48, 0x8b, 0x1e, 0x81, 0x1f, 0x80, 0xa2, 0x03, 0xd1, 0xfb, 0x44, 0x44, 0x81, 0x20, 0x80, 0x6e, 0x8e, 0x3e, 0x05, 0x88, 0x48,
+  0x48, 0xd1, 0xd1, 0x44, 0x80, 0x46, 0x80, 0x05, 0x00, 0x44, 0x80, 0x0d, 0x8e, 0x1f, 0x03, 0x44, 0x44, 0xad, 0xb1, 0x80, 0x1f, 0x00, 0xb1, 0x80,
+  0x04, 0x80, 0x0d, 0x8b, 0x20, 0x80, 0x11, 0x00, 0xd5, 0x80, 0x1b, 0x00, 0xad, 0x80, 0x24, 0x01, 0x88, 0x88, 0x80, 0x1f, 0x80, 0x46, 0x8c, 0x1f,
+  0x01, 0x00, 0x44, 0x81, 0x36, 0x80, 0x98, 0x00, 0xfb, 0x81, 0x1e, 0x81, 0x8e, 0x8c, 0x60, 0x83, 0x15, 0x81, 0x00, 0x82, 0x09, 0x8b, 0xbe, 0x86,
+  0x20, 0x85, 0x00, 0x8d, 0x1e, 0x8a, 0x22, 0x8a, 0x15, 0x00, 0x1c, 0xff, 0x00, 0xa7, 0x00, 0x00, 0x48, 0x88, 0x05, 0x91, 0x1e, 0x00, 0xd5, 0x81,
+  0x1a, 0x83, 0x05, 0x91, 0x1e, 0x08, 0xd1, 0xd5, 0xd5, 0x48, 0x48, 0x48, 0xd5, 0xd5, 0xd1, 0x93, 0x20, 0x09, 0x48, 0xb1, 0xd5, 0xd1, 0xd1, 0xb1,
+  0xd1, 0xd1, 0xd5, 0xb1, 0x94, 0x1f, 0x80, 0x3f, 0x80, 0x1f, 0x95, 0x3f, 0x81, 0x1e, 0x80, 0x1b, 0x82, 0x04, 0x91, 0x20, 0x9e, 0x1f, 0x81, 0x5a,
+  0x82, 0x1f, 0x00, 0xd1, 0x92, 0x80, 0x82, 0x1f, 0x83, 0x7f, 0x93, 0xa0, 0x00, 0x48, 0x80, 0xbd, 0x81, 0x00, 0x00, 0xd1, 0x95, 0xdf, 0x01, 0x88,
+  0xd1, 0x82, 0x3f, 0x01, 0xd1, 0x88, 0x97, 0xdf, 0x83, 0x7f, 0x95, 0x1f, 0x03, 0xd1, 0xd5, 0x48, 0x48, 0x80, 0x1e, 0x95, 0x1f, 0x04, 0xd5, 0xd5,
+  0x48, 0xfb, 0xff, 0x80, 0x05, 0x00, 0xd5, 0x96, 0x5f, 0x83, 0x1f, 0x94, 0x3f, 0x00, 0x24, 0x82, 0x3f, 0x00, 0xfb, 0x80, 0x20, 0x00, 0x24, 0x91,
+  0x1e, 0x00, 0x00, 0x82, 0x1f, 0x00, 0xfb, 0x82, 0x1f, 0x00, 0x00, 0x95, 0x1f, 0x01, 0xd5, 0xfb, 0x80, 0x03, 0x92, 0x1f, 0x04, 0x00, 0x00, 0x24,
+  0xd1, 0xfb, 0x80, 0x82, 0x05, 0xd1, 0x48, 0xfb, 0xd1, 0x24, 0x00, 0x8f, 0x20, 0x80, 0x1f, 0x08, 0xb1, 0xfb, 0x48, 0xb1, 0xd1, 0xb1, 0x48, 0xfb,
+  0xb1, 0x94, 0x1f, 0x00, 0xd1, 0x80, 0xbd, 0x02, 0xb1, 0x48, 0xff, 0x96, 0x3f, 0x07, 0xd1, 0xd1, 0xfb, 0x24, 0x24, 0x24, 0xfb, 0xd1, 0x94, 0x1f,
+  0x81, 0x60, 0x02, 0x24, 0x00, 0x24, 0x82, 0x5e, 0x93, 0xa0, 0x00, 0xfb, 0x82, 0x1f, 0x80, 0x04, 0x92, 0xdf, 0x80, 0x20, 0x81, 0x39, 0x82, 0x04,
+  0x90, 0x1f, 0x81, 0x20, 0x85, 0x00, 0x91, 0x1e, 0x87, 0x21, 0x89, 0x12, 0x00, 0x1c, 0xff, 0x00, 0xc7, 0x00, 0x00, 0x48, 0x88, 0x05, 0x91, 0x1e,
+  0x00, 0xd5, 0x81, 0x1a, 0x83, 0x05, 0x91, 0x1e, 0x08, 0xd1, 0xd5, 0xd5, 0x48, 0x48, 0x48, 0xd5, 0xd5, 0xd1, 0x93, 0x20, 0x09, 0x48, 0xb1, 0xd5,
+  0xd1, 0xd1, 0xb1, 0xd1, 0xd1, 0xd5, 0xb1, 0x94, 0x1f, 0x80, 0x3f, 0x80, 0x1f, 0x95, 0x3f, 0x81, 0x1e, 0x80, 0x1b, 0x82, 0x04, 0x91, 0x20, 0x9e,
+  0x1f, 0x81, 0x5a, 0x82, 0x1f, 0x00, 0xd1, 0x92, 0x80, 0x80, 0x1f, 0x00, 0xd1, 0x82, 0x7f, 0x80, 0xa4, 0x93, 0x80, 0x02, 0x88, 0xd1, 0xb1, 0x81,
+  0x00, 0x01, 0xd1, 0x88, 0xb2, 0xbf, 0x80, 0x1f, 0x81, 0x1b, 0x02, 0xd5, 0xd5, 0xb1, 0x95, 0xff, 0x80, 0x9a, 0x01, 0x48, 0x48, 0x80, 0x05, 0x96,
+  0x3f, 0x04, 0xd5, 0x48, 0xfb, 0xff, 0xfb, 0x80, 0x20, 0x93, 0x1f, 0x00, 0x24, 0x80, 0x18, 0x83, 0x1f, 0x00, 0x24, 0x91, 0x1e, 0x00, 0x00, 0x88,
+  0x1f, 0x00, 0x00, 0x93, 0x1f, 0x00, 0xfb, 0x82, 0x1f, 0x00, 0xfb, 0x92, 0x1f, 0x00, 0x00, 0x82, 0x1f, 0x01, 0xd5, 0xfb, 0x80, 0x43, 0x02, 0xb1,
+  0x24, 0x00, 0x8f, 0x20, 0x80, 0x1f, 0x08, 0xd1, 0xfb, 0x48, 0xb1, 0xd1, 0xb1, 0x48, 0xfb, 0xad, 0x96, 0x1f, 0x04, 0xff, 0x48, 0xb1, 0x48, 0xb1,
+  0x81, 0x3e, 0x92, 0x1f, 0x07, 0x88, 0xd5, 0xfb, 0x24, 0x24, 0x24, 0xfb, 0xfb, 0x95, 0x1f, 0x00, 0xd5, 0x82, 0x1a, 0x00, 0x24, 0x81, 0x1e, 0x91,
+  0xa0, 0x02, 0x24, 0xfb, 0xf2, 0x80, 0xb9, 0x83, 0x00, 0x91, 0xdf, 0x80, 0x39, 0x85, 0x1e, 0x91, 0x1f, 0x80, 0x20, 0x86, 0x00, 0x91, 0x1e, 0x87,
+  0x21, 0x89, 0x12, 0x00, 0x1c, 0xff, 0x00, 0xa7, 0x00, 0x00, 0x48, 0x88, 0x05, 0x91, 0x1e, 0x00, 0xd5, 0x81, 0x1a, 0x83, 0x05, 0x91, 0x1e, 0x08,
+  0xd1, 0xd5, 0xd5, 0x48, 0x48, 0x48, 0xd5, 0xd5, 0xd1, 0x93, 0x20, 0x09, 0x48, 0xb1, 0xd5, 0xd1, 0xd1, 0xb1, 0xd1, 0xd1, 0xd5, 0xb1, 0x94, 0x1f,
+  0x80, 0x3f, 0x80, 0x1f, 0x95, 0x3f, 0x81, 0x1e, 0x80, 0x1b, 0x82, 0x04, 0x91, 0x20, 0x9e, 0x1f, 0x81, 0x5a, 0x82, 0x1f, 0x00, 0xd1, 0x92, 0x80,
+  0x82, 0x1f, 0x83, 0x7f, 0x93, 0xa0, 0x00, 0x48, 0x80, 0xbd, 0x81, 0x00, 0x00, 0xd1, 0x95, 0xdf, 0x01, 0x88, 0xd1, 0x82, 0x3f, 0x01, 0xd1, 0x88,
+  0x97, 0xdf, 0x83, 0x7f, 0x95, 0x1f, 0x80, 0x1c, 0x02, 0x48, 0x48, 0xd5, 0x96, 0x5f, 0x80, 0x3a, 0x02, 0x48, 0xff, 0xfb, 0x80, 0x06, 0x97, 0x5f,
+  0x82, 0x1f, 0x94, 0x3f, 0x00, 0x24, 0x80, 0x1e, 0x00, 0xfb, 0x82, 0x3f, 0x00, 0x24, 0x91, 0x1e, 0x00, 0x00, 0x82, 0x1f, 0x00, 0xfb, 0x82, 0x1f,
+  0x00, 0x00, 0x95, 0x1f, 0x01, 0xd5, 0xfb, 0x80, 0x03, 0x92, 0x1f, 0x04, 0x00, 0x00, 0x24, 0xd1, 0xfb, 0x80, 0x82, 0x05, 0xd1, 0x48, 0xfb, 0xd1,
+  0x24, 0x00, 0x8f, 0x20, 0x80, 0x1f, 0x08, 0xb1, 0xfb, 0x48, 0xb1, 0xd1, 0xb1, 0x48, 0xfb, 0xb1, 0x94, 0x1f, 0x04, 0xd1, 0xfb, 0xff, 0x48, 0xb1,
+  0x80, 0xc1, 0x95, 0x3f, 0x07, 0xd1, 0xd1, 0xfb, 0x24, 0x24, 0x24, 0xfb, 0xd1, 0x94, 0x1f, 0x81, 0x60, 0x02, 0x24, 0x00, 0x24, 0x82, 0x5e, 0x93,
+  0xa0, 0x01, 0xff, 0xff, 0x80, 0x1f, 0x81, 0x04, 0x92, 0xdf, 0x80, 0x20, 0x81, 0x39, 0x82, 0x04, 0x90, 0x1f, 0x81, 0x20, 0x85, 0x00, 0x91, 0x1e,
+  0x87, 0x21, 0x89, 0x12, 0x00, 0x1c, 0xff, 0x00, 0xc7, 0x00, 0x00, 0x48, 0x88, 0x05, 0x91, 0x1e, 0x00, 0xd5, 0x81, 0x1a, 0x83, 0x05, 0x91, 0x1e,
+  0x08, 0xd1, 0xd5, 0xd5, 0x48, 0x48, 0x48, 0xd5, 0xd5, 0xd1, 0x93, 0x20, 0x09, 0x48, 0xb1, 0xd5, 0xd1, 0xd1, 0xb1, 0xd1, 0xd1, 0xd5, 0xb1, 0x94,
+  0x1f, 0x80, 0x3f, 0x80, 0x1f, 0x95, 0x3f, 0x81, 0x1e, 0x80, 0x1b, 0x82, 0x04, 0x91, 0x20, 0x9e, 0x1f, 0x81, 0x5a, 0x82, 0x1f, 0x00, 0xd1, 0x92,
+  0x80, 0x80, 0x1f, 0x00, 0xd1, 0x82, 0x7f, 0x80, 0xa4, 0x93, 0x80, 0x02, 0x88, 0xd1, 0xb1, 0x81, 0x00, 0x01, 0xd1, 0x88, 0xb2, 0xbf, 0x80, 0x60,
+  0x00, 0xb1, 0x82, 0x7f, 0x00, 0xd1, 0x95, 0x1f, 0x80, 0x1b, 0x02, 0x48, 0x48, 0x48, 0x80, 0xa0, 0x94, 0x1f, 0x80, 0x18, 0x03, 0xfb, 0xff, 0xfb,
+  0x48, 0x95, 0x5f, 0x00, 0x44, 0x85, 0x1f, 0x01, 0xd5, 0x44, 0x91, 0x1e, 0x01, 0x00, 0x24, 0x87, 0x1f, 0x00, 0x00, 0x93, 0x1f, 0x00, 0xfb, 0x82,
+  0x1f, 0x00, 0xfb, 0x92, 0x1f, 0x03, 0x00, 0x00, 0x24, 0xb1, 0x80, 0x3b, 0x00, 0xfb, 0x80, 0x43, 0x80, 0x1f, 0x8f, 0x20, 0x80, 0x1f, 0x08, 0xad,
+  0xfb, 0x48, 0xb1, 0xd1, 0xb1, 0x48, 0xfb, 0xd1, 0x93, 0x1f, 0x80, 0x40, 0x04, 0xb1, 0x48, 0xb1, 0x48, 0xff, 0x97, 0x1f, 0x07, 0xfb, 0xfb, 0x24,
+  0x24, 0x44, 0xfb, 0xd5, 0x88, 0x94, 0x1f, 0x06, 0x00, 0x24, 0x24, 0x00, 0x00, 0x44, 0xfb, 0x93, 0x7f, 0x82, 0x20, 0x81, 0x23, 0x02, 0xd5, 0xf2,
+  0xfb, 0x93, 0xdf, 0x85, 0x20, 0x00, 0x24, 0x92, 0x3e, 0x87, 0x20, 0x80, 0x00, 0x91, 0x1e, 0x87, 0x21, 0x89, 0x12, 0x00, 0x1c, 0xff, 0x00, 0xff,
+  0x00, 0xbe, 0x00, 0x00, 0x48, 0x88, 0x05, 0x91, 0x1e, 0x00, 0xb1, 0x81, 0x1a, 0x01, 0x48, 0xd5, 0x95, 0x20, 0x08, 0x48, 0xb1, 0xd1, 0x48, 0x48,
+  0x48, 0xd5, 0xfb, 0xd1, 0x84, 0x47, 0x80, 0x00, 0x8b, 0x1f, 0x01, 0x48, 0xd1, 0x81, 0x00, 0x00, 0xd5, 0x83, 0x1f, 0x80, 0x28, 0x01, 0xfb, 0xff,
+  0x8a, 0x20, 0x01, 0x48, 0xfb, 0x80, 0x1b, 0x02, 0xfb, 0xd1, 0xd1, 0x84, 0x66, 0x03, 0xd1, 0xb1, 0xb1, 0xd5, 0x89, 0x20, 0x02, 0x48, 0x88, 0x48,
+  0x81, 0x3b, 0x03, 0x88, 0xd1, 0xd1, 0x88, 0x81, 0x5a, 0x81, 0x00, 0x02, 0x88, 0xd1, 0xfb, 0x87, 0x20, 0x80, 0x1d, 0x81, 0x00, 0x00, 0xfb, 0x80,
+  0x38, 0x02, 0x48, 0xb1, 0xb1, 0x80, 0x68, 0x03, 0xb1, 0x88, 0x48, 0x88, 0x89, 0x1f, 0x01, 0xfb, 0x48, 0x80, 0x1d, 0x02, 0xfb, 0xff, 0xfb, 0x80,
+  0x18, 0x81, 0x2a, 0x80, 0x21, 0x01, 0x88, 0xb1, 0x88, 0xcc, 0x03, 0x48, 0xfb, 0x88, 0xd5, 0x80, 0x02, 0x03, 0xff, 0xff, 0xfb, 0xb1, 0x83, 0x49,
+  0x81, 0x48, 0x84, 0xcb, 0x83, 0xb0, 0x80, 0x71, 0x80, 0x3f, 0x80, 0x40, 0x83, 0x1e, 0x80, 0x00, 0x8a, 0xe1, 0x02, 0x48, 0xfb, 0xf2, 0x80, 0x1d,
+  0x89, 0x1e, 0x88, 0x5d, 0x82, 0x20, 0x80, 0x1d, 0x84, 0x1e, 0x80, 0x7c, 0x81, 0x05, 0x8b, 0x1f, 0x04, 0x1c, 0x48, 0x48, 0xff, 0xfb, 0x83, 0x1d,
+  0x00, 0xfb, 0x82, 0x26, 0x00, 0xb1, 0x8c, 0x1f, 0x80, 0x20, 0x83, 0x1e, 0x02, 0x24, 0x24, 0x48, 0x81, 0x20, 0x01, 0x24, 0x24, 0x8c, 0x1f, 0x01,
+  0x44, 0x88, 0x81, 0x20, 0x05, 0xd1, 0x24, 0x00, 0x24, 0x48, 0x48, 0x81, 0x1f, 0x00, 0x00, 0x8b, 0x1e, 0x02, 0x00, 0x44, 0x88, 0x80, 0x20, 0x80,
+  0x1e, 0x02, 0x00, 0x24, 0x88, 0x81, 0x4a, 0x80, 0x08, 0x8d, 0x1f, 0x80, 0x37, 0x86, 0x1f, 0x81, 0x08, 0x8c, 0x1f, 0x80, 0x79, 0x00, 0x88, 0x82,
+  0x1f, 0x85, 0x08, 0x8b, 0x1f, 0x00, 0x24, 0x80, 0x79, 0x01, 0xff, 0xfb, 0x81, 0x1f, 0x85, 0x08, 0x8c, 0x80, 0x81, 0x19, 0x80, 0x15, 0x81, 0x00,
+  0x82, 0x08, 0x8c, 0xbf, 0x81, 0x20, 0x89, 0x00, 0x8d, 0x1e, 0x8a, 0x22, 0x88, 0x13, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xde, 0x00, 0x00, 0x48,
+  0x88, 0x05, 0x91, 0x1e, 0x00, 0xb1, 0x81, 0x1a, 0x01, 0x48, 0xd5, 0x95, 0x20, 0x08, 0x48, 0xb1, 0xd1, 0x48, 0x48, 0x48, 0xd5, 0xfb, 0xd1, 0x84,
+  0x20, 0x80, 0x0c, 0x8b, 0x1f, 0x01, 0x48, 0xd1, 0x81, 0x00, 0x00, 0xd5, 0x84, 0x1f, 0x03, 0x48, 0xfb, 0xfb, 0xfb, 0x8a, 0x20, 0x01, 0x48, 0xfb,
+  0x80, 0x1b, 0x02, 0xfb, 0xd1, 0xd1, 0x82, 0x66, 0x80, 0x4d, 0x03, 0xb1, 0xb1, 0xd5, 0xff, 0x88, 0x20, 0x02, 0x48, 0x88, 0x48, 0x81, 0x3b, 0x03,
+  0x88, 0xd1, 0xd1, 0x88, 0x80, 0x59, 0x82, 0x00, 0x00, 0x88, 0x89, 0x20, 0x80, 0x1d, 0x81, 0x00, 0x01, 0xfb, 0xd5, 0x80, 0x40, 0x01, 0xb1, 0xb1,
+  0x80, 0x68, 0x03, 0xb1, 0x88, 0x48, 0x88, 0x88, 0x61, 0x02, 0x48, 0xfb, 0x48, 0x80, 0x1d, 0x02, 0xfb, 0xff, 0xfb, 0x80, 0x18, 0x81, 0x2a, 0x80,
+  0x21, 0x00, 0x88, 0x8b, 0x1f, 0x01, 0x88, 0xd5, 0x80, 0x02, 0x03, 0xff, 0xff, 0xfb, 0xb1, 0x83, 0x49, 0x81, 0x48, 0x88, 0xec, 0x80, 0x0b, 0x00,
+  0x48, 0x80, 0xb3, 0x80, 0x1f, 0x84, 0x1e, 0x80, 0x00, 0x00, 0x48, 0x85, 0xeb, 0x83, 0x40, 0x00, 0xf2, 0x80, 0x1d, 0x89, 0x1e, 0x80, 0x31, 0x8a,
+  0xe0, 0x80, 0x1d, 0x84, 0x1e, 0x80, 0x7c, 0x82, 0x1f, 0x89, 0x1e, 0x05, 0x1c, 0x1c, 0x24, 0x24, 0xff, 0xfb, 0x83, 0x1d, 0x01, 0xfb, 0xfb, 0x81,
+  0x27, 0x89, 0x5d, 0x82, 0x00, 0x02, 0x00, 0x24, 0x24, 0x82, 0x1e, 0x01, 0x24, 0x24, 0x80, 0x8a, 0x03, 0xd1, 0xd5, 0xd1, 0x24, 0x8c, 0x1e, 0x01,
+  0x00, 0x00, 0x80, 0x1f, 0x80, 0x1d, 0x09, 0x00, 0x24, 0x48, 0x24, 0x24, 0xad, 0xd1, 0xb1, 0x24, 0x00, 0x8c, 0x1f, 0x00, 0x24, 0x80, 0x34, 0x00,
+  0x48, 0x80, 0x1e, 0x01, 0x88, 0x88, 0x80, 0x04, 0x00, 0xad, 0x80, 0x04, 0x8d, 0x1f, 0x03, 0x88, 0xad, 0x24, 0xad, 0x80, 0x1a, 0x01, 0xd5, 0x24,
+  0x81, 0x4b, 0x00, 0xfb, 0x8d, 0x1f, 0x80, 0x9f, 0x80, 0x1c, 0x82, 0x02, 0x81, 0x1f, 0x00, 0xff, 0x8c, 0x1f, 0x80, 0xc0, 0x82, 0x18, 0x84, 0x00,
+  0x80, 0x0d, 0x8c, 0xbf, 0x81, 0xa1, 0x89, 0x00, 0x8d, 0x1e, 0x8a, 0x22, 0x88, 0x13, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xbe, 0x00, 0x00, 0x48,
+  0x88, 0x05, 0x91, 0x1e, 0x00, 0xb1, 0x81, 0x1a, 0x01, 0x48, 0xd5, 0x95, 0x20, 0x08, 0x48, 0xb1, 0xd1, 0x48, 0x48, 0x48, 0xd5, 0xfb, 0xd1, 0x84,
+  0x47, 0x80, 0x00, 0x8b, 0x1f, 0x01, 0x48, 0xd1, 0x81, 0x00, 0x00, 0xd5, 0x83, 0x1f, 0x80, 0x28, 0x01, 0xfb, 0xff, 0x8a, 0x20, 0x01, 0x48, 0xfb,
+  0x80, 0x1b, 0x02, 0xfb, 0xd1, 0xd1, 0x84, 0x66, 0x03, 0xd1, 0xb1, 0xb1, 0xd5, 0x89, 0x20, 0x02, 0x48, 0x88, 0x48, 0x81, 0x3b, 0x03, 0x88, 0xd1,
+  0xd1, 0x88, 0x81, 0x5a, 0x81, 0x00, 0x02, 0x88, 0xd1, 0xfb, 0x87, 0x20, 0x80, 0x1d, 0x81, 0x00, 0x00, 0xfb, 0x80, 0x38, 0x02, 0x48, 0xb1, 0xb1,
+  0x80, 0x68, 0x03, 0xb1, 0x88, 0x48, 0x88, 0x89, 0x1f, 0x01, 0xfb, 0x48, 0x80, 0x1d, 0x02, 0xfb, 0xff, 0xfb, 0x80, 0x18, 0x81, 0x2a, 0x80, 0x21,
+  0x01, 0x88, 0xb1, 0x88, 0xcc, 0x03, 0x48, 0xfb, 0x88, 0xd5, 0x80, 0x02, 0x03, 0xff, 0xff, 0xfb, 0xb1, 0x83, 0x49, 0x81, 0x48, 0x84, 0xcb, 0x83,
+  0xb0, 0x80, 0x71, 0x80, 0x3f, 0x80, 0x40, 0x83, 0x1e, 0x80, 0x00, 0x8a, 0xe1, 0x02, 0x48, 0xfb, 0xf2, 0x80, 0x1d, 0x89, 0x1e, 0x88, 0x5d, 0x82,
+  0x20, 0x80, 0x1d, 0x84, 0x1e, 0x80, 0x7c, 0x81, 0x05, 0x8b, 0x1f, 0x04, 0x1c, 0x48, 0x48, 0xff, 0xfb, 0x83, 0x1d, 0x00, 0xfb, 0x82, 0x26, 0x00,
+  0xb1, 0x8c, 0x1f, 0x80, 0x20, 0x83, 0x1e, 0x02, 0x24, 0x24, 0x48, 0x81, 0x20, 0x01, 0x24, 0x24, 0x8c, 0x1f, 0x01, 0x24, 0x88, 0x81, 0x20, 0x05,
+  0xd1, 0x24, 0x00, 0x24, 0x48, 0x48, 0x81, 0x1f, 0x00, 0x00, 0x8b, 0x1e, 0x02, 0x00, 0x24, 0x88, 0x80, 0x20, 0x80, 0x1e, 0x80, 0x08, 0x81, 0x4a,
+  0x80, 0x08, 0x8d, 0x1f, 0x80, 0x37, 0x86, 0x1f, 0x81, 0x08, 0x8c, 0x1f, 0x80, 0x79, 0x00, 0x88, 0x82, 0x1f, 0x85, 0x08, 0x8c, 0x1f, 0x80, 0x79,
+  0x01, 0xff, 0xfb, 0x81, 0x1f, 0x85, 0x08, 0x8c, 0x80, 0x81, 0x19, 0x80, 0x15, 0x81, 0x00, 0x82, 0x08, 0x8c, 0xbf, 0x81, 0x20, 0x89, 0x00, 0x8d,
+  0x1e, 0x8a, 0x22, 0x88, 0x13, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xde, 0x00, 0x00, 0x48, 0x88, 0x05, 0x91, 0x1e, 0x00, 0xb1, 0x81, 0x1a, 0x01,
+  0x48, 0xd5, 0x95, 0x20, 0x08, 0x48, 0xb1, 0xd1, 0x48, 0x48, 0x48, 0xd5, 0xfb, 0xd1, 0x84, 0x20, 0x80, 0x0c, 0x8b, 0x1f, 0x01, 0x48, 0xd1, 0x81,
+  0x00, 0x00, 0xd5, 0x84, 0x1f, 0x03, 0x48, 0xfb, 0xfb, 0xfb, 0x8a, 0x20, 0x01, 0x48, 0xfb, 0x80, 0x1b, 0x02, 0xfb, 0xd1, 0xd1, 0x82, 0x66, 0x80,
+  0x4d, 0x03, 0xb1, 0xb1, 0xd5, 0xff, 0x88, 0x20, 0x02, 0x48, 0x88, 0x48, 0x81, 0x3b, 0x03, 0x88, 0xd1, 0xd1, 0x88, 0x80, 0x59, 0x82, 0x00, 0x00,
+  0x88, 0x89, 0x20, 0x80, 0x1d, 0x81, 0x00, 0x01, 0xfb, 0xd5, 0x80, 0x40, 0x00, 0xb1, 0x81, 0x68, 0x03, 0xb1, 0x88, 0x48, 0x88, 0x88, 0x61, 0x02,
+  0x48, 0xfb, 0x48, 0x80, 0x1d, 0x02, 0xfb, 0xff, 0xfb, 0x80, 0x18, 0x81, 0x28, 0x80, 0x21, 0x00, 0x88, 0x8b, 0x1f, 0x01, 0x88, 0xd5, 0x80, 0x02,
+  0x03, 0xff, 0xff, 0xfb, 0xb1, 0x83, 0x49, 0x81, 0x48, 0x88, 0xec, 0x80, 0x0b, 0x00, 0x48, 0x80, 0xb3, 0x80, 0x1f, 0x84, 0x1e, 0x03, 0xd5, 0xd5,
+  0xb1, 0x48, 0x85, 0xeb, 0x83, 0x40, 0x00, 0xf2, 0x80, 0x1d, 0x88, 0x1e, 0x00, 0xd5, 0x80, 0xa8, 0x8a, 0xe0, 0x80, 0x1d, 0x83, 0x1e, 0x00, 0xd1,
+  0x82, 0x23, 0x01, 0xd1, 0x44, 0x89, 0x1d, 0x81, 0x20, 0x02, 0x48, 0xff, 0xfb, 0x82, 0x1d, 0x00, 0xfb, 0x81, 0x25, 0x03, 0xd1, 0x44, 0x00, 0x00,
+  0x8c, 0x1f, 0x80, 0x50, 0x81, 0x1e, 0x02, 0x44, 0x44, 0xfb, 0x80, 0xde, 0x00, 0x48, 0x90, 0x1f, 0x02, 0x44, 0x44, 0x44, 0x80, 0xd7, 0x01, 0x44,
+  0x00, 0x80, 0x05, 0x00, 0x48, 0x80, 0x0d, 0x8b, 0x20, 0x01, 0x48, 0x88, 0x81, 0x11, 0x02, 0x44, 0xb1, 0xb1, 0x80, 0x1f, 0x03, 0xb1, 0xad, 0x44,
+  0x44, 0x8e, 0x1f, 0x81, 0x71, 0x01, 0x00, 0x44, 0x80, 0x25, 0x02, 0x44, 0x88, 0xad, 0x80, 0x23, 0x00, 0xd5, 0x8d, 0x1f, 0x81, 0x1e, 0x80, 0x20,
+  0x00, 0xfb, 0x80, 0xa6, 0x81, 0x48, 0x81, 0x0e, 0x8b, 0x80, 0x83, 0x1f, 0x81, 0x00, 0x82, 0x09, 0x8d, 0x1e, 0x84, 0x20, 0x87, 0x00, 0x8d, 0x1e,
+  0x8a, 0x22, 0x88, 0x13, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x83, 0x00, 0x00, 0x48, 0x83, 0x00, 0x96, 0x1e, 0x04, 0xd5, 0x48, 0x88,
+  0x88, 0x88, 0x80, 0x05, 0x94, 0x1e, 0x02, 0xb1, 0xfb, 0xd5, 0x80, 0x3d, 0x02, 0xd5, 0xfb, 0xb1, 0x93, 0x20, 0x02, 0x48, 0xb1, 0xd1, 0x83, 0x00,
+  0x95, 0x1f, 0x04, 0xd1, 0xd1, 0xfb, 0xd1, 0xd5, 0x80, 0x03, 0x00, 0xd1, 0x92, 0x1f, 0x03, 0x48, 0xd1, 0xd5, 0x88, 0x80, 0x03, 0x02, 0xd1, 0x48,
+  0x88, 0x80, 0x03, 0x92, 0x1f, 0x04, 0xfb, 0xd5, 0xd5, 0xd5, 0x48, 0x80, 0x03, 0x00, 0xfb, 0x93, 0x1f, 0x03, 0xfb, 0xff, 0xfb, 0x88, 0x82, 0x01,
+  0x01, 0xff, 0xfb, 0x91, 0x1f, 0x00, 0x24, 0x80, 0x17, 0x83, 0xbf, 0x02, 0xff, 0xfb, 0x24, 0x90, 0x1f, 0x00, 0x00, 0x80, 0x20, 0x02, 0xff, 0xfb,
+  0xf2, 0x81, 0x04, 0x01, 0x24, 0x00, 0x92, 0x1f, 0x00, 0xd1, 0x80, 0x1b, 0x80, 0x00, 0x01, 0xfb, 0xd1, 0x91, 0x1f, 0x0d, 0x00, 0x00, 0x24, 0x88,
+  0xd1, 0xd5, 0xfb, 0xfb, 0xfb, 0xd5, 0xd1, 0x88, 0x24, 0x00, 0x8f, 0x20, 0x80, 0x1f, 0x00, 0xd1, 0x80, 0x1d, 0x00, 0xff, 0x80, 0x03, 0x80, 0x3f,
+  0x91, 0x1f, 0x81, 0x20, 0x02, 0x24, 0x24, 0x24, 0x82, 0x1e, 0x96, 0x1f, 0x80, 0xa5, 0x97, 0x1f, 0x01, 0x88, 0xd5, 0x80, 0x1f, 0x00, 0xd5, 0x81,
+  0x7e, 0x93, 0xa0, 0x01, 0xff, 0xff, 0x80, 0x1f, 0x81, 0x04, 0x92, 0xdf, 0x80, 0x20, 0x81, 0x39, 0x82, 0x04, 0x90, 0x1f, 0x81, 0x20, 0x85, 0x00,
+  0x91, 0x1e, 0x87, 0x21, 0x89, 0x12, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xe5, 0x00, 0x00, 0x48, 0x88, 0x05, 0x91, 0x1e, 0x00, 0xd5, 0x81, 0x1a,
+  0x83, 0x05, 0x91, 0x1e, 0x08, 0xb1, 0xfb, 0xd5, 0x48, 0x48, 0x48, 0xd5, 0xfb, 0xb1, 0x93, 0x20, 0x02, 0x48, 0xb1, 0xd1, 0x83, 0x00, 0x95, 0x1f,
+  0x04, 0xd1, 0xd1, 0xfb, 0xd1, 0xd5, 0x80, 0x03, 0x00, 0xd1, 0x92, 0x1f, 0x03, 0x48, 0xd1, 0xd5, 0x88, 0x80, 0x03, 0x02, 0xd1, 0x48, 0x88, 0x80,
+  0x03, 0x92, 0x1f, 0x04, 0xfb, 0xd5, 0xd5, 0xd5, 0x48, 0x80, 0x03, 0x00, 0xfb, 0x93, 0x1f, 0x03, 0xfb, 0xff, 0xfb, 0x88, 0x82, 0x01, 0x01, 0xff,
+  0xfb, 0x95, 0x1f, 0x83, 0xbf, 0x93, 0x1f, 0x81, 0x20, 0x02, 0xff, 0xfb, 0xf2, 0x81, 0x04, 0x00, 0x24, 0x92, 0x1e, 0x80, 0x80, 0x00, 0xff, 0x81,
+  0x00, 0x03, 0xfb, 0xd1, 0x24, 0x00, 0x91, 0x3d, 0x09, 0x48, 0x88, 0xd1, 0xd5, 0xfb, 0xfb, 0xfb, 0xd5, 0xd1, 0x88, 0x91, 0x1f, 0x01, 0x24, 0xd1,
+  0x80, 0x3f, 0x00, 0xfb, 0x80, 0x7b, 0x00, 0xfb, 0x81, 0x3f, 0x8f, 0x20, 0x03, 0x00, 0x24, 0x24, 0x88, 0x82, 0x60, 0x00, 0xfb, 0x81, 0x3f, 0x90,
+  0x1f, 0x01, 0x00, 0x24, 0x80, 0x40, 0x80, 0xbf, 0x80, 0xfd, 0x94, 0x1f, 0x00, 0x24, 0x80, 0x1f, 0x00, 0x88, 0x80, 0x1f, 0x00, 0x24, 0x93, 0x1f,
+  0x07, 0x00, 0x24, 0x88, 0xd5, 0x24, 0x24, 0x24, 0xd5, 0x81, 0x5e, 0x90, 0xa0, 0x80, 0x1f, 0x02, 0xff, 0xff, 0x24, 0x83, 0x04, 0x90, 0x1e, 0x82,
+  0x40, 0x81, 0x39, 0x82, 0x04, 0x90, 0x1f, 0x81, 0x20, 0x85, 0x00, 0x91, 0x1e, 0x87, 0x21, 0x89, 0x12, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xc5,
+  0x00, 0x00, 0x48, 0x88, 0x05, 0x91, 0x1e, 0x00, 0xd5, 0x81, 0x1a, 0x83, 0x05, 0x91, 0x1e, 0x08, 0xb1, 0xfb, 0xd5, 0x48, 0x48, 0x48, 0xd5, 0xfb,
+  0xb1, 0x93, 0x20, 0x02, 0x48, 0xb1, 0xd1, 0x83, 0x00, 0x95, 0x1f, 0x04, 0xd1, 0xd1, 0xfb, 0xd1, 0xd5, 0x80, 0x03, 0x00, 0xd1, 0x92, 0x1f, 0x03,
+  0x48, 0xd1, 0xd5, 0x88, 0x80, 0x03, 0x02, 0xd1, 0x48, 0x88, 0x80, 0x03, 0x92, 0x1f, 0x04, 0xfb, 0xd5, 0xd5, 0xd5, 0x48, 0x80, 0x03, 0x00, 0xfb,
+  0x93, 0x1f, 0x03, 0xfb, 0xff, 0xfb, 0x88, 0x82, 0x01, 0x01, 0xff, 0xfb, 0x95, 0x1f, 0x83, 0xbf, 0x93, 0x1f, 0x81, 0x20, 0x02, 0xff, 0xfb, 0xf2,
+  0x81, 0x04, 0x93, 0xbf, 0x01, 0x24, 0xd1, 0x80, 0x1b, 0x80, 0x00, 0x02, 0xfb, 0xd1, 0x24, 0x91, 0x1e, 0x0c, 0x00, 0x24, 0x88, 0xd1, 0xd5, 0xfb,
+  0xfb, 0xfb, 0xd5, 0xd1, 0x88, 0x24, 0x00, 0x92, 0x1f, 0x00, 0xd1, 0x80, 0x1d, 0x00, 0xff, 0x80, 0x03, 0x00, 0xd1, 0x91, 0x1f, 0x00, 0x00, 0x80,
+  0x3f, 0x80, 0x1e, 0x80, 0x5e, 0x00, 0xfb, 0x80, 0x3f, 0x8f, 0x20, 0x05, 0x00, 0x24, 0x24, 0x48, 0xd1, 0xfb, 0x80, 0xbf, 0x80, 0xfd, 0x91, 0x1f,
+  0x00, 0x24, 0x80, 0x1b, 0x80, 0x1f, 0x00, 0x88, 0x95, 0x1f, 0x01, 0x48, 0xff, 0x9b, 0x1f, 0x00, 0x24, 0x80, 0x00, 0x01, 0x88, 0xd5, 0x80, 0x04,
+  0x02, 0xd5, 0x88, 0x24, 0x91, 0x1f, 0x81, 0xa0, 0x02, 0xff, 0xff, 0x24, 0x83, 0x04, 0x92, 0xdf, 0x80, 0x20, 0x80, 0x19, 0x83, 0x04, 0x90, 0x1f,
+  0x81, 0x20, 0x85, 0x00, 0x91, 0x1e, 0x87, 0x21, 0x89, 0x12, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xc5, 0x00, 0x00, 0x48, 0x88, 0x05, 0x91, 0x1e,
+  0x00, 0xd5, 0x81, 0x1a, 0x83, 0x05, 0x91, 0x1e, 0x08, 0xb1, 0xfb, 0xd5, 0x48, 0x48, 0x48, 0xd5, 0xfb, 0xb1, 0x93, 0x20, 0x02, 0x48, 0xb1, 0xd1,
+  0x83, 0x00, 0x95, 0x1f, 0x04, 0xd1, 0xd1, 0xfb, 0xd1, 0xd5, 0x80, 0x03, 0x00, 0xd1, 0x92, 0x1f, 0x03, 0x48, 0xd1, 0xd5, 0x88, 0x80, 0x03, 0x02,
+  0xd1, 0x48, 0x88, 0x80, 0x03, 0x92, 0x1f, 0x04, 0xfb, 0xd5, 0xd5, 0xd5, 0x48, 0x80, 0x03, 0x00, 0xfb, 0x93, 0x1f, 0x03, 0xfb, 0xff, 0xfb, 0x88,
+  0x82, 0x01, 0x01, 0xff, 0xfb, 0x95, 0x1f, 0x83, 0xbf, 0x93, 0x1f, 0x81, 0x20, 0x02, 0xff, 0xfb, 0xf2, 0x81, 0x04, 0x93, 0xbf, 0x01, 0x24, 0xd1,
+  0x80, 0x1b, 0x80, 0x00, 0x02, 0xfb, 0xd1, 0x24, 0x91, 0x1e, 0x0c, 0x00, 0x24, 0x88, 0xd1, 0xd5, 0xfb, 0xfb, 0xfb, 0xd5, 0xd1, 0x88, 0x24, 0x00,
+  0x92, 0x1f, 0x00, 0xd1, 0x80, 0x1d, 0x00, 0xff, 0x80, 0x03, 0x00, 0xd1, 0x91, 0x1f, 0x00, 0x00, 0x80, 0x3f, 0x80, 0x1e, 0x80, 0x5e, 0x00, 0xfb,
+  0x80, 0x3f, 0x8f, 0x20, 0x05, 0x24, 0x24, 0x24, 0x48, 0xd1, 0xfb, 0x80, 0xbf, 0x80, 0xfd, 0x91, 0x1f, 0x02, 0x48, 0xff, 0x48, 0x81, 0x1f, 0x00,
+  0x88, 0x96, 0x1f, 0x80, 0x3b, 0x99, 0x1f, 0x81, 0x60, 0x01, 0x88, 0xd5, 0x80, 0x04, 0x02, 0xd5, 0x88, 0x24, 0x92, 0x1f, 0x80, 0xa0, 0x02, 0xff,
+  0xff, 0x24, 0x83, 0x04, 0x92, 0xdf, 0x80, 0x20, 0x80, 0x19, 0x83, 0x04, 0x90, 0x1f, 0x81, 0x20, 0x85, 0x00, 0x91, 0x1e, 0x87, 0x21, 0x89, 0x12,
+  0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xaa, 0x00, 0x00, 0x48, 0x88, 0x05, 0x91, 0x1e, 0x00, 0xd5, 0x81, 0x1a, 0x01, 0x48, 0xb1, 0x94, 0x20, 0x07,
+  0x48, 0xd1, 0xfb, 0xd5, 0x48, 0x48, 0x48, 0xd1, 0x97, 0x1f, 0x01, 0xd5, 0xd1, 0x81, 0x00, 0x00, 0x48, 0x95, 0x1f, 0x03, 0xb1, 0xd1, 0xd1, 0xfb,
+  0x80, 0x23, 0x00, 0xfb, 0x8a, 0x1f, 0x80, 0x51, 0x84, 0x96, 0x03, 0x88, 0xd1, 0xd1, 0x88, 0x81, 0x43, 0x01, 0x48, 0x88, 0x88, 0x20, 0x02, 0x48,
+  0xff, 0xfb, 0x80, 0x75, 0x82, 0x27, 0x04, 0xb1, 0xd1, 0xd5, 0xfb, 0xd5, 0x81, 0x00, 0x00, 0xd1, 0x87, 0x1f, 0x80, 0x1e, 0x80, 0x6f, 0x81, 0x00,
+  0x04, 0xb1, 0xb1, 0xb1, 0xd1, 0xfb, 0x81, 0x2c, 0x01, 0xd5, 0x48, 0x88, 0x60, 0x00, 0x48, 0x80, 0x1e, 0x00, 0x88, 0x80, 0x77, 0x00, 0xd1, 0x80,
+  0x35, 0x06, 0xb1, 0xfb, 0xff, 0xff, 0xd5, 0x88, 0xfb, 0x80, 0x02, 0x89, 0x1f, 0x00, 0x88, 0x80, 0x76, 0x80, 0x1d, 0x81, 0x56, 0x80, 0x1f, 0x01,
+  0xfb, 0xfb, 0x80, 0x4a, 0x82, 0x6f, 0x84, 0x1f, 0x00, 0xd5, 0x81, 0x76, 0x84, 0x00, 0x81, 0x20, 0x80, 0x21, 0x89, 0xbf, 0x01, 0x48, 0xd1, 0x80,
+  0xb1, 0x86, 0x00, 0x82, 0x20, 0x00, 0xff, 0x8c, 0xde, 0x84, 0x1f, 0x83, 0x06, 0x01, 0xfb, 0xff, 0x84, 0xed, 0x87, 0x20, 0x83, 0x5f, 0x85, 0x84,
+  0x8d, 0x1e, 0x02, 0x1c, 0x1c, 0x44, 0x81, 0x18, 0x02, 0xd1, 0xfb, 0xfb, 0x82, 0x27, 0x01, 0x48, 0x88, 0x8d, 0x1f, 0x02, 0x00, 0x44, 0xb1, 0x81,
+  0x1e, 0x01, 0x48, 0x44, 0x81, 0x27, 0x03, 0x48, 0x48, 0x88, 0x44, 0x8c, 0x1e, 0x05, 0x00, 0x44, 0xad, 0xd5, 0xd5, 0xb1, 0x80, 0x17, 0x00, 0x00,
+  0x80, 0x20, 0x81, 0x1f, 0x00, 0x00, 0x8c, 0x1f, 0x81, 0x40, 0x03, 0x44, 0x44, 0x88, 0xad, 0x80, 0x40, 0x00, 0xd1, 0x94, 0x1f, 0x81, 0x3c, 0x80,
+  0x00, 0x04, 0xd1, 0x88, 0x44, 0x44, 0xad, 0x90, 0x1f, 0x02, 0xfb, 0xff, 0x44, 0x80, 0x06, 0x83, 0x07, 0x00, 0x44, 0x8c, 0x1f, 0x82, 0x20, 0x80,
+  0x14, 0x82, 0x20, 0x82, 0x07, 0x8d, 0xdf, 0x82, 0x1a, 0x87, 0x00, 0x8d, 0x1e, 0x8a, 0x22, 0x8a, 0x15, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xa9,
+  0x00, 0x00, 0x48, 0x88, 0x05, 0x91, 0x1e, 0x00, 0xd5, 0x81, 0x1a, 0x01, 0x48, 0xb1, 0x94, 0x20, 0x07, 0x48, 0xd1, 0xfb, 0xd5, 0x48, 0x48, 0x48,
+  0xd1, 0x97, 0x1f, 0x01, 0xd5, 0xd1, 0x81, 0x00, 0x00, 0x48, 0x95, 0x1f, 0x03, 0xb1, 0xd1, 0xd1, 0xfb, 0x80, 0x23, 0x00, 0xfb, 0x93, 0x1f, 0x04,
+  0x48, 0x88, 0xd1, 0xd1, 0x88, 0x81, 0x43, 0x01, 0x48, 0x88, 0x92, 0x20, 0x80, 0x3e, 0x02, 0xd5, 0xfb, 0xd5, 0x81, 0x00, 0x00, 0xd1, 0x88, 0x1f,
+  0x85, 0x6c, 0x81, 0x97, 0x03, 0xd1, 0xfb, 0xff, 0xfb, 0x80, 0x21, 0x00, 0x48, 0x88, 0x60, 0x02, 0x48, 0xff, 0xff, 0x80, 0x0c, 0x81, 0xb5, 0x08,
+  0xd1, 0xd1, 0xb1, 0xfb, 0xff, 0xff, 0xd5, 0x88, 0xfb, 0x80, 0x02, 0x89, 0x1f, 0x80, 0x0c, 0x81, 0x59, 0x81, 0x56, 0x80, 0x1f, 0x01, 0xfb, 0xfb,
+  0x80, 0x2b, 0x00, 0xd5, 0x88, 0x1f, 0x80, 0x2e, 0x84, 0x1e, 0x83, 0x20, 0x80, 0x21, 0x89, 0xbf, 0x80, 0x1f, 0x01, 0xd1, 0x88, 0x84, 0x1e, 0x84,
+  0x20, 0x81, 0x70, 0x89, 0x20, 0x80, 0x97, 0x85, 0x1f, 0x82, 0x20, 0x8c, 0xdc, 0x02, 0x48, 0xfb, 0xb1, 0x83, 0x1a, 0x83, 0x83, 0x00, 0xd1, 0x85,
+  0xd0, 0x86, 0x00, 0x01, 0x44, 0xad, 0x82, 0x19, 0x00, 0xb1, 0x83, 0x27, 0x01, 0x48, 0x88, 0x8d, 0x1f, 0x01, 0x00, 0x44, 0x82, 0x60, 0x00, 0xb1,
+  0x80, 0x97, 0x80, 0x1e, 0x02, 0x48, 0x88, 0x44, 0x8c, 0x1e, 0x02, 0x00, 0x44, 0x88, 0x80, 0x20, 0x80, 0x57, 0x02, 0x48, 0x48, 0xd1, 0x82, 0x1f,
+  0x00, 0x00, 0x8c, 0x1f, 0x81, 0x20, 0x00, 0xb1, 0x80, 0x18, 0x80, 0x1f, 0x80, 0x25, 0x90, 0x1f, 0x0d, 0x00, 0x44, 0xad, 0xfb, 0xff, 0x48, 0x88,
+  0xb1, 0x48, 0xd1, 0x88, 0x44, 0x44, 0xad, 0x90, 0x1f, 0x01, 0x00, 0x44, 0x83, 0x00, 0x02, 0xfb, 0xff, 0x44, 0x80, 0x0a, 0x8b, 0x1f, 0x83, 0x20,
+  0x83, 0x00, 0x80, 0x22, 0x80, 0x05, 0x8c, 0xbf, 0x89, 0x20, 0x81, 0x00, 0x8d, 0x1e, 0x8a, 0x22, 0x8a, 0x15, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00,
+  0x89, 0x00, 0x00, 0x48, 0x88, 0x05, 0x91, 0x1e, 0x00, 0xd5, 0x81, 0x1a, 0x01, 0x48, 0xb1, 0x94, 0x20, 0x07, 0x48, 0xd1, 0xfb, 0xd5, 0x48, 0x48,
+  0x48, 0xd1, 0x97, 0x1f, 0x01, 0xd5, 0xd1, 0x81, 0x00, 0x00, 0x48, 0x95, 0x1f, 0x03, 0xb1, 0xd1, 0xd1, 0xfb, 0x80, 0x23, 0x00, 0xfb, 0x93, 0x1f,
+  0x04, 0x48, 0x88, 0xd1, 0xd1, 0x88, 0x81, 0x43, 0x01, 0x48, 0x88, 0x92, 0x20, 0x80, 0x3e, 0x02, 0xd5, 0xfb, 0xd5, 0x81, 0x00, 0x00, 0xd1, 0x95,
+  0x1f, 0x02, 0xfb, 0xff, 0xfb, 0x80, 0x21, 0x00, 0x48, 0x91, 0x60, 0x09, 0x48, 0x48, 0xb1, 0xb1, 0xfb, 0xff, 0xff, 0xd5, 0x88, 0xfb, 0x80, 0x02,
+  0x8f, 0x1f, 0x80, 0x77, 0x80, 0x98, 0x00, 0xff, 0x80, 0x3f, 0x80, 0xe1, 0x00, 0xd5, 0x8d, 0x1f, 0x80, 0x12, 0x82, 0x77, 0x80, 0x20, 0x80, 0x21,
+  0x8e, 0x3e, 0x81, 0x99, 0x86, 0x1f, 0x01, 0xff, 0xff, 0x89, 0x1e, 0x80, 0x4d, 0x80, 0x79, 0x83, 0x1e, 0x84, 0x20, 0x8a, 0x1e, 0x04, 0xfb, 0xd5,
+  0xb1, 0x88, 0x88, 0x85, 0x1e, 0x82, 0x20, 0x00, 0x48, 0x8b, 0x1f, 0x80, 0xcf, 0x84, 0x1f, 0x00, 0xd1, 0x81, 0x06, 0x01, 0xd1, 0xd1, 0x8a, 0x1f,
+  0x80, 0x20, 0x80, 0x50, 0x00, 0xb1, 0x84, 0x3b, 0x81, 0x20, 0x01, 0x48, 0x88, 0x8b, 0x9d, 0x00, 0x44, 0x80, 0x00, 0x85, 0x9e, 0x80, 0xc5, 0x03,
+  0x48, 0x48, 0x88, 0x44, 0x8b, 0xbc, 0x03, 0x00, 0x00, 0x44, 0x88, 0x83, 0x20, 0x02, 0xd1, 0x48, 0xd1, 0x82, 0x1f, 0x00, 0x00, 0x8c, 0x1f, 0x82,
+  0x20, 0x04, 0xd1, 0xd1, 0x88, 0x48, 0x48, 0x81, 0x7d, 0x90, 0x1f, 0x81, 0x20, 0x00, 0xb1, 0x80, 0x1e, 0x05, 0x48, 0xd1, 0x88, 0x44, 0x44, 0xad,
+  0x90, 0x1f, 0x00, 0x00, 0x80, 0x84, 0x01, 0xfb, 0xff, 0x82, 0x03, 0x80, 0x0a, 0x8b, 0x1f, 0x83, 0x20, 0x81, 0x21, 0x81, 0x1b, 0x00, 0x44, 0x80,
+  0x0a, 0x8b, 0x1e, 0x85, 0x20, 0x86, 0x00, 0x8d, 0x1e, 0x8a, 0x22, 0x8a, 0x15, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0x88, 0x00, 0x00, 0x48, 0x88,
+  0x05, 0x91, 0x1e, 0x00, 0xd5, 0x81, 0x1a, 0x01, 0x48, 0xb1, 0x94, 0x20, 0x07, 0x48, 0xd1, 0xfb, 0xd5, 0x48, 0x48, 0x48, 0xd1, 0x97, 0x1f, 0x01,
+  0xd5, 0xd1, 0x81, 0x00, 0x00, 0x48, 0x95, 0x1f, 0x03, 0xb1, 0xd1, 0xd1, 0xfb, 0x80, 0x23, 0x00, 0xfb, 0x93, 0x1f, 0x04, 0x48, 0x88, 0xd1, 0xd1,
+  0x88, 0x81, 0x43, 0x01, 0x48, 0x88, 0x92, 0x20, 0x80, 0x3e, 0x02, 0xd5, 0xfb, 0xd5, 0x81, 0x00, 0x00, 0xd1, 0x95, 0x1f, 0x02, 0xfb, 0xff, 0xfb,
+  0x80, 0x21, 0x00, 0x48, 0x93, 0x60, 0x07, 0x48, 0xb1, 0xfb, 0xff, 0xff, 0xd5, 0x88, 0xfb, 0x80, 0x02, 0x91, 0x1f, 0x00, 0x48, 0x80, 0x9c, 0x00,
+  0xff, 0x80, 0x3f, 0x80, 0xe1, 0x00, 0xd5, 0x90, 0x1f, 0x80, 0x98, 0x80, 0xb9, 0x00, 0xff, 0x81, 0x21, 0x91, 0x3e, 0x81, 0x1e, 0x84, 0x20, 0x00,
+  0xff, 0x96, 0x1e, 0x84, 0x20, 0x8f, 0x1f, 0x81, 0xda, 0x86, 0x20, 0x00, 0x48, 0x91, 0x1f, 0x82, 0x1b, 0x81, 0x24, 0x01, 0xd1, 0xd1, 0x8e, 0x1f,
+  0x02, 0x48, 0x48, 0x88, 0x84, 0x7d, 0x81, 0x06, 0x01, 0x48, 0x88, 0x8c, 0x1f, 0x02, 0x48, 0xb1, 0xb1, 0x83, 0x5e, 0x80, 0x1f, 0x01, 0xd1, 0xd5,
+  0x80, 0x2c, 0x00, 0x44, 0x8b, 0x1e, 0x03, 0xfb, 0xd5, 0x88, 0x88, 0x82, 0x5a, 0x00, 0xb1, 0x81, 0x47, 0x81, 0x1f, 0x00, 0x00, 0x8b, 0x1f, 0x80,
+  0xf0, 0x00, 0xb1, 0x81, 0x20, 0x02, 0xb1, 0x48, 0x48, 0x81, 0x7d, 0x8c, 0x1f, 0x0a, 0x1c, 0x44, 0xff, 0xff, 0x44, 0x44, 0xad, 0xd1, 0xd1, 0x88,
+  0x48, 0x80, 0x1f, 0x00, 0x88, 0x80, 0x0a, 0x8c, 0x1f, 0x07, 0x00, 0x44, 0x44, 0x00, 0x00, 0x44, 0xad, 0xd5, 0x81, 0x26, 0x80, 0x03, 0x81, 0x0e,
+  0x8b, 0xa0, 0x00, 0x00, 0x81, 0x00, 0x00, 0x44, 0x81, 0x00, 0x81, 0x05, 0x80, 0x0b, 0x8d, 0xfe, 0x82, 0x20, 0x87, 0x00, 0x8d, 0x1e, 0x8a, 0x22,
+  0x8a, 0x15, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0x88, 0x00, 0x00, 0x48, 0x88, 0x05, 0x91, 0x1e, 0x00, 0xd5, 0x81, 0x1a, 0x01, 0x48, 0xb1, 0x94,
+  0x20, 0x07, 0x48, 0xd1, 0xfb, 0xd5, 0x48, 0x48, 0x48, 0xd1, 0x97, 0x1f, 0x01, 0xd5, 0xd1, 0x81, 0x00, 0x00, 0x48, 0x95, 0x1f, 0x03, 0xb1, 0xd1,
+  0xd1, 0xfb, 0x80, 0x23, 0x00, 0xfb, 0x93, 0x1f, 0x0a, 0x48, 0x88, 0xd1, 0xd1, 0x88, 0x48, 0x48, 0xd5, 0xd1, 0x48, 0x88, 0x92, 0x20, 0x80, 0x3e,
+  0x02, 0xd5, 0xfb, 0xd5, 0x81, 0x00, 0x00, 0xd1, 0x95, 0x1f, 0x02, 0xfb, 0xff, 0xfb, 0x80, 0x21, 0x00, 0x48, 0x93, 0x60, 0x07, 0x48, 0xb1, 0xfb,
+  0xff, 0xff, 0xd5, 0x88, 0xfb, 0x80, 0x02, 0x91, 0x1f, 0x00, 0x48, 0x80, 0x9c, 0x00, 0xff, 0x80, 0x3f, 0x80, 0xe1, 0x00, 0xd5, 0x90, 0x1f, 0x80,
+  0xdc, 0x80, 0xb9, 0x00, 0xff, 0x80, 0x21, 0x00, 0xf2, 0x91, 0x3e, 0x81, 0x1e, 0x84, 0x20, 0x00, 0xff, 0x96, 0x1e, 0x84, 0x20, 0x8f, 0x1f, 0x81,
+  0xda, 0x86, 0x20, 0x00, 0x48, 0x91, 0x1f, 0x82, 0x1b, 0x81, 0x24, 0x01, 0xd1, 0xd1, 0x8e, 0x1f, 0x02, 0x48, 0x48, 0x88, 0x84, 0x7d, 0x81, 0x06,
+  0x01, 0x48, 0x88, 0x8c, 0x1f, 0x02, 0x48, 0xb1, 0xb1, 0x83, 0x5e, 0x80, 0x1f, 0x01, 0xd1, 0xd5, 0x80, 0x2c, 0x00, 0x44, 0x8b, 0x1e, 0x03, 0xfb,
+  0xd5, 0x88, 0x88, 0x82, 0x5a, 0x00, 0xb1, 0x81, 0x47, 0x81, 0x1f, 0x00, 0x00, 0x8b, 0x1f, 0x01, 0xfb, 0xfb, 0x80, 0x9f, 0x80, 0x20, 0x02, 0xb1,
+  0x48, 0x48, 0x81, 0x7d, 0x8c, 0x1f, 0x0a, 0x1c, 0x44, 0xff, 0xff, 0x44, 0x44, 0xad, 0xd1, 0xd1, 0x88, 0x48, 0x80, 0x1f, 0x00, 0x88, 0x80, 0x0a,
+  0x8c, 0x1f, 0x07, 0x00, 0x44, 0x44, 0x00, 0x00, 0x44, 0xad, 0xd5, 0x81, 0x26, 0x80, 0x03, 0x81, 0x0e, 0x8b, 0xa0, 0x00, 0x00, 0x81, 0x00, 0x00,
+  0x44, 0x81, 0x00, 0x81, 0x05, 0x80, 0x0b, 0x8d, 0xfe, 0x82, 0x20, 0x87, 0x00, 0x8d, 0x1e, 0x8a, 0x22, 0x8a, 0x15, 0x00, 0x1c, 0xff, 0x00, 0xff,
+  0x00, 0x88, 0x00, 0x00, 0x48, 0x88, 0x05, 0x91, 0x1e, 0x00, 0xd5, 0x81, 0x1a, 0x01, 0x48, 0xb1, 0x94, 0x20, 0x07, 0x48, 0xd1, 0xfb, 0xd5, 0x48,
+  0x48, 0x48, 0xd1, 0x97, 0x1f, 0x01, 0xd5, 0xd1, 0x81, 0x00, 0x00, 0x48, 0x95, 0x1f, 0x03, 0xb1, 0xd1, 0xd1, 0xfb, 0x80, 0x23, 0x00, 0xfb, 0x93,
+  0x1f, 0x0a, 0x48, 0x88, 0xd1, 0xd1, 0x88, 0x48, 0x48, 0xd5, 0xd1, 0x48, 0x88, 0x92, 0x20, 0x80, 0x3e, 0x02, 0xd5, 0xfb, 0xd5, 0x81, 0x00, 0x00,
+  0xd1, 0x95, 0x1f, 0x02, 0xfb, 0xff, 0xfb, 0x80, 0x21, 0x00, 0x48, 0x93, 0x60, 0x07, 0x48, 0xb1, 0xfb, 0xff, 0xff, 0xd5, 0x88, 0xfb, 0x80, 0x02,
+  0x91, 0x1f, 0x00, 0x48, 0x80, 0x9c, 0x00, 0xff, 0x80, 0x3f, 0x80, 0xe1, 0x00, 0xd5, 0x90, 0x1f, 0x80, 0xdc, 0x80, 0xb9, 0x00, 0xff, 0x80, 0x21,
+  0x00, 0xf2, 0x91, 0x3e, 0x81, 0x1e, 0x84, 0x20, 0x00, 0xf2, 0x96, 0x1e, 0x84, 0x20, 0x8f, 0x1f, 0x81, 0xda, 0x86, 0x20, 0x00, 0x48, 0x91, 0x1f,
+  0x82, 0x1b, 0x81, 0x24, 0x01, 0xd1, 0xd1, 0x8e, 0x1f, 0x02, 0x48, 0x48, 0x88, 0x84, 0x7d, 0x81, 0x06, 0x01, 0x48, 0x88, 0x8c, 0x1f, 0x02, 0x48,
+  0xb1, 0xb1, 0x83, 0x5e, 0x80, 0x1f, 0x01, 0xd1, 0xd5, 0x80, 0x2c, 0x00, 0x44, 0x8b, 0x1e, 0x80, 0x92, 0x00, 0x88, 0x82, 0x5a, 0x00, 0xb1, 0x81,
+  0x47, 0x81, 0x1f, 0x00, 0x00, 0x8a, 0x20, 0x00, 0x44, 0x80, 0xb1, 0x00, 0xb1, 0x81, 0x20, 0x02, 0xb1, 0x48, 0x48, 0x81, 0x7d, 0x8d, 0x1f, 0x01,
+  0x00, 0x44, 0x80, 0x00, 0x04, 0xad, 0xd1, 0xd1, 0x88, 0x48, 0x80, 0x1f, 0x00, 0x88, 0x80, 0x0a, 0x8d, 0x1f, 0x81, 0x00, 0x05, 0x44, 0xad, 0xd5,
+  0xff, 0xff, 0x44, 0x80, 0x4a, 0x00, 0x44, 0x80, 0x2e, 0x8b, 0x1f, 0x84, 0x20, 0x81, 0x00, 0x81, 0x05, 0x80, 0x0b, 0x8d, 0xfe, 0x82, 0x20, 0x87,
+  0x00, 0x8d, 0x1e, 0x8a, 0x22, 0x8a, 0x15, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0x87, 0x00, 0x00, 0x48, 0x88, 0x05, 0x91, 0x1e, 0x01, 0xd5, 0x48,
+  0x80, 0x1b, 0x01, 0x48, 0xb1, 0x95, 0x20, 0x02, 0x48, 0xfb, 0xd5, 0x80, 0x21, 0x80, 0x00, 0x95, 0x1f, 0x03, 0xb1, 0xd1, 0xd1, 0xfb, 0x80, 0x02,
+  0x98, 0x1f, 0x00, 0x88, 0x80, 0x43, 0x01, 0xd1, 0xd1, 0x93, 0x20, 0x01, 0x48, 0x88, 0x80, 0x3b, 0x80, 0x62, 0x00, 0xd5, 0x80, 0x87, 0x94, 0x3e,
+  0x07, 0xd5, 0xfb, 0xff, 0xfb, 0xfb, 0xff, 0xd5, 0xff, 0x95, 0x1f, 0x02, 0xfb, 0xff, 0xff, 0x97, 0xa1, 0x01, 0x48, 0xb1, 0x80, 0x1e, 0x04, 0xff,
+  0xff, 0xfb, 0x48, 0xf2, 0x93, 0x1e, 0x80, 0x7d, 0x81, 0x1f, 0x80, 0x61, 0x91, 0x1f, 0x03, 0x48, 0xd1, 0xd5, 0xd5, 0x83, 0x20, 0x92, 0x5d, 0x81,
+  0x1e, 0x86, 0x20, 0x95, 0x1e, 0x84, 0x20, 0x8f, 0x1f, 0x81, 0xda, 0x86, 0x20, 0x90, 0x5f, 0x01, 0x48, 0xb1, 0x82, 0x1b, 0x81, 0x24, 0x01, 0xd1,
+  0xd1, 0x8e, 0x1f, 0x02, 0x48, 0x48, 0x88, 0x84, 0x7d, 0x81, 0x06, 0x01, 0x48, 0x88, 0x8c, 0x1f, 0x02, 0x48, 0xb1, 0xb1, 0x83, 0x5e, 0x80, 0x1f,
+  0x01, 0xd1, 0xd5, 0x80, 0x2c, 0x00, 0x44, 0x8b, 0x1e, 0x80, 0x92, 0x00, 0x88, 0x82, 0x5a, 0x00, 0xb1, 0x81, 0x47, 0x81, 0x1f, 0x00, 0x00, 0x8a,
+  0x20, 0x00, 0x44, 0x80, 0xb1, 0x00, 0xb1, 0x81, 0x20, 0x02, 0xb1, 0x48, 0x48, 0x81, 0x7d, 0x8d, 0x1f, 0x01, 0x00, 0x44, 0x80, 0x00, 0x04, 0xad,
+  0xd1, 0xd1, 0x88, 0x48, 0x80, 0x1f, 0x00, 0x88, 0x80, 0x0a, 0x8d, 0x1f, 0x81, 0x00, 0x05, 0x44, 0xad, 0xd5, 0xff, 0xff, 0x44, 0x80, 0x4a, 0x00,
+  0x44, 0x80, 0x2e, 0x8b, 0x1f, 0x84, 0x20, 0x81, 0x00, 0x81, 0x05, 0x80, 0x0b, 0x8d, 0xfe, 0x82, 0x20, 0x87, 0x00, 0x8d, 0x1e, 0x8a, 0x22, 0x8a,
+  0x15, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xc5, 0x00, 0x00, 0x48, 0x88, 0x05, 0x91, 0x1e, 0x00, 0xd1, 0x81, 0x1a, 0x83, 0x05, 0x91, 0x1e, 0x08,
+  0xb1, 0xd5, 0xd1, 0x48, 0x48, 0x48, 0xd1, 0xd5, 0xb1, 0x93, 0x20, 0x80, 0x1f, 0x04, 0xd5, 0xd1, 0xb1, 0xd1, 0xd5, 0x96, 0x1f, 0x00, 0xd5, 0x80,
+  0x00, 0x80, 0x23, 0x01, 0xd5, 0xd5, 0x92, 0x1f, 0x80, 0x58, 0x85, 0x00, 0x92, 0x81, 0x80, 0x1f, 0x06, 0xfb, 0xfb, 0x88, 0xd5, 0x88, 0xfb, 0xfb,
+  0x95, 0x1f, 0x80, 0x9d, 0x00, 0xd1, 0x81, 0xa2, 0x80, 0x08, 0x92, 0x1f, 0x00, 0xff, 0x80, 0x39, 0x80, 0x01, 0x01, 0xfb, 0xff, 0x93, 0x1f, 0x0a,
+  0x48, 0xff, 0xff, 0xfb, 0xd1, 0x88, 0xd1, 0xfb, 0xff, 0xff, 0x48, 0x94, 0xa0, 0x04, 0xff, 0xfb, 0x88, 0x48, 0x88, 0x94, 0x3e, 0x0d, 0x1c, 0x00,
+  0x48, 0x88, 0xd1, 0xd5, 0xff, 0xff, 0xff, 0xd5, 0xd1, 0x88, 0x48, 0x00, 0x92, 0x1f, 0x01, 0xd1, 0xfb, 0x83, 0x00, 0x00, 0xd1, 0x91, 0x1f, 0x00,
+  0x00, 0x80, 0x3f, 0x00, 0xfb, 0x80, 0x7b, 0x00, 0xff, 0x80, 0xe4, 0x01, 0x48, 0x00, 0x8f, 0x20, 0x01, 0x00, 0x48, 0x80, 0xd8, 0x00, 0xfb, 0x80,
+  0x04, 0x80, 0x3e, 0x91, 0x1f, 0x00, 0x48, 0x80, 0x1b, 0x80, 0x1f, 0x00, 0x88, 0x96, 0x1f, 0x80, 0xd5, 0x9a, 0x1f, 0x80, 0x00, 0x01, 0x88, 0xd5,
+  0x80, 0x04, 0x01, 0xd5, 0x88, 0x92, 0x1f, 0x81, 0xa0, 0x02, 0xff, 0xff, 0x48, 0x83, 0x04, 0x92, 0xdf, 0x80, 0x20, 0x80, 0x19, 0x83, 0x04, 0x90,
+  0x1f, 0x81, 0x20, 0x85, 0x00, 0x91, 0x1e, 0x87, 0x21, 0x89, 0x12, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xa1, 0x00, 0x00, 0x48, 0x84,
+  0x00, 0x95, 0x1d, 0x00, 0xb1, 0x84, 0x00, 0x92, 0x21, 0x02, 0x48, 0xd1, 0xd1, 0x85, 0x1f, 0x90, 0x21, 0x03, 0x00, 0x24, 0xb1, 0xd1, 0x89, 0x20,
+  0x8c, 0x21, 0x04, 0x00, 0x24, 0xad, 0xd5, 0xd5, 0x80, 0x20, 0x82, 0x22, 0x80, 0x81, 0x83, 0x21, 0x86, 0x22, 0x04, 0x00, 0x00, 0x24, 0xd1, 0xd5,
+  0x81, 0x00, 0x81, 0x20, 0x80, 0x68, 0x81, 0x1f, 0x80, 0x06, 0x00, 0x24, 0x86, 0x1e, 0x85, 0x1f, 0x80, 0x20, 0x0c, 0x48, 0x48, 0xfb, 0xd5, 0x88,
+  0xd1, 0xb1, 0xd1, 0x88, 0xd5, 0xfb, 0x24, 0x00, 0x86, 0x3e, 0x85, 0x3f, 0x01, 0xd5, 0xd1, 0x80, 0x37, 0x80, 0x05, 0x81, 0x03, 0x00, 0xb1, 0x86,
+  0x1f, 0x03, 0x24, 0x88, 0x48, 0xb1, 0x81, 0x20, 0x81, 0x80, 0x84, 0x09, 0x81, 0x03, 0x00, 0x88, 0x84, 0x20, 0x81, 0x1f, 0x00, 0x88, 0x81, 0x16,
+  0x81, 0x9e, 0x00, 0x48, 0x84, 0x69, 0x81, 0x20, 0x86, 0x1f, 0x01, 0xd1, 0x88, 0x80, 0xb3, 0x83, 0xbf, 0x80, 0x1f, 0x01, 0xd1, 0xfb, 0x80, 0x1c,
+  0x00, 0xfb, 0x80, 0x07, 0x86, 0x1f, 0x00, 0xfb, 0x81, 0x98, 0x03, 0xb1, 0xfb, 0xfb, 0xfb, 0x80, 0x1f, 0x00, 0x88, 0x80, 0xa2, 0x81, 0x87, 0x00,
+  0x48, 0x86, 0x5f, 0x81, 0x20, 0x05, 0xff, 0xff, 0xff, 0x24, 0x24, 0x24, 0x82, 0x20, 0x80, 0x04, 0x00, 0x88, 0x80, 0xc2, 0x02, 0xfb, 0xfb, 0x48,
+  0x89, 0xc0, 0x01, 0x24, 0x24, 0x81, 0xe6, 0x00, 0x24, 0x80, 0xd9, 0x01, 0x48, 0xff, 0x81, 0x5b, 0x02, 0xfb, 0xff, 0x48, 0x86, 0xc0, 0x80, 0x20,
+  0x85, 0x00, 0x80, 0x21, 0x80, 0x5a, 0x80, 0xaf, 0x02, 0x24, 0x24, 0x88, 0x86, 0x5f, 0x8a, 0x22, 0x00, 0x24, 0x80, 0xc0, 0x82, 0x4d, 0x80, 0x03,
+  0x87, 0x1e, 0x8a, 0x42, 0x81, 0x6a, 0x80, 0x00, 0x88, 0x1d, 0x8e, 0x25, 0x90, 0x1b, 0x93, 0x00, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+  0xa2, 0x00, 0x00, 0x48, 0x82, 0x00, 0x97, 0x1d, 0x00, 0xb1, 0x82, 0x00, 0x93, 0x21, 0x03, 0x48, 0x48, 0xd1, 0xd1, 0x83, 0x1f, 0x81, 0x21, 0x8d,
+  0x22, 0x04, 0x00, 0x24, 0xb1, 0xb1, 0xd1, 0x87, 0x20, 0x8d, 0x44, 0x05, 0x00, 0x24, 0xad, 0xd5, 0xd5, 0xd5, 0x80, 0x20, 0x81, 0x21, 0x80, 0x3d,
+  0x8c, 0x44, 0x03, 0x00, 0x00, 0x24, 0xd1, 0x80, 0x1f, 0x82, 0x21, 0x00, 0xb1, 0x80, 0x67, 0x81, 0x1f, 0x80, 0x06, 0x00, 0x24, 0x86, 0x1e, 0x85,
+  0x1f, 0x80, 0x20, 0x0c, 0x48, 0x48, 0xfb, 0xd5, 0x88, 0xd1, 0xb1, 0xd1, 0x88, 0xd5, 0xfb, 0x24, 0x00, 0x86, 0x3e, 0x85, 0x3f, 0x01, 0xd5, 0xd1,
+  0x80, 0x37, 0x80, 0x05, 0x81, 0x03, 0x00, 0xb1, 0x86, 0x1f, 0x03, 0x24, 0x88, 0x48, 0xb1, 0x81, 0x20, 0x81, 0x80, 0x84, 0x09, 0x81, 0x03, 0x00,
+  0x88, 0x84, 0x20, 0x81, 0x1f, 0x00, 0x88, 0x81, 0x16, 0x81, 0x9e, 0x00, 0x48, 0x84, 0x69, 0x81, 0x20, 0x86, 0x1f, 0x01, 0xd1, 0x88, 0x80, 0xb3,
+  0x81, 0x3d, 0x81, 0x9e, 0x02, 0xd5, 0xd1, 0xfb, 0x80, 0x1c, 0x00, 0xfb, 0x80, 0x07, 0x86, 0x1f, 0x00, 0xfb, 0x81, 0x98, 0x03, 0xb1, 0xfb, 0xfb,
+  0xfb, 0x80, 0x1f, 0x00, 0x88, 0x80, 0xa2, 0x81, 0x87, 0x00, 0x48, 0x86, 0x5f, 0x81, 0x20, 0x05, 0xff, 0xff, 0xff, 0x24, 0x24, 0x24, 0x82, 0x20,
+  0x80, 0x04, 0x00, 0x88, 0x80, 0xc2, 0x02, 0xfb, 0xfb, 0x48, 0x89, 0xc0, 0x01, 0x24, 0x24, 0x81, 0xe6, 0x00, 0x24, 0x80, 0xd9, 0x01, 0x48, 0xff,
+  0x81, 0x5b, 0x02, 0xfb, 0xff, 0x48, 0x86, 0xc0, 0x80, 0x20, 0x85, 0x00, 0x80, 0x21, 0x80, 0x5a, 0x80, 0xaf, 0x02, 0x24, 0x24, 0x88, 0x86, 0x5f,
+  0x8a, 0x22, 0x00, 0x24, 0x80, 0xc0, 0x82, 0x4d, 0x80, 0x03, 0x87, 0x1e, 0x8a, 0x42, 0x81, 0x6a, 0x80, 0x00, 0x88, 0x1d, 0x8e, 0x25, 0x90, 0x1b,
+  0x93, 0x00, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xee, 0x00, 0x00, 0x1c, 0xff, 0x00,
+  0xff, 0x00, 0x88, 0x00, 0x00, 0x48, 0x88, 0x05, 0x91, 0x1e, 0x00, 0xd5, 0x81, 0x1a, 0x01, 0x48, 0xb1, 0x94, 0x20, 0x07, 0x48, 0xd1, 0xfb, 0xd5,
+  0x48, 0x48, 0x48, 0xd1, 0x97, 0x1f, 0x01, 0xd5, 0xd1, 0x81, 0x00, 0x00, 0x48, 0x95, 0x1f, 0x03, 0xb1, 0xd1, 0xd1, 0xfb, 0x80, 0x23, 0x00, 0xfb,
+  0x93, 0x1f, 0x04, 0x48, 0x88, 0xd1, 0xd1, 0x88, 0x81, 0x43, 0x01, 0x48, 0x88, 0x92, 0x20, 0x80, 0x3e, 0x02, 0xd5, 0xfb, 0xd5, 0x81, 0x00, 0x00,
+  0xd1, 0x95, 0x1f, 0x02, 0xfb, 0xff, 0xfb, 0x80, 0x21, 0x00, 0x48, 0x93, 0x60, 0x07, 0x48, 0xb1, 0xfb, 0xff, 0xff, 0xd5, 0x88, 0xfb, 0x80, 0x02,
+  0x91, 0x1f, 0x00, 0x48, 0x80, 0x9c, 0x00, 0xff, 0x80, 0x3f, 0x80, 0xe1, 0x00, 0xd5, 0x90, 0x1f, 0x80, 0x98, 0x80, 0xb9, 0x00, 0xff, 0x81, 0x21,
+  0x91, 0x3e, 0x81, 0x1e, 0x84, 0x20, 0x00, 0xff, 0x96, 0x1e, 0x84, 0x20, 0x8f, 0x1f, 0x81, 0xda, 0x86, 0x20, 0x00, 0x48, 0x91, 0x1f, 0x82, 0x1b,
+  0x81, 0x24, 0x01, 0xd1, 0xd1, 0x8e, 0x1f, 0x02, 0x48, 0x48, 0x88, 0x84, 0x7d, 0x81, 0x06, 0x01, 0x48, 0x88, 0x8c, 0x1f, 0x02, 0x48, 0xb1, 0xb1,
+  0x83, 0x5e, 0x80, 0x1f, 0x01, 0xd1, 0xd5, 0x80, 0x2c, 0x00, 0x44, 0x8b, 0x1e, 0x80, 0x92, 0x00, 0x88, 0x82, 0x5a, 0x00, 0xb1, 0x81, 0x47, 0x81,
+  0x1f, 0x00, 0x00, 0x8a, 0x20, 0x00, 0x24, 0x80, 0xb1, 0x00, 0xb1, 0x81, 0x20, 0x02, 0xb1, 0x48, 0x48, 0x81, 0x7d, 0x8d, 0x1f, 0x01, 0x00, 0x24,
+  0x80, 0x00, 0x04, 0xad, 0xd1, 0xd1, 0x88, 0x48, 0x80, 0x1f, 0x03, 0x88, 0x44, 0x44, 0xad, 0x8d, 0x1f, 0x81, 0x00, 0x05, 0x24, 0xad, 0xd5, 0xff,
+  0xff, 0x24, 0x80, 0x4a, 0x02, 0x44, 0x00, 0x44, 0x8c, 0x1f, 0x84, 0x20, 0x81, 0x00, 0x80, 0x05, 0x00, 0x44, 0x80, 0x0b, 0x8d, 0xfe, 0x82, 0x20,
+  0x87, 0x00, 0x8d, 0x1e, 0x8a, 0x22, 0x8a, 0x15, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xaa, 0x00, 0x02, 0x48, 0x48, 0x48, 0x81, 0x05, 0x8f, 0x12,
+  0x85, 0x0c, 0x05, 0xb1, 0xd5, 0x48, 0x1c, 0x48, 0x88, 0x89, 0x11, 0x02, 0xff, 0xff, 0xfb, 0x87, 0x0e, 0x01, 0x48, 0xfb, 0x80, 0x20, 0x01, 0x48,
+  0x88, 0x87, 0x20, 0x03, 0x48, 0xff, 0xfb, 0xd5, 0x80, 0x32, 0x86, 0x0e, 0x02, 0x88, 0xb1, 0xd1, 0x81, 0x00, 0x87, 0x1f, 0x01, 0xfb, 0xd5, 0x88,
+  0x0c, 0x01, 0x48, 0xb1, 0x80, 0x1e, 0x03, 0xfb, 0xd1, 0xd5, 0xd1, 0x86, 0x52, 0x03, 0x48, 0xfb, 0xd1, 0xb1, 0x80, 0x81, 0x83, 0x00, 0x82, 0x3b,
+  0x01, 0x88, 0x48, 0x80, 0x1f, 0x86, 0x82, 0x81, 0x1f, 0x03, 0x88, 0x88, 0xd1, 0xd5, 0x80, 0x00, 0x80, 0x1b, 0x81, 0x04, 0x81, 0x0a, 0x80, 0x07,
+  0x86, 0x40, 0x03, 0xd1, 0xd1, 0xb1, 0xb1, 0x83, 0x13, 0x82, 0x17, 0x02, 0xfb, 0xff, 0xfb, 0x81, 0x91, 0x87, 0xb3, 0x80, 0x57, 0x84, 0x33, 0x84,
+  0x1e, 0x00, 0xd1, 0x80, 0x20, 0x00, 0x88, 0x88, 0xd3, 0x80, 0x42, 0x89, 0x1f, 0x80, 0xee, 0x80, 0x00, 0x88, 0xd3, 0x89, 0x1f, 0x82, 0x20, 0x02,
+  0xff, 0x48, 0xf2, 0x8a, 0x3e, 0x83, 0x1f, 0x82, 0x9e, 0x83, 0x1f, 0x80, 0x21, 0x88, 0x1e, 0x81, 0xd0, 0x81, 0x18, 0x01, 0xfb, 0xfb, 0x82, 0xc0,
+  0x82, 0x5e, 0x87, 0x1e, 0x81, 0x9f, 0x00, 0xb1, 0x81, 0xf1, 0x03, 0x24, 0x24, 0x24, 0xad, 0x81, 0x28, 0x8b, 0x1d, 0x80, 0x1f, 0x82, 0x5a, 0x04,
+  0x48, 0x88, 0x24, 0x00, 0x00, 0x81, 0x20, 0x03, 0x48, 0x88, 0x88, 0x88, 0x8a, 0x3e, 0x04, 0xfb, 0xb1, 0xd1, 0xb1, 0xad, 0x80, 0x3c, 0x00, 0x00,
+  0x80, 0x00, 0x02, 0x24, 0xd1, 0xd5, 0x80, 0x09, 0x01, 0x88, 0xd1, 0x89, 0x7e, 0x00, 0xff, 0x80, 0x11, 0x82, 0x1c, 0x81, 0x1f, 0x01, 0xad, 0xd1,
+  0x81, 0x46, 0x01, 0x24, 0x24, 0x87, 0x1f, 0x01, 0x44, 0x44, 0x84, 0x1b, 0x84, 0x20, 0x81, 0x67, 0x01, 0x00, 0x00, 0x87, 0x1f, 0x89, 0x1d, 0x81,
+  0x20, 0x01, 0xfb, 0xff, 0x81, 0x20, 0x96, 0x1f, 0x01, 0x00, 0x44, 0x82, 0x50, 0x88, 0xa0, 0x8d, 0x20, 0x82, 0x00, 0x89, 0xe0, 0x9b, 0x1d, 0x8e,
+  0x22, 0x88, 0x16, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xc9, 0x00, 0x02, 0x48, 0x48, 0x48, 0x81, 0x04, 0x8d, 0x11, 0x87, 0x0d, 0x01, 0xb1, 0xd5,
+  0x80, 0x10, 0x00, 0x88, 0x87, 0x12, 0x02, 0x48, 0xff, 0xfb, 0x8a, 0x1f, 0x00, 0xfb, 0x81, 0x20, 0x00, 0x88, 0x87, 0x20, 0x8d, 0x1f, 0x02, 0x88,
+  0xb1, 0xd1, 0x82, 0x00, 0x85, 0x14, 0x02, 0x48, 0xff, 0xd5, 0x88, 0x4c, 0x01, 0x48, 0xb1, 0x81, 0x1e, 0x03, 0xfb, 0xd1, 0xd5, 0xd1, 0x85, 0x35,
+  0x03, 0x48, 0xfb, 0xd1, 0x88, 0x80, 0x71, 0x83, 0x00, 0x83, 0x3b, 0x01, 0x88, 0x48, 0x80, 0x1f, 0x85, 0x83, 0x80, 0x1f, 0x07, 0xb1, 0x88, 0x88,
+  0x88, 0xd1, 0xd5, 0xd5, 0xd5, 0x81, 0x1b, 0x81, 0x05, 0x80, 0x0a, 0x81, 0x0d, 0x85, 0x40, 0x01, 0xd5, 0xd1, 0x80, 0x54, 0x83, 0x13, 0x82, 0x24,
+  0x06, 0xfb, 0xff, 0xfb, 0xfb, 0xd5, 0xd5, 0x48, 0x86, 0x96, 0x00, 0x48, 0x80, 0x0c, 0x88, 0x1f, 0x80, 0x1e, 0x00, 0xd1, 0x80, 0x20, 0x00, 0x88,
+  0x87, 0xb6, 0x80, 0x78, 0x8a, 0x1f, 0x80, 0xd1, 0x80, 0x00, 0x88, 0xb6, 0x00, 0x1c, 0x83, 0x1f, 0x83, 0x79, 0x81, 0x20, 0x02, 0xff, 0x48, 0xf2,
+  0x8b, 0xf5, 0x84, 0x19, 0x82, 0xa5, 0x81, 0x1f, 0x80, 0x21, 0x88, 0x1e, 0x80, 0x1f, 0x83, 0x19, 0x84, 0x20, 0x81, 0x5e, 0x89, 0x1e, 0x02, 0x1c,
+  0x1c, 0x24, 0x81, 0xda, 0x02, 0xd1, 0x48, 0xfb, 0x81, 0xc8, 0x03, 0xd1, 0xd1, 0xad, 0x24, 0x8b, 0x1d, 0x0a, 0x00, 0x00, 0x00, 0x24, 0xad, 0xd1,
+  0xd1, 0xb1, 0x24, 0x24, 0x24, 0x81, 0x1f, 0x02, 0xb1, 0x24, 0x00, 0x8d, 0x1e, 0x80, 0x20, 0x00, 0xb1, 0x80, 0x36, 0x00, 0x00, 0x80, 0x47, 0x03,
+  0xd5, 0x48, 0x48, 0x24, 0x80, 0x0f, 0x8c, 0x1e, 0x80, 0x40, 0x80, 0x36, 0x80, 0x1f, 0x02, 0x88, 0x24, 0x24, 0x80, 0x27, 0x8f, 0x1f, 0x03, 0x00,
+  0x44, 0xfb, 0xff, 0x80, 0x3f, 0x82, 0x04, 0x92, 0x1f, 0x03, 0x00, 0x44, 0x44, 0x44, 0x80, 0x40, 0x81, 0x1b, 0x81, 0x00, 0x8d, 0x7f, 0x8d, 0x00,
+  0x8e, 0xa0, 0x96, 0x1d, 0x8e, 0x22, 0x88, 0x16, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xeb, 0x00, 0x01, 0x48, 0x48, 0x83, 0x03, 0x96, 0x1f, 0x04,
+  0xd1, 0x48, 0x1c, 0x48, 0x88, 0x96, 0x20, 0x06, 0x48, 0xfb, 0xb1, 0xd5, 0x48, 0x48, 0x88, 0x95, 0x20, 0x03, 0x48, 0x88, 0xb1, 0xd1, 0x82, 0x00,
+  0x84, 0x1f, 0x00, 0x48, 0x80, 0x00, 0x86, 0x78, 0x80, 0x00, 0x82, 0x1e, 0x04, 0xfb, 0xd1, 0xd5, 0xd1, 0xfb, 0x83, 0x16, 0x03, 0x48, 0xfb, 0xd1,
+  0xb1, 0x82, 0x18, 0x01, 0x48, 0x48, 0x81, 0x35, 0x00, 0xb1, 0x81, 0x1e, 0x01, 0x88, 0x48, 0x80, 0x1f, 0x84, 0x82, 0x02, 0x48, 0xfb, 0xd5, 0x80,
+  0x14, 0x00, 0x88, 0x82, 0x36, 0x00, 0xd5, 0x82, 0x00, 0x86, 0x07, 0x83, 0x1f, 0x00, 0xff, 0x80, 0x20, 0x80, 0x37, 0x84, 0x14, 0x81, 0x1e, 0x06,
+  0xfb, 0xff, 0xfb, 0xfb, 0xd5, 0xd5, 0x48, 0x85, 0x60, 0x03, 0x48, 0xff, 0xff, 0xfb, 0x80, 0x50, 0x86, 0x1f, 0x80, 0x1e, 0x00, 0xd1, 0x80, 0x20,
+  0x00, 0x88, 0x84, 0x1f, 0x83, 0x97, 0x83, 0x1f, 0x81, 0x5a, 0x80, 0x1f, 0x80, 0x2f, 0x80, 0x00, 0x00, 0xd5, 0x89, 0xe1, 0x83, 0x20, 0x00, 0xb1,
+  0x80, 0xb8, 0x82, 0x20, 0x02, 0xff, 0x48, 0xf2, 0x86, 0x3e, 0x82, 0x00, 0x01, 0x24, 0xad, 0x84, 0x7b, 0x81, 0xd9, 0x80, 0x1f, 0x80, 0x21, 0x89,
+  0x1e, 0x02, 0x1c, 0x00, 0x24, 0x82, 0xb6, 0x02, 0xd1, 0x48, 0xb1, 0x81, 0x40, 0x81, 0x5e, 0x8a, 0x1d, 0x80, 0x00, 0x80, 0x20, 0x82, 0xf5, 0x80,
+  0xec, 0x8b, 0x3a, 0x83, 0x1e, 0x80, 0x20, 0x03, 0xb1, 0xd1, 0xd1, 0x88, 0x81, 0x39, 0x01, 0x48, 0x24, 0x81, 0x12, 0x8d, 0x1e, 0x03, 0x00, 0x24,
+  0x24, 0x48, 0x80, 0x21, 0x04, 0xfb, 0xff, 0x48, 0xad, 0x24, 0x81, 0x0e, 0x8e, 0x1f, 0x03, 0x00, 0x24, 0x88, 0x24, 0x83, 0x00, 0x82, 0x0d, 0x90,
+  0x1f, 0x00, 0x24, 0x81, 0x02, 0x85, 0x00, 0x8e, 0x7f, 0x8c, 0x00, 0x8f, 0xa0, 0x95, 0x1d, 0x8e, 0x22, 0x88, 0x16, 0x00, 0x1c, 0xff, 0x00, 0xff,
+  0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xee, 0x00,
+};
+const PackedSheet packedDogs = {32, 32, 4, 9, packedDogsOffsets, packedDogsData, NULL};
+
+// smallDogsAlt.h: 32x32 frames, 4 across, 9 down; 8396 bytes, from 73728
+static const uint32_t packedDogsAltOffsets[] PROGMEM = {
+  0, 216, 414, 630, 831, 1119, 1376, 1662, 1933, 2143, 2362, 2572,
+  2798, 3076, 3345, 3623, 3878, 4089, 4301, 4515, 4730, 5015, 5285, 5543,
+  5799, 6061, 6323, 6604, 6807, 7067, 7324, 7342, 7604, 7873, 8134, 8378,
+  8396,
+};
+static const uint8_t packedDogsAltData[] PROGMEM = {
+  0x00, 0x1c, 0xff, 0x00, 0xa9, 0x00, 0x01, 0x20, 0x20, 0x9c, 0x1f, 0x00, 0xcc, 0x9b, 0x20, 0xbc, 0x1f, 0x02, 0x20, 0x20, 0x64, 0x99, 0x81, 0x05,
+  0x20, 0x44, 0x64, 0x64, 0x64, 0x44, 0x95, 0x20, 0x03, 0x20, 0x20, 0x20, 0x44, 0x81, 0x00, 0x80, 0x07, 0x95, 0x7b, 0x83, 0x1f, 0x94, 0x83, 0x03,
+  0x20, 0xf5, 0x64, 0x20, 0x80, 0x5f, 0x02, 0x20, 0x64, 0xf5, 0x95, 0x1f, 0x00, 0xcc, 0x82, 0x1f, 0x00, 0xcc, 0x96, 0x1f, 0x01, 0x64, 0xcc, 0x80,
+  0x7b, 0x00, 0xcc, 0x96, 0x3f, 0x80, 0x19, 0x02, 0xf5, 0xcc, 0xf5, 0x81, 0x25, 0x94, 0x1f, 0x81, 0x1d, 0x80, 0x03, 0x94, 0x1f, 0x80, 0x60, 0x00,
+  0x44, 0x80, 0x1f, 0x00, 0x44, 0x94, 0x5e, 0x01, 0x1c, 0x00, 0x86, 0x1f, 0x00, 0x00, 0x93, 0x3e, 0x80, 0x60, 0x81, 0x61, 0x80, 0xa4, 0x93, 0x3e,
+  0x06, 0x64, 0x64, 0xf5, 0xcc, 0xcc, 0xcc, 0xf5, 0x80, 0xe2, 0x91, 0x40, 0x80, 0x1f, 0x00, 0x20, 0x82, 0xdf, 0x80, 0x07, 0x90, 0x1f, 0x00, 0x00,
+  0x81, 0x1f, 0x80, 0x3a, 0x81, 0x02, 0x01, 0x20, 0x00, 0x8f, 0x20, 0x80, 0x1f, 0x81, 0x3d, 0x81, 0x00, 0x00, 0xcc, 0x97, 0x1f, 0x00, 0x00, 0x80,
+  0x06, 0x96, 0x1f, 0x80, 0xd8, 0x81, 0x00, 0x82, 0x07, 0x90, 0x9e, 0x00, 0xcc, 0x86, 0x1f, 0x80, 0x40, 0x90, 0xfe, 0x81, 0xf9, 0x81, 0x1e, 0x03,
+  0xcc, 0xf5, 0xf5, 0x20, 0x92, 0xdf, 0x80, 0x00, 0x82, 0x7f, 0x80, 0x06, 0x90, 0x1f, 0x80, 0x81, 0x86, 0x00, 0x91, 0x1e, 0x87, 0x21, 0x89, 0x12,
+  0x00, 0x1c, 0xff, 0x00, 0xc9, 0x00, 0x01, 0x20, 0x20, 0x9c, 0x1f, 0x00, 0xcc, 0x9b, 0x20, 0xbc, 0x1f, 0x02, 0x20, 0x20, 0x64, 0x99, 0x81, 0x05,
+  0x20, 0x44, 0x64, 0x64, 0x64, 0x44, 0x95, 0x20, 0x03, 0x20, 0x20, 0x20, 0x44, 0x81, 0x00, 0x80, 0x07, 0x95, 0x7b, 0x83, 0x1f, 0x94, 0x83, 0x03,
+  0x20, 0xf5, 0x64, 0x20, 0x80, 0x5f, 0x02, 0x20, 0x64, 0xf5, 0x95, 0x1f, 0x00, 0xcc, 0x82, 0x1f, 0x00, 0xcc, 0x96, 0x1f, 0x01, 0x64, 0xcc, 0x80,
+  0x7b, 0x00, 0xcc, 0x96, 0x3f, 0x80, 0x19, 0x02, 0xf5, 0xcc, 0xf5, 0x81, 0x25, 0x94, 0x1f, 0x81, 0x1d, 0x80, 0x03, 0x94, 0x1f, 0x80, 0x60, 0x00,
+  0x44, 0x80, 0x1f, 0x00, 0x44, 0x94, 0x5e, 0x01, 0x1c, 0x00, 0x86, 0x1f, 0x00, 0x00, 0x93, 0x3e, 0x80, 0x60, 0x81, 0x61, 0x80, 0xa4, 0x93, 0x3e,
+  0x06, 0x64, 0x64, 0xf5, 0xcc, 0xcc, 0xcc, 0xf5, 0x80, 0xe2, 0x90, 0x40, 0x00, 0x00, 0x80, 0x1f, 0x00, 0x20, 0x82, 0xdf, 0x80, 0x07, 0x00, 0x00,
+  0x8f, 0x20, 0x82, 0x1f, 0x80, 0x3a, 0x81, 0x02, 0x94, 0x1f, 0x81, 0x3d, 0x81, 0x00, 0x00, 0xcc, 0x96, 0x1f, 0x00, 0x00, 0x80, 0x00, 0x97, 0x1f,
+  0x00, 0x64, 0x82, 0x20, 0x00, 0x20, 0x80, 0xe3, 0x94, 0xa0, 0x00, 0x20, 0x86, 0x1f, 0x91, 0xdf, 0x85, 0x00, 0x81, 0x26, 0x90, 0x1f, 0x87, 0x20,
+  0x90, 0x7d, 0x8a, 0x21, 0x89, 0x12, 0x00, 0x1c, 0xff, 0x00, 0xa9, 0x00, 0x01, 0x20, 0x20, 0x9c, 0x1f, 0x00, 0xcc, 0x9b, 0x20, 0xbc, 0x1f, 0x02,
+  0x20, 0x20, 0x64, 0x99, 0x81, 0x05, 0x20, 0x44, 0x64, 0x64, 0x64, 0x44, 0x95, 0x20, 0x03, 0x20, 0x20, 0x20, 0x44, 0x81, 0x00, 0x80, 0x07, 0x95,
+  0x7b, 0x83, 0x1f, 0x94, 0x83, 0x03, 0x20, 0xf5, 0x64, 0x20, 0x80, 0x5f, 0x02, 0x20, 0x64, 0xf5, 0x95, 0x1f, 0x00, 0xcc, 0x82, 0x1f, 0x00, 0xcc,
+  0x96, 0x1f, 0x01, 0x64, 0xcc, 0x80, 0x7b, 0x00, 0xcc, 0x96, 0x3f, 0x80, 0x19, 0x02, 0xf5, 0xcc, 0xf5, 0x81, 0x25, 0x94, 0x1f, 0x81, 0x1d, 0x80,
+  0x03, 0x94, 0x1f, 0x80, 0x60, 0x00, 0x44, 0x80, 0x1f, 0x00, 0x44, 0x94, 0x5e, 0x01, 0x1c, 0x00, 0x86, 0x1f, 0x00, 0x00, 0x93, 0x3e, 0x80, 0x60,
+  0x81, 0x61, 0x80, 0xa4, 0x93, 0x3e, 0x06, 0x64, 0x64, 0xf5, 0xcc, 0xcc, 0xcc, 0xf5, 0x80, 0xe2, 0x91, 0x40, 0x80, 0x1f, 0x00, 0x20, 0x82, 0xdf,
+  0x80, 0x07, 0x90, 0x1f, 0x00, 0x00, 0x81, 0x1f, 0x80, 0x3a, 0x81, 0x02, 0x01, 0x20, 0x00, 0x8f, 0x20, 0x80, 0x1f, 0x81, 0x3d, 0x81, 0x00, 0x00,
+  0xcc, 0x97, 0x1f, 0x00, 0x00, 0x80, 0x06, 0x96, 0x1f, 0x80, 0xd8, 0x81, 0x00, 0x82, 0x07, 0x90, 0x9e, 0x00, 0xcc, 0x86, 0x1f, 0x80, 0x40, 0x90,
+  0xfe, 0x81, 0xf9, 0x81, 0x1e, 0x03, 0xcc, 0xf5, 0xf5, 0x20, 0x92, 0xdf, 0x80, 0x00, 0x82, 0x7f, 0x80, 0x06, 0x90, 0x1f, 0x80, 0x81, 0x86, 0x00,
+  0x91, 0x1e, 0x87, 0x21, 0x89, 0x12, 0x00, 0x1c, 0xff, 0x00, 0xc9, 0x00, 0x01, 0x20, 0x20, 0x9c, 0x1f, 0x00, 0xcc, 0x9b, 0x20, 0xbc, 0x1f, 0x02,
+  0x20, 0x20, 0x64, 0x99, 0x81, 0x05, 0x20, 0x44, 0x64, 0x64, 0x64, 0x44, 0x95, 0x20, 0x03, 0x20, 0x20, 0x20, 0x44, 0x81, 0x00, 0x80, 0x07, 0x95,
+  0x7b, 0x83, 0x1f, 0x94, 0x83, 0x03, 0x20, 0xf5, 0x64, 0x20, 0x80, 0x5f, 0x02, 0x20, 0x64, 0xf5, 0x95, 0x1f, 0x00, 0xcc, 0x82, 0x1f, 0x00, 0xcc,
+  0x96, 0x1f, 0x01, 0x64, 0xcc, 0x80, 0x7b, 0x00, 0xcc, 0x96, 0x3f, 0x80, 0x19, 0x02, 0xf5, 0xcc, 0xf5, 0x81, 0x25, 0x94, 0x1f, 0x81, 0x1d, 0x80,
+  0x03, 0x94, 0x1f, 0x80, 0x60, 0x00, 0x44, 0x80, 0x1f, 0x00, 0x44, 0x94, 0x5e, 0x01, 0x1c, 0x00, 0x86, 0x1f, 0x00, 0x00, 0x93, 0x3e, 0x80, 0x60,
+  0x81, 0x61, 0x80, 0xa4, 0x93, 0x3e, 0x06, 0x64, 0x64, 0xf5, 0xcc, 0xcc, 0xcc, 0xf5, 0x80, 0xe2, 0x90, 0x40, 0x00, 0x00, 0x80, 0x1f, 0x00, 0x20,
+  0x82, 0xdf, 0x80, 0x07, 0x00, 0x00, 0x8f, 0x20, 0x82, 0x1f, 0x80, 0x3a, 0x81, 0x02, 0x94, 0x1f, 0x81, 0x3d, 0x81, 0x00, 0x00, 0xcc, 0x97, 0x1f,
+  0x00, 0x00, 0x80, 0x00, 0x94, 0x1f, 0x00, 0x20, 0x80, 0xdb, 0x81, 0x1f, 0x01, 0x20, 0xcc, 0x92, 0x5f, 0x00, 0x1c, 0x86, 0x1f, 0x81, 0x45, 0x92,
+  0xdf, 0x83, 0x5e, 0x82, 0x00, 0x90, 0x1f, 0x80, 0x81, 0x9a, 0x1e, 0x87, 0x21, 0x89, 0x12, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0x91, 0x00, 0x01,
+  0x20, 0x20, 0x9a, 0x17, 0x01, 0x20, 0xcc, 0x95, 0x1f, 0x83, 0x18, 0x01, 0x20, 0xf5, 0x89, 0x1f, 0x00, 0x20, 0x87, 0x4d, 0x01, 0x20, 0xf5, 0x81,
+  0x20, 0x01, 0x20, 0x64, 0x89, 0x1f, 0x01, 0x20, 0xcc, 0x87, 0x4d, 0x02, 0x20, 0xf5, 0x64, 0x80, 0x0c, 0x01, 0x20, 0xcc, 0x88, 0x1f, 0x8a, 0x2c,
+  0x80, 0x1f, 0x01, 0xf5, 0x64, 0x80, 0x11, 0x88, 0x7f, 0x01, 0x20, 0xf5, 0x8a, 0x1f, 0x01, 0xcc, 0xf5, 0x81, 0x00, 0x91, 0x1f, 0x80, 0x86, 0x00,
+  0x20, 0x80, 0x59, 0x81, 0x21, 0x8a, 0x5f, 0x00, 0xcc, 0x80, 0x51, 0x81, 0x00, 0x02, 0x44, 0x44, 0x44, 0x81, 0x5a, 0x01, 0xf5, 0x44, 0x81, 0x02,
+  0x89, 0x7f, 0x02, 0xcc, 0xcc, 0x64, 0x80, 0x1b, 0x81, 0x00, 0x01, 0x64, 0xcc, 0x85, 0x1f, 0x89, 0x60, 0x87, 0x20, 0x80, 0x1f, 0x83, 0x7f, 0x8b,
+  0x81, 0x80, 0x16, 0x85, 0x1f, 0x00, 0xcc, 0x82, 0x1f, 0x02, 0xcc, 0x64, 0x64, 0x81, 0xe7, 0x87, 0x20, 0x00, 0x64, 0x82, 0x20, 0x80, 0x14, 0x82,
+  0x40, 0x00, 0xcc, 0x81, 0x90, 0x00, 0x64, 0x8b, 0x61, 0x81, 0x32, 0x82, 0x06, 0x80, 0x18, 0x80, 0x09, 0x89, 0x1e, 0x81, 0xc2, 0x00, 0xf5, 0x82,
+  0x20, 0x80, 0x1f, 0x84, 0x3b, 0x80, 0x05, 0x88, 0x1f, 0x81, 0x8e, 0x83, 0xfe, 0x81, 0x61, 0x01, 0x20, 0x1c, 0x81, 0x0a, 0x87, 0x1e, 0x80, 0x1f,
+  0x82, 0x56, 0x02, 0x00, 0x00, 0x20, 0x81, 0x26, 0x89, 0x59, 0x85, 0x1f, 0x00, 0x64, 0x80, 0x19, 0x00, 0x00, 0x80, 0x1f, 0x01, 0xf5, 0x20, 0x81,
+  0x23, 0x8d, 0x1e, 0x80, 0xcb, 0x80, 0x59, 0x81, 0x3f, 0x81, 0x1f, 0x00, 0xf5, 0x8a, 0x5b, 0x82, 0x9e, 0x80, 0x15, 0x80, 0x00, 0x82, 0x1f, 0x80,
+  0x29, 0x00, 0xf5, 0x8d, 0x1f, 0x00, 0xf5, 0x80, 0x36, 0x82, 0x00, 0x81, 0x1b, 0x80, 0x2a, 0x00, 0x00, 0x8c, 0x1f, 0x82, 0x3b, 0x83, 0x20, 0x81,
+  0x08, 0x8d, 0x9e, 0x00, 0x1c, 0x84, 0x1c, 0x84, 0x00, 0x8e, 0x1e, 0x8a, 0x24, 0x8a, 0x13, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xb1, 0x00, 0x01,
+  0x20, 0x20, 0x9a, 0x17, 0x01, 0x20, 0xcc, 0x95, 0x1f, 0x83, 0x18, 0x01, 0x20, 0xf5, 0x89, 0x1f, 0x00, 0x20, 0x87, 0x4d, 0x01, 0x20, 0xf5, 0x81,
+  0x20, 0x01, 0x20, 0x64, 0x89, 0x1f, 0x01, 0x20, 0xcc, 0x87, 0x4d, 0x02, 0x20, 0xf5, 0x64, 0x80, 0x0c, 0x01, 0x20, 0xcc, 0x88, 0x1f, 0x8a, 0x2c,
+  0x80, 0x1f, 0x01, 0xf5, 0x64, 0x80, 0x11, 0x88, 0x7f, 0x01, 0x20, 0xf5, 0x8a, 0x1f, 0x01, 0xcc, 0xf5, 0x81, 0x00, 0x91, 0x1f, 0x80, 0x86, 0x00,
+  0x20, 0x80, 0x59, 0x81, 0x21, 0x8a, 0x5f, 0x00, 0xcc, 0x80, 0x51, 0x81, 0x00, 0x02, 0x44, 0x44, 0x44, 0x81, 0x5a, 0x01, 0xf5, 0x44, 0x81, 0x02,
+  0x89, 0x7f, 0x02, 0xcc, 0xcc, 0x64, 0x80, 0x1b, 0x81, 0x00, 0x01, 0x64, 0xcc, 0x85, 0x1f, 0x89, 0x60, 0x87, 0x20, 0x80, 0x1f, 0x83, 0x7f, 0x8b,
+  0x81, 0x80, 0x16, 0x82, 0x20, 0x00, 0x64, 0x80, 0x29, 0x82, 0x1f, 0x80, 0x0f, 0x81, 0xe7, 0x87, 0x20, 0x87, 0x1f, 0x81, 0x40, 0x00, 0xcc, 0x81,
+  0x90, 0x00, 0x64, 0x8b, 0x61, 0x81, 0x32, 0x82, 0x06, 0x80, 0x18, 0x80, 0x09, 0x8a, 0x1e, 0x82, 0xd5, 0x82, 0x53, 0x82, 0x20, 0x81, 0x3b, 0x80,
+  0x05, 0x88, 0x3d, 0x81, 0x8e, 0x82, 0x00, 0x81, 0x89, 0x80, 0x39, 0x81, 0x0a, 0x87, 0xff, 0x82, 0x1b, 0x00, 0x00, 0x80, 0x55, 0x80, 0x06, 0x01,
+  0xcc, 0xf5, 0x80, 0x0a, 0x86, 0x59, 0x83, 0x1f, 0x01, 0x20, 0x00, 0x82, 0x00, 0x81, 0x20, 0x00, 0x00, 0x82, 0x20, 0x87, 0x7a, 0x82, 0x7d, 0x83,
+  0x1e, 0x80, 0x20, 0x81, 0x09, 0x81, 0x8b, 0x8a, 0x1f, 0x01, 0x1c, 0x1c, 0x85, 0x1f, 0x84, 0x25, 0x80, 0x41, 0x99, 0x1f, 0x81, 0x46, 0x8b, 0x1f,
+  0x8c, 0x20, 0x8c, 0x1c, 0x8c, 0x24, 0x8a, 0x13, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0x91, 0x00, 0x01, 0x20, 0x20, 0x9a, 0x17, 0x01, 0x20, 0xcc,
+  0x95, 0x1f, 0x83, 0x18, 0x01, 0x20, 0xf5, 0x89, 0x1f, 0x00, 0x20, 0x87, 0x4d, 0x01, 0x20, 0xf5, 0x81, 0x20, 0x01, 0x20, 0x64, 0x89, 0x1f, 0x01,
+  0x20, 0xcc, 0x87, 0x4d, 0x02, 0x20, 0xf5, 0x64, 0x80, 0x0c, 0x01, 0x20, 0xcc, 0x88, 0x1f, 0x8a, 0x2c, 0x80, 0x1f, 0x01, 0xf5, 0x64, 0x80, 0x11,
+  0x88, 0x7f, 0x01, 0x20, 0xf5, 0x8a, 0x1f, 0x01, 0xcc, 0xf5, 0x81, 0x00, 0x91, 0x1f, 0x81, 0x86, 0x80, 0x59, 0x81, 0x21, 0x8a, 0x5f, 0x00, 0xcc,
+  0x80, 0x51, 0x81, 0x00, 0x03, 0x44, 0x44, 0x44, 0x20, 0x80, 0x5a, 0x01, 0xf5, 0x44, 0x81, 0x02, 0x89, 0x7f, 0x02, 0xcc, 0xcc, 0x64, 0x80, 0x1b,
+  0x81, 0x00, 0x01, 0x64, 0xcc, 0x85, 0x1f, 0x89, 0x60, 0x87, 0x20, 0x80, 0x1f, 0x83, 0x7f, 0x8b, 0x81, 0x80, 0x16, 0x85, 0x1f, 0x00, 0xcc, 0x82,
+  0x1f, 0x02, 0xcc, 0x64, 0x64, 0x81, 0xe7, 0x87, 0x20, 0x00, 0x64, 0x82, 0x20, 0x80, 0x14, 0x82, 0x40, 0x00, 0xcc, 0x81, 0x90, 0x00, 0x64, 0x8b,
+  0x61, 0x81, 0x32, 0x82, 0x06, 0x80, 0x18, 0x80, 0x09, 0x89, 0x1e, 0x83, 0xd5, 0x82, 0x53, 0x82, 0x20, 0x81, 0x3b, 0x80, 0x05, 0x88, 0x1f, 0x81,
+  0x8e, 0x82, 0x00, 0x80, 0x5e, 0x80, 0x20, 0x00, 0x1c, 0x81, 0x0a, 0x87, 0x1e, 0x80, 0x1f, 0x82, 0x56, 0x02, 0x00, 0x00, 0x20, 0x81, 0x26, 0x89,
+  0x59, 0x85, 0x1f, 0x00, 0x64, 0x80, 0x19, 0x00, 0x00, 0x80, 0x1f, 0x01, 0xf5, 0x20, 0x81, 0x23, 0x8d, 0x1e, 0x80, 0xcb, 0x80, 0x59, 0x81, 0x3f,
+  0x81, 0x1f, 0x00, 0xf5, 0x8a, 0x5b, 0x82, 0x9e, 0x80, 0x15, 0x80, 0x00, 0x82, 0x1f, 0x80, 0x29, 0x00, 0xf5, 0x8d, 0x1f, 0x00, 0xf5, 0x80, 0x36,
+  0x82, 0x00, 0x81, 0x1b, 0x80, 0x2a, 0x00, 0x00, 0x8c, 0x1f, 0x82, 0x3b, 0x83, 0x20, 0x81, 0x08, 0x8d, 0x9e, 0x00, 0x1c, 0x84, 0x1c, 0x84, 0x00,
+  0x8e, 0x1e, 0x8a, 0x24, 0x8a, 0x13, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xb1, 0x00, 0x01, 0x20, 0x20, 0x9a, 0x17, 0x01, 0x20, 0xcc, 0x95, 0x1f,
+  0x83, 0x18, 0x01, 0x20, 0xf5, 0x89, 0x1f, 0x00, 0x20, 0x87, 0x4d, 0x01, 0x20, 0xf5, 0x81, 0x20, 0x01, 0x20, 0x64, 0x89, 0x1f, 0x01, 0x20, 0xcc,
+  0x87, 0x4d, 0x02, 0x20, 0xf5, 0x64, 0x80, 0x0c, 0x01, 0x20, 0xcc, 0x88, 0x1f, 0x8a, 0x2c, 0x80, 0x1f, 0x01, 0xf5, 0x64, 0x80, 0x11, 0x88, 0x7f,
+  0x01, 0x20, 0xf5, 0x8a, 0x1f, 0x01, 0xcc, 0xf5, 0x81, 0x00, 0x91, 0x1f, 0x80, 0x86, 0x00, 0x20, 0x80, 0x59, 0x81, 0x21, 0x8a, 0x5f, 0x00, 0xcc,
+  0x80, 0x51, 0x81, 0x00, 0x02, 0x44, 0x44, 0x44, 0x81, 0x5a, 0x01, 0xf5, 0x44, 0x81, 0x02, 0x89, 0x7f, 0x02, 0xcc, 0xcc, 0x64, 0x80, 0x1b, 0x81,
+  0x00, 0x01, 0x64, 0xcc, 0x85, 0x1f, 0x89, 0x60, 0x87, 0x20, 0x80, 0x1f, 0x83, 0x7f, 0x8b, 0x81, 0x80, 0x16, 0x85, 0x1f, 0x00, 0xcc, 0x82, 0x1f,
+  0x02, 0xcc, 0x64, 0x64, 0x81, 0xe7, 0x87, 0x20, 0x00, 0x64, 0x82, 0x20, 0x80, 0x14, 0x82, 0x40, 0x00, 0xcc, 0x81, 0x90, 0x00, 0x64, 0x8b, 0x61,
+  0x81, 0x32, 0x82, 0x06, 0x80, 0x18, 0x80, 0x09, 0x89, 0x1e, 0x81, 0xc2, 0x00, 0xf5, 0x82, 0x20, 0x80, 0x1f, 0x00, 0xcc, 0x81, 0xca, 0x81, 0x1e,
+  0x8b, 0x1f, 0x82, 0x16, 0x00, 0x20, 0x80, 0x5d, 0x82, 0x39, 0x81, 0x0b, 0x87, 0x1e, 0x02, 0x00, 0x00, 0x20, 0x81, 0x57, 0x00, 0x20, 0x80, 0x06,
+  0x82, 0x78, 0x89, 0x5a, 0x83, 0x1f, 0x00, 0x00, 0x80, 0x81, 0x00, 0x20, 0x81, 0x26, 0x80, 0x04, 0x83, 0x25, 0x8c, 0x1f, 0x83, 0x1a, 0x01, 0x20,
+  0xf5, 0x81, 0x1f, 0x82, 0x20, 0x8e, 0x1f, 0x00, 0xf5, 0x80, 0x1b, 0x80, 0x87, 0x83, 0x20, 0x8b, 0x60, 0x83, 0x12, 0x80, 0x7f, 0x81, 0x05, 0x80,
+  0x0b, 0x8b, 0x7d, 0x84, 0x20, 0x87, 0x00, 0x8e, 0x1e, 0x8a, 0x22, 0x8a, 0x15, 0x00, 0x1c, 0xff, 0x00, 0x85, 0x00, 0x01, 0x20, 0x20, 0x8d, 0x08,
+  0x8c, 0x1f, 0x00, 0xcc, 0x83, 0x17, 0x85, 0x07, 0x8f, 0x1f, 0x00, 0x64, 0x81, 0x18, 0x01, 0x20, 0x64, 0x96, 0x1f, 0x82, 0x18, 0x84, 0x06, 0x92,
+  0x1f, 0x02, 0xcc, 0x20, 0x20, 0x82, 0x05, 0x95, 0x1f, 0x01, 0xf5, 0xf5, 0x81, 0x02, 0x95, 0x1f, 0x01, 0x64, 0xf5, 0x83, 0x00, 0x82, 0x86, 0x91,
+  0x20, 0x84, 0x1f, 0x94, 0x1e, 0x80, 0x60, 0x80, 0x5b, 0x80, 0x03, 0x95, 0x1f, 0x81, 0xda, 0x00, 0xcc, 0x83, 0xe4, 0x95, 0x40, 0x81, 0x00, 0x99,
+  0x3e, 0x00, 0x64, 0x80, 0xdf, 0x96, 0x40, 0x81, 0x1a, 0x00, 0xcc, 0x80, 0x24, 0x96, 0x1f, 0x05, 0x64, 0x44, 0x20, 0xf5, 0x20, 0x44, 0x96, 0xde,
+  0x01, 0x20, 0x44, 0x82, 0x1f, 0x01, 0x44, 0x20, 0x93, 0x20, 0x82, 0x1f, 0x00, 0xcc, 0x9a, 0x1f, 0x01, 0x64, 0x20, 0x80, 0x01, 0x94, 0x1f, 0x05,
+  0x00, 0x00, 0x20, 0x64, 0x64, 0x44, 0x80, 0x01, 0x03, 0x64, 0x20, 0x00, 0x00, 0x95, 0x1f, 0x82, 0x00, 0x92, 0x1f, 0x00, 0x00, 0x80, 0x1f, 0x81,
+  0xfe, 0x81, 0xdf, 0x80, 0x0b, 0x93, 0x1f, 0x04, 0x40, 0x20, 0x00, 0x20, 0x40, 0x98, 0x1f, 0x81, 0x19, 0x83, 0x05, 0xb0, 0x1f, 0x01, 0x20, 0xf5,
+  0x84, 0x1f, 0x00, 0xf5, 0x93, 0xa0, 0x01, 0x20, 0xf5, 0x81, 0x18, 0x83, 0x06, 0x93, 0xdf, 0x81, 0x1e, 0x83, 0x06, 0x90, 0x1f, 0x81, 0x81, 0x85,
+  0x00, 0x91, 0x1e, 0x87, 0x21, 0x89, 0x12, 0x00, 0x1c, 0xff, 0x00, 0xa5, 0x00, 0x01, 0x20, 0x20, 0x8d, 0x08, 0x8c, 0x1f, 0x00, 0xcc, 0x83, 0x17,
+  0x85, 0x07, 0x8f, 0x1f, 0x00, 0x64, 0x81, 0x18, 0x01, 0x20, 0x64, 0x96, 0x1f, 0x82, 0x18, 0x84, 0x06, 0x92, 0x1f, 0x02, 0xcc, 0x20, 0x20, 0x82,
+  0x05, 0x95, 0x1f, 0x01, 0xf5, 0xf5, 0x81, 0x02, 0x95, 0x1f, 0x01, 0x64, 0xf5, 0x83, 0x00, 0x82, 0x86, 0x91, 0x20, 0x84, 0x1f, 0x94, 0x1e, 0x80,
+  0x60, 0x80, 0x5b, 0x80, 0x03, 0x95, 0x1f, 0x81, 0xda, 0x00, 0xcc, 0x83, 0xe4, 0x95, 0x40, 0x81, 0x00, 0x99, 0x3e, 0x00, 0x64, 0x80, 0xdf, 0x96,
+  0x9e, 0x81, 0x1a, 0x00, 0xcc, 0x80, 0x24, 0x96, 0x1f, 0x05, 0x64, 0x44, 0x20, 0xf5, 0x20, 0x44, 0x97, 0x3f, 0x00, 0x44, 0x82, 0x1f, 0x00, 0x44,
+  0x94, 0x1f, 0x00, 0x00, 0x81, 0x1a, 0x00, 0xcc, 0x81, 0x04, 0x92, 0x20, 0x00, 0x00, 0x80, 0x1f, 0x01, 0x64, 0x20, 0x80, 0x01, 0x80, 0x1f, 0x00,
+  0x00, 0x93, 0x1f, 0x02, 0x64, 0x64, 0x44, 0x80, 0x01, 0x80, 0xc3, 0x90, 0x1f, 0x00, 0x00, 0x80, 0x1f, 0x01, 0xcc, 0x64, 0x81, 0x00, 0x01, 0xcc,
+  0x20, 0x80, 0x0b, 0x94, 0x1f, 0x00, 0x20, 0x80, 0xc4, 0x97, 0x1f, 0x06, 0xf5, 0x40, 0x20, 0x00, 0x20, 0x40, 0xcc, 0x80, 0x5f, 0x94, 0x1f, 0x81,
+  0x39, 0x83, 0x40, 0x91, 0x9e, 0x01, 0xf5, 0xf5, 0x81, 0x20, 0x80, 0x62, 0x91, 0x5f, 0x80, 0xfe, 0x83, 0x1f, 0x82, 0x00, 0x93, 0xdf, 0x82, 0x39,
+  0x95, 0x1f, 0x81, 0x81, 0x99, 0x1e, 0x87, 0x21, 0x89, 0x12, 0x00, 0x1c, 0xff, 0x00, 0x85, 0x00, 0x01, 0x20, 0x20, 0x8d, 0x08, 0x8c, 0x1f, 0x00,
+  0xcc, 0x83, 0x17, 0x85, 0x07, 0x8f, 0x1f, 0x00, 0x64, 0x81, 0x18, 0x01, 0x20, 0x64, 0x96, 0x1f, 0x82, 0x18, 0x84, 0x06, 0x92, 0x1f, 0x02, 0xcc,
+  0x20, 0x20, 0x82, 0x05, 0x95, 0x1f, 0x01, 0xf5, 0xf5, 0x81, 0x02, 0x95, 0x1f, 0x01, 0x64, 0xf5, 0x83, 0x00, 0x82, 0x86, 0x91, 0x20, 0x84, 0x1f,
+  0x94, 0x1e, 0x80, 0x60, 0x80, 0x5b, 0x80, 0x03, 0x95, 0x1f, 0x81, 0xda, 0x00, 0xcc, 0x83, 0xe4, 0x95, 0x40, 0x81, 0x00, 0x99, 0x3e, 0x00, 0x64,
+  0x80, 0xdf, 0x96, 0x40, 0x81, 0x1a, 0x00, 0xcc, 0x80, 0x24, 0x96, 0x1f, 0x05, 0x64, 0x44, 0x20, 0xf5, 0x20, 0x44, 0x96, 0xde, 0x01, 0x20, 0x44,
+  0x82, 0x1f, 0x01, 0x44, 0x20, 0x93, 0x20, 0x82, 0x1f, 0x00, 0xcc, 0x9a, 0x1f, 0x01, 0x64, 0x20, 0x80, 0x01, 0x94, 0x1f, 0x05, 0x00, 0x00, 0x20,
+  0x64, 0x64, 0x44, 0x80, 0x01, 0x03, 0x64, 0x20, 0x00, 0x00, 0x95, 0x1f, 0x82, 0x00, 0x92, 0x1f, 0x00, 0x00, 0x80, 0x1f, 0x81, 0xfe, 0x81, 0xdf,
+  0x80, 0x0b, 0x93, 0x1f, 0x04, 0x40, 0x20, 0x00, 0x20, 0x40, 0x98, 0x1f, 0x81, 0x19, 0x83, 0x05, 0xb0, 0x1f, 0x01, 0x20, 0xf5, 0x84, 0x1f, 0x00,
+  0xf5, 0x93, 0xa0, 0x01, 0x20, 0xf5, 0x81, 0x18, 0x83, 0x06, 0x93, 0xdf, 0x81, 0x1e, 0x83, 0x06, 0x90, 0x1f, 0x81, 0x81, 0x85, 0x00, 0x91, 0x1e,
+  0x87, 0x21, 0x89, 0x12, 0x00, 0x1c, 0xff, 0x00, 0xa5, 0x00, 0x01, 0x20, 0x20, 0x8d, 0x08, 0x8c, 0x1f, 0x00, 0xcc, 0x83, 0x17, 0x85, 0x07, 0x8f,
+  0x1f, 0x00, 0x64, 0x81, 0x18, 0x01, 0x20, 0x64, 0x96, 0x1f, 0x82, 0x18, 0x84, 0x06, 0x92, 0x1f, 0x02, 0xcc, 0x20, 0x20, 0x82, 0x05, 0x95, 0x1f,
+  0x01, 0xf5, 0xf5, 0x81, 0x02, 0x95, 0x1f, 0x01, 0x64, 0xf5, 0x83, 0x00, 0x82, 0x86, 0x91, 0x20, 0x84, 0x1f, 0x94, 0x1e, 0x80, 0x60, 0x80, 0x5b,
+  0x80, 0x03, 0x95, 0x1f, 0x81, 0xda, 0x00, 0xcc, 0x83, 0xe4, 0x95, 0x40, 0x81, 0x00, 0x99, 0x3e, 0x00, 0x64, 0x80, 0xdf, 0x96, 0x40, 0x81, 0x1a,
+  0x00, 0xcc, 0x80, 0x24, 0x00, 0x20, 0x95, 0xbf, 0x05, 0x64, 0x44, 0x20, 0xf5, 0x20, 0x44, 0x80, 0x43, 0x94, 0x1f, 0x00, 0x44, 0x82, 0x1f, 0x00,
+  0x44, 0x94, 0x1f, 0x00, 0x20, 0x81, 0x1a, 0x00, 0xcc, 0x81, 0x04, 0x00, 0x00, 0x91, 0x1e, 0x00, 0x00, 0x80, 0x1f, 0x01, 0x64, 0x20, 0x80, 0x01,
+  0x80, 0x1f, 0x91, 0x20, 0x80, 0x1f, 0x02, 0x64, 0x64, 0x44, 0x80, 0x01, 0x00, 0x64, 0x92, 0x1f, 0x02, 0x00, 0x00, 0x00, 0x80, 0xbf, 0x81, 0x00,
+  0x00, 0xcc, 0x80, 0x1f, 0x8f, 0x20, 0x83, 0x1f, 0x00, 0x20, 0x80, 0x44, 0x95, 0x1f, 0x00, 0x20, 0x80, 0x9c, 0x80, 0x05, 0x01, 0x64, 0xf5, 0x95,
+  0x1f, 0x80, 0x3e, 0x81, 0x45, 0x95, 0x1f, 0x80, 0x40, 0x81, 0x3f, 0x01, 0xf5, 0xf5, 0x81, 0x20, 0x92, 0xa0, 0x81, 0x00, 0x83, 0x1f, 0x91, 0xdf,
+  0x85, 0x20, 0x81, 0x45, 0x90, 0x1f, 0x86, 0x20, 0x91, 0x7d, 0x8a, 0x21, 0x89, 0x12, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0x01, 0x20, 0x20, 0x9c,
+  0x1f, 0x00, 0xcc, 0x83, 0x20, 0x95, 0x27, 0x01, 0x20, 0xf5, 0x82, 0x18, 0x85, 0x26, 0x90, 0x1f, 0x00, 0x64, 0x80, 0x19, 0x01, 0x20, 0xcc, 0x83,
+  0x26, 0x83, 0x49, 0x89, 0x2a, 0x01, 0x20, 0xf5, 0x80, 0x39, 0x02, 0x20, 0xcc, 0x64, 0x88, 0x1f, 0x00, 0xcc, 0x89, 0x4b, 0x80, 0x39, 0x03, 0x64,
+  0x20, 0x64, 0xf5, 0x88, 0x1f, 0x84, 0x52, 0x87, 0x1f, 0x81, 0x00, 0x88, 0x5f, 0x80, 0x1f, 0x8a, 0x0c, 0x80, 0x20, 0x81, 0x02, 0x80, 0x76, 0x84,
+  0x78, 0x8c, 0x1f, 0x01, 0x44, 0xf5, 0x81, 0x02, 0x80, 0x64, 0x02, 0x44, 0x44, 0x44, 0x82, 0x24, 0x00, 0x64, 0x81, 0x92, 0x87, 0x5e, 0x84, 0x1f,
+  0x00, 0xcc, 0x81, 0x1f, 0x81, 0x00, 0x02, 0x64, 0xcc, 0xcc, 0x86, 0x7f, 0x84, 0x7d, 0x80, 0x5e, 0x86, 0x1f, 0x8b, 0x1e, 0x02, 0x64, 0x64, 0x64,
+  0x82, 0x22, 0x00, 0xcc, 0x80, 0x15, 0x85, 0x1f, 0x87, 0xbd, 0x01, 0x20, 0x64, 0x81, 0x6e, 0x81, 0x9d, 0x81, 0x35, 0x82, 0x20, 0x80, 0x30, 0x89,
+  0xfd, 0x80, 0x96, 0x80, 0x10, 0x80, 0x01, 0x81, 0x40, 0x81, 0x4c, 0x88, 0x5d, 0x81, 0x1f, 0x81, 0x1a, 0x82, 0x43, 0x83, 0x1f, 0x00, 0xcc, 0x82,
+  0xe9, 0x87, 0x1f, 0x80, 0x20, 0x80, 0xf4, 0x81, 0x1e, 0x01, 0x64, 0xcc, 0x82, 0xdb, 0x81, 0xb0, 0x89, 0x1f, 0x87, 0x86, 0x03, 0xcc, 0x20, 0x00,
+  0x00, 0x82, 0x68, 0x90, 0x1f, 0x80, 0x1b, 0x01, 0x20, 0xf5, 0x80, 0x1f, 0x00, 0x00, 0x80, 0x09, 0x00, 0x64, 0x8e, 0x1f, 0x00, 0x20, 0x81, 0x1b,
+  0x82, 0x1f, 0x80, 0x3d, 0x80, 0x48, 0x89, 0xa0, 0x82, 0x1f, 0x80, 0x92, 0x82, 0x23, 0x00, 0x00, 0x81, 0x80, 0x81, 0x43, 0x8b, 0x1f, 0x80, 0x16,
+  0x80, 0x3e, 0x81, 0x7f, 0x81, 0x00, 0x00, 0x20, 0x90, 0xa0, 0x81, 0x16, 0x84, 0x1e, 0x82, 0x43, 0x8d, 0x1f, 0x81, 0x20, 0x88, 0x00, 0x8e, 0x1e,
+  0x87, 0x21, 0x89, 0x12, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0x9d, 0x00, 0x01, 0x20, 0x20, 0x9c, 0x1f, 0x00, 0xcc, 0x83, 0x20, 0x95, 0x27, 0x01,
+  0x20, 0xf5, 0x82, 0x18, 0x85, 0x26, 0x90, 0x1f, 0x00, 0x64, 0x80, 0x19, 0x01, 0x20, 0xcc, 0x83, 0x26, 0x83, 0x49, 0x89, 0x2a, 0x01, 0x20, 0xf5,
+  0x80, 0x39, 0x02, 0x20, 0xcc, 0x64, 0x88, 0x1f, 0x00, 0xcc, 0x89, 0x4b, 0x80, 0x39, 0x03, 0x64, 0x20, 0x64, 0xf5, 0x88, 0x1f, 0x84, 0x52, 0x87,
+  0x1f, 0x81, 0x00, 0x88, 0x5f, 0x80, 0x1f, 0x8a, 0x0c, 0x80, 0x20, 0x81, 0x02, 0x80, 0x76, 0x84, 0x78, 0x8c, 0x1f, 0x01, 0x44, 0xf5, 0x81, 0x02,
+  0x80, 0x64, 0x02, 0x44, 0x44, 0x44, 0x82, 0x24, 0x00, 0x64, 0x81, 0x92, 0x87, 0x5e, 0x84, 0x1f, 0x00, 0xcc, 0x81, 0x1f, 0x81, 0x00, 0x02, 0x64,
+  0xcc, 0xcc, 0x86, 0x7f, 0x84, 0x7d, 0x80, 0x5e, 0x86, 0x1f, 0x8b, 0x1e, 0x02, 0x64, 0x64, 0x64, 0x82, 0x22, 0x00, 0xcc, 0x80, 0x15, 0x85, 0x1f,
+  0x87, 0xbd, 0x01, 0x20, 0x64, 0x81, 0x6e, 0x81, 0x9d, 0x81, 0x35, 0x82, 0x20, 0x80, 0x30, 0x89, 0xfd, 0x80, 0x96, 0x80, 0x10, 0x80, 0x01, 0x81,
+  0x40, 0x81, 0x4c, 0x88, 0x5d, 0x81, 0x1f, 0x81, 0x1a, 0x81, 0xb3, 0x80, 0x17, 0x82, 0x6b, 0x82, 0xe9, 0x87, 0x1f, 0x80, 0x20, 0x80, 0xf4, 0x82,
+  0x3f, 0x01, 0x64, 0xcc, 0x82, 0xdc, 0x00, 0xcc, 0x8b, 0x1f, 0x83, 0x64, 0x83, 0x86, 0x01, 0x20, 0x00, 0x81, 0x05, 0x80, 0x06, 0x00, 0x00, 0x8a,
+  0x1d, 0x82, 0x19, 0x02, 0x00, 0x00, 0x20, 0x81, 0x05, 0x80, 0xd0, 0x81, 0x0b, 0x8b, 0x3d, 0x82, 0x1e, 0x02, 0x00, 0x20, 0xf5, 0x82, 0x1f, 0x82,
+  0x0b, 0x8b, 0x5e, 0x84, 0x1e, 0x81, 0x5f, 0x00, 0xf5, 0x81, 0x24, 0x8c, 0x1f, 0x80, 0x00, 0x81, 0x1f, 0x81, 0x26, 0x81, 0xa0, 0x91, 0x1f, 0x81,
+  0x20, 0x88, 0x00, 0x8e, 0x1e, 0x89, 0x21, 0x87, 0x12, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0x01, 0x20, 0x20, 0x9c, 0x1f, 0x00, 0xcc, 0x83, 0x20,
+  0x95, 0x27, 0x01, 0x20, 0xf5, 0x82, 0x18, 0x85, 0x26, 0x90, 0x1f, 0x00, 0x64, 0x80, 0x19, 0x01, 0x20, 0xcc, 0x83, 0x26, 0x83, 0x49, 0x89, 0x2a,
+  0x01, 0x20, 0xf5, 0x80, 0x39, 0x02, 0x20, 0xcc, 0x64, 0x88, 0x1f, 0x00, 0xcc, 0x89, 0x4b, 0x80, 0x39, 0x03, 0x64, 0x20, 0x64, 0xf5, 0x88, 0x1f,
+  0x84, 0x52, 0x87, 0x1f, 0x81, 0x00, 0x88, 0x5f, 0x80, 0x1f, 0x8a, 0x0c, 0x80, 0x20, 0x81, 0x02, 0x80, 0x76, 0x84, 0x78, 0x8c, 0x1f, 0x01, 0x44,
+  0xf5, 0x81, 0x02, 0x80, 0x64, 0x02, 0x44, 0x44, 0x44, 0x82, 0x24, 0x00, 0x64, 0x81, 0x92, 0x87, 0x5e, 0x84, 0x1f, 0x00, 0xcc, 0x81, 0x1f, 0x81,
+  0x00, 0x02, 0x64, 0xcc, 0xcc, 0x86, 0x7f, 0x84, 0x7d, 0x80, 0x5e, 0x86, 0x1f, 0x8b, 0x1e, 0x02, 0x64, 0x64, 0x64, 0x82, 0x22, 0x00, 0xcc, 0x80,
+  0x15, 0x85, 0x1f, 0x87, 0xbd, 0x01, 0x20, 0x64, 0x81, 0x6e, 0x81, 0x9d, 0x81, 0x35, 0x82, 0x20, 0x80, 0x30, 0x89, 0xfd, 0x80, 0x96, 0x80, 0x10,
+  0x80, 0x01, 0x81, 0x40, 0x81, 0x4c, 0x88, 0x5d, 0x81, 0x1f, 0x81, 0x1a, 0x82, 0x43, 0x83, 0x1f, 0x00, 0xcc, 0x82, 0xe9, 0x87, 0x1f, 0x80, 0x20,
+  0x80, 0xf4, 0x81, 0x1e, 0x01, 0x64, 0xcc, 0x82, 0xdb, 0x81, 0xb0, 0x89, 0x1f, 0x87, 0x86, 0x03, 0xcc, 0x20, 0x00, 0x00, 0x82, 0x68, 0x90, 0x1f,
+  0x80, 0x1b, 0x01, 0x20, 0xf5, 0x80, 0x1f, 0x00, 0x00, 0x80, 0x09, 0x00, 0x64, 0x8e, 0x1f, 0x00, 0x20, 0x81, 0x1b, 0x82, 0x1f, 0x80, 0x3d, 0x80,
+  0x48, 0x89, 0xa0, 0x82, 0x1f, 0x80, 0x92, 0x82, 0x23, 0x00, 0x00, 0x81, 0x80, 0x81, 0x43, 0x8b, 0x1f, 0x80, 0x16, 0x80, 0x3e, 0x81, 0x7f, 0x81,
+  0x00, 0x00, 0x20, 0x90, 0xa0, 0x81, 0x16, 0x84, 0x1e, 0x82, 0x43, 0x8d, 0x1f, 0x81, 0x20, 0x88, 0x00, 0x8e, 0x1e, 0x87, 0x21, 0x89, 0x12, 0x00,
+  0x1c, 0xff, 0x00, 0xff, 0x00, 0x9d, 0x00, 0x01, 0x20, 0x20, 0x9c, 0x1f, 0x00, 0xcc, 0x83, 0x20, 0x95, 0x27, 0x01, 0x20, 0xf5, 0x82, 0x18, 0x85,
+  0x26, 0x90, 0x1f, 0x00, 0x64, 0x80, 0x19, 0x01, 0x20, 0xcc, 0x83, 0x26, 0x83, 0x49, 0x89, 0x2a, 0x01, 0x20, 0xf5, 0x80, 0x39, 0x02, 0x20, 0xcc,
+  0x64, 0x88, 0x1f, 0x00, 0xcc, 0x89, 0x4b, 0x80, 0x39, 0x03, 0x64, 0x20, 0x64, 0xf5, 0x88, 0x1f, 0x84, 0x52, 0x87, 0x1f, 0x81, 0x00, 0x88, 0x5f,
+  0x80, 0x1f, 0x8a, 0x0c, 0x80, 0x20, 0x81, 0x02, 0x80, 0x76, 0x84, 0x78, 0x8c, 0x1f, 0x01, 0x44, 0xf5, 0x81, 0x02, 0x80, 0x64, 0x02, 0x44, 0x44,
+  0x44, 0x82, 0x24, 0x00, 0x64, 0x81, 0x92, 0x87, 0x5e, 0x84, 0x1f, 0x00, 0xcc, 0x81, 0x1f, 0x81, 0x00, 0x02, 0x64, 0xcc, 0xcc, 0x86, 0x7f, 0x84,
+  0x7d, 0x80, 0x5e, 0x86, 0x1f, 0x8b, 0x1e, 0x02, 0x64, 0x64, 0x64, 0x82, 0x22, 0x00, 0xcc, 0x80, 0x15, 0x85, 0x1f, 0x87, 0xbd, 0x01, 0x20, 0x64,
+  0x81, 0x6e, 0x81, 0x9d, 0x81, 0x35, 0x82, 0x20, 0x80, 0x30, 0x89, 0xfd, 0x80, 0x96, 0x80, 0x10, 0x80, 0x01, 0x81, 0x40, 0x81, 0x4c, 0x88, 0x5d,
+  0x81, 0x1f, 0x81, 0x1a, 0x82, 0x43, 0x83, 0x1f, 0x00, 0xcc, 0x83, 0xe9, 0x89, 0x20, 0x80, 0x0d, 0x81, 0x43, 0x80, 0x36, 0x82, 0x00, 0x82, 0x6c,
+  0x88, 0x20, 0x81, 0x00, 0x02, 0x00, 0x20, 0x20, 0x81, 0x35, 0x80, 0x26, 0x00, 0x20, 0x80, 0x0a, 0x80, 0x23, 0x87, 0xff, 0x84, 0x43, 0x80, 0x1e,
+  0x00, 0x00, 0x82, 0x1e, 0x82, 0x00, 0x00, 0x20, 0x8c, 0x1f, 0x81, 0x73, 0x81, 0x16, 0x84, 0x1e, 0x81, 0x09, 0x8b, 0x1f, 0x82, 0x1e, 0x88, 0x00,
+  0x8e, 0x7e, 0x8b, 0x1e, 0x8c, 0x1f, 0x81, 0x22, 0x9b, 0x1e, 0x87, 0x21, 0x89, 0x12, 0x00, 0x1c, 0xff, 0x00, 0xe9, 0x00, 0x01, 0x20, 0x20, 0x9c,
+  0x1f, 0x00, 0xcc, 0x97, 0x20, 0x81, 0x3b, 0x82, 0x1f, 0x94, 0x44, 0x81, 0x1b, 0x01, 0x20, 0x64, 0x80, 0x03, 0x94, 0x43, 0x05, 0x20, 0xf5, 0x64,
+  0x20, 0x64, 0xcc, 0x80, 0x03, 0x00, 0xf5, 0x95, 0x1f, 0x03, 0xcc, 0x20, 0xcc, 0xcc, 0x80, 0x03, 0x96, 0x1f, 0x05, 0x64, 0xcc, 0x20, 0x20, 0x20,
+  0xcc, 0x96, 0x3f, 0x80, 0x19, 0x02, 0xf5, 0xcc, 0xf5, 0x81, 0x25, 0x94, 0x1f, 0x81, 0x1d, 0x80, 0x03, 0x95, 0xe3, 0x02, 0x20, 0xf5, 0x44, 0x80,
+  0x1f, 0x00, 0x44, 0x94, 0x5e, 0x9e, 0x1f, 0x00, 0x00, 0x80, 0x60, 0x81, 0x61, 0x02, 0xcc, 0x20, 0x00, 0x93, 0x3e, 0x80, 0xf9, 0x80, 0xdf, 0x02,
+  0xf5, 0x64, 0x20, 0x94, 0x9f, 0x01, 0x64, 0x20, 0x82, 0xdf, 0x80, 0x07, 0x93, 0x5e, 0x02, 0x64, 0x20, 0x64, 0x83, 0x02, 0x92, 0x60, 0x80, 0x1f,
+  0x80, 0x59, 0x80, 0x00, 0x80, 0x06, 0x90, 0x1f, 0x00, 0x00, 0x81, 0x3f, 0x80, 0x1b, 0x81, 0x04, 0x01, 0x20, 0x00, 0x8f, 0x20, 0x80, 0x1f, 0x81,
+  0x79, 0x81, 0x1d, 0x80, 0xc0, 0x94, 0x1f, 0x80, 0x18, 0x00, 0x00, 0x81, 0xa1, 0x95, 0x1f, 0x80, 0x1e, 0x84, 0x07, 0x90, 0x9e, 0x01, 0x20, 0xf5,
+  0x84, 0x1f, 0x00, 0xf5, 0x80, 0x47, 0x90, 0xfe, 0x00, 0xf5, 0x86, 0x1f, 0x01, 0xf5, 0x20, 0x92, 0xdf, 0x83, 0x1e, 0x81, 0x81, 0x91, 0xff, 0x80,
+  0x81, 0x86, 0x00, 0x91, 0x1e, 0x87, 0x21, 0x89, 0x12, 0x00, 0x1c, 0xff, 0x00, 0xc5, 0x00, 0x01, 0x20, 0x20, 0x8d, 0x08, 0x8c, 0x1f, 0x00, 0xcc,
+  0x83, 0x17, 0x85, 0x07, 0x8e, 0x1f, 0x01, 0xf5, 0x64, 0x81, 0x18, 0x02, 0x20, 0x64, 0xf5, 0x95, 0x1f, 0x82, 0x38, 0x01, 0x20, 0xcc, 0x96, 0x1f,
+  0x05, 0x64, 0xcc, 0x20, 0x20, 0x20, 0xcc, 0x96, 0x3f, 0x80, 0x19, 0x02, 0xf5, 0xcc, 0xf5, 0x81, 0x25, 0x94, 0x1f, 0x81, 0x1d, 0x80, 0x03, 0x94,
+  0x1f, 0x80, 0x60, 0x00, 0x44, 0x80, 0x1f, 0x00, 0x44, 0x94, 0x5e, 0xa0, 0x1f, 0x80, 0x5e, 0x81, 0x02, 0x96, 0x1f, 0x06, 0x64, 0xf5, 0xcc, 0xcc,
+  0xcc, 0xf5, 0x64, 0x95, 0x1f, 0x80, 0x40, 0x81, 0xdf, 0x97, 0x1e, 0x02, 0x20, 0x64, 0x64, 0x81, 0x02, 0x96, 0x5f, 0x80, 0x00, 0x80, 0x1d, 0x95,
+  0x1f, 0x00, 0x00, 0x80, 0x3b, 0x80, 0x7f, 0x80, 0x40, 0x01, 0x00, 0x00, 0x92, 0x1e, 0x00, 0xcc, 0x81, 0x1e, 0x80, 0x20, 0x01, 0xcc, 0x20, 0x94,
+  0x1f, 0x80, 0x21, 0x80, 0x42, 0x80, 0x07, 0x90, 0x1f, 0x00, 0x00, 0x8a, 0x1f, 0x8f, 0x20, 0x80, 0x1f, 0x00, 0x64, 0x80, 0x19, 0x83, 0x03, 0x92,
+  0x1f, 0x00, 0x00, 0x81, 0xfb, 0x82, 0x03, 0x80, 0x0b, 0x91, 0x1f, 0x81, 0x61, 0x82, 0x03, 0x94, 0x1f, 0x02, 0x20, 0x20, 0xf5, 0x80, 0x1f, 0x00,
+  0xf5, 0x93, 0x3f, 0x81, 0x80, 0x00, 0xf5, 0x82, 0x1f, 0x80, 0x04, 0x92, 0xdf, 0x81, 0x40, 0x85, 0x04, 0x90, 0x1f, 0x82, 0x81, 0x84, 0x00, 0x91,
+  0x1e, 0x87, 0x21, 0x89, 0x12, 0x00, 0x1c, 0xff, 0x00, 0xa5, 0x00, 0x01, 0x20, 0x20, 0x8d, 0x08, 0x8c, 0x1f, 0x00, 0xcc, 0x83, 0x17, 0x85, 0x07,
+  0x8e, 0x1f, 0x01, 0xf5, 0x64, 0x81, 0x18, 0x02, 0x20, 0x64, 0xf5, 0x95, 0x1f, 0x82, 0x38, 0x01, 0x20, 0xcc, 0x96, 0x1f, 0x05, 0x64, 0xcc, 0x20,
+  0x20, 0x20, 0xcc, 0x96, 0x3f, 0x80, 0x19, 0x02, 0xf5, 0xcc, 0xf5, 0x81, 0x25, 0x94, 0x1f, 0x81, 0x1d, 0x80, 0x03, 0x94, 0x1f, 0x80, 0x60, 0x00,
+  0x44, 0x80, 0x1f, 0x00, 0x44, 0x94, 0x5e, 0xa0, 0x1f, 0x80, 0x5e, 0x81, 0x02, 0x96, 0x1f, 0x06, 0x64, 0xf5, 0xcc, 0xcc, 0xcc, 0xf5, 0x64, 0x95,
+  0x1f, 0x80, 0x40, 0x81, 0xdf, 0x96, 0x1e, 0x80, 0x40, 0x00, 0x64, 0x81, 0x02, 0x95, 0x1e, 0x00, 0x00, 0x80, 0x3d, 0x00, 0xe0, 0x80, 0x03, 0x00,
+  0x00, 0x97, 0x3e, 0x81, 0x3f, 0x95, 0x40, 0x02, 0x00, 0x20, 0x64, 0x80, 0x9e, 0x02, 0xcc, 0xcc, 0x64, 0x93, 0x40, 0x00, 0x00, 0x82, 0x1f, 0x81,
+  0x02, 0x01, 0x20, 0x00, 0x91, 0x20, 0x80, 0x1e, 0x01, 0x20, 0xcc, 0x80, 0x5d, 0x00, 0xcc, 0x80, 0x07, 0x90, 0x1f, 0x80, 0x3e, 0x00, 0xcc, 0x80,
+  0x01, 0x80, 0x23, 0x80, 0x01, 0x90, 0x40, 0x80, 0x1f, 0x00, 0xf5, 0x84, 0xff, 0x00, 0xf5, 0xb4, 0x1f, 0x9d, 0x5f, 0x00, 0x20, 0x80, 0x39, 0x83,
+  0x03, 0x91, 0xc0, 0x81, 0x60, 0x80, 0x59, 0x82, 0x04, 0x92, 0xdf, 0x81, 0x41, 0x85, 0x04, 0x90, 0x1f, 0x81, 0x20, 0x85, 0x00, 0x91, 0x1e, 0x87,
+  0x21, 0x89, 0x12, 0x00, 0x1c, 0xff, 0x00, 0xa5, 0x00, 0x01, 0x20, 0x20, 0x8d, 0x08, 0x8c, 0x1f, 0x00, 0xcc, 0x83, 0x17, 0x85, 0x07, 0x8e, 0x1f,
+  0x01, 0xf5, 0x64, 0x81, 0x18, 0x02, 0x20, 0x64, 0xf5, 0x95, 0x1f, 0x82, 0x38, 0x01, 0x20, 0xcc, 0x96, 0x1f, 0x05, 0x64, 0xcc, 0x20, 0x20, 0x20,
+  0xcc, 0x96, 0x3f, 0x80, 0x19, 0x02, 0xf5, 0xcc, 0xf5, 0x81, 0x25, 0x94, 0x1f, 0x81, 0x1d, 0x80, 0x03, 0x94, 0x1f, 0x80, 0x60, 0x00, 0x44, 0x80,
+  0x1f, 0x00, 0x44, 0x94, 0x5e, 0xa0, 0x1f, 0x80, 0x5e, 0x81, 0x02, 0x96, 0x1f, 0x06, 0x64, 0xf5, 0xcc, 0xcc, 0xcc, 0xf5, 0x64, 0x95, 0x1f, 0x80,
+  0x40, 0x81, 0xdf, 0x96, 0x1e, 0x80, 0x40, 0x00, 0x64, 0x81, 0x02, 0x95, 0x1e, 0x00, 0x00, 0x80, 0x3d, 0x00, 0xe0, 0x80, 0x03, 0x00, 0x00, 0x98,
+  0x3e, 0x00, 0xe0, 0x97, 0x40, 0x03, 0x00, 0x20, 0x64, 0xcc, 0x80, 0x5f, 0x80, 0x03, 0x92, 0x40, 0x00, 0x00, 0x81, 0x1f, 0x00, 0xcc, 0x81, 0x02,
+  0x01, 0x20, 0x00, 0x91, 0x20, 0x80, 0x1e, 0x05, 0x20, 0xcc, 0x64, 0x64, 0x64, 0xcc, 0x80, 0x07, 0x90, 0x1f, 0x80, 0x3e, 0x00, 0xcc, 0x80, 0x01,
+  0x80, 0x23, 0x80, 0x01, 0x90, 0x40, 0x80, 0x1f, 0x00, 0xf5, 0x84, 0xff, 0x00, 0xf5, 0xb4, 0x1f, 0x9d, 0x5f, 0x00, 0x20, 0x80, 0x39, 0x83, 0x03,
+  0x91, 0xc0, 0x81, 0x60, 0x80, 0x59, 0x82, 0x04, 0x92, 0xdf, 0x81, 0x41, 0x85, 0x04, 0x90, 0x1f, 0x81, 0x20, 0x85, 0x00, 0x91, 0x1e, 0x87, 0x21,
+  0x89, 0x12, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0x91, 0x00, 0x01, 0x20, 0x20, 0x9a, 0x17, 0x01, 0x20, 0xcc, 0x95, 0x1f, 0x83, 0x18, 0x01, 0x20,
+  0xf5, 0x95, 0x1f, 0x00, 0xf5, 0x81, 0x20, 0x01, 0x20, 0x64, 0x8a, 0x1f, 0x00, 0x20, 0x87, 0x6d, 0x02, 0x20, 0xf5, 0x64, 0x80, 0x20, 0x01, 0x20,
+  0xcc, 0x89, 0x1f, 0x01, 0x20, 0xcc, 0x87, 0x6d, 0x80, 0x1f, 0x01, 0xf5, 0x64, 0x80, 0x3e, 0x88, 0x7f, 0x8a, 0x4c, 0x80, 0x5f, 0x00, 0xf5, 0x81,
+  0x00, 0x89, 0x1f, 0x00, 0xf5, 0x84, 0x1f, 0x80, 0x66, 0x00, 0x20, 0x80, 0x59, 0x81, 0x21, 0x89, 0x5f, 0x84, 0x1f, 0x04, 0x20, 0x20, 0x44, 0x44,
+  0x44, 0x81, 0x5a, 0x01, 0xf5, 0x44, 0x81, 0x02, 0x88, 0x1f, 0x00, 0xcc, 0x80, 0x71, 0x82, 0x1d, 0x80, 0x1f, 0x00, 0xcc, 0x85, 0x1f, 0x88, 0x92,
+  0x03, 0x64, 0xcc, 0xcc, 0x64, 0x82, 0x1d, 0x82, 0x1f, 0x83, 0x7f, 0x89, 0x81, 0x87, 0x20, 0x00, 0x64, 0x80, 0x09, 0x82, 0x1f, 0x01, 0xcc, 0x64,
+  0x80, 0x0a, 0x89, 0x20, 0x87, 0x1f, 0x81, 0x40, 0x00, 0xcc, 0x81, 0x70, 0x00, 0x64, 0x89, 0xe2, 0x80, 0x19, 0x80, 0x03, 0x81, 0x3e, 0x80, 0xa2,
+  0x81, 0x0e, 0x89, 0x1e, 0x82, 0x61, 0x80, 0x19, 0x82, 0x1f, 0x84, 0x3b, 0x80, 0x05, 0x88, 0x1f, 0x80, 0x53, 0x82, 0xfd, 0x00, 0x20, 0x80, 0x5e,
+  0x80, 0x20, 0x80, 0xec, 0x89, 0x1e, 0x01, 0x1c, 0x20, 0x81, 0x71, 0x05, 0x64, 0x20, 0x00, 0x00, 0x20, 0xcc, 0x8b, 0x78, 0x86, 0x1f, 0x00, 0x64,
+  0x80, 0x19, 0x00, 0x00, 0x80, 0x1f, 0x01, 0xf5, 0x20, 0x81, 0x23, 0x8d, 0x1e, 0x80, 0xcb, 0x80, 0x59, 0x81, 0x3f, 0x81, 0x1f, 0x80, 0x6a, 0x8c,
+  0x1f, 0x80, 0x3b, 0x81, 0x71, 0x82, 0x1f, 0x80, 0x29, 0x00, 0xf5, 0x8d, 0x1f, 0x80, 0x9d, 0x80, 0x5c, 0x81, 0x5f, 0x80, 0x1b, 0x80, 0x2a, 0x00,
+  0x00, 0x8c, 0x1f, 0x82, 0x3b, 0x83, 0x20, 0x81, 0x08, 0x8d, 0x9e, 0x00, 0x1c, 0x84, 0x1c, 0x84, 0x00, 0x8e, 0x1e, 0x8a, 0x24, 0x8a, 0x13, 0x00,
+  0x1c, 0xff, 0x00, 0xf2, 0x00, 0x01, 0x20, 0x20, 0x9a, 0x17, 0x01, 0x20, 0xcc, 0x95, 0x1f, 0x83, 0x18, 0x01, 0x20, 0xf5, 0x95, 0x1f, 0x00, 0xf5,
+  0x81, 0x20, 0x01, 0x20, 0x64, 0x97, 0x1f, 0x00, 0x64, 0x80, 0x20, 0x01, 0x20, 0xcc, 0x98, 0x1f, 0x01, 0xf5, 0x64, 0x80, 0x3e, 0x8b, 0x7f, 0x00,
+  0x20, 0x86, 0xae, 0x80, 0x5f, 0x00, 0xf5, 0x81, 0x00, 0x8a, 0x1f, 0x01, 0x20, 0xcc, 0x86, 0x0e, 0x80, 0x59, 0x81, 0x21, 0x8a, 0x5f, 0x88, 0x8d,
+  0x00, 0x20, 0x81, 0x1f, 0x00, 0x44, 0x81, 0x02, 0x89, 0x1f, 0x00, 0xf5, 0x84, 0x0d, 0x03, 0x20, 0x20, 0x44, 0x64, 0x85, 0x1f, 0x88, 0x60, 0x84,
+  0x1f, 0x80, 0x1d, 0x00, 0x44, 0x80, 0x1f, 0x83, 0x7f, 0x89, 0x81, 0x80, 0x53, 0x00, 0x64, 0x80, 0xd3, 0x80, 0x1d, 0x80, 0x1f, 0x81, 0x40, 0x80,
+  0x1c, 0x00, 0x64, 0x80, 0x08, 0x86, 0x74, 0x80, 0x34, 0x00, 0x64, 0x85, 0x1e, 0x82, 0x20, 0x80, 0x0e, 0x01, 0x20, 0x20, 0x80, 0x33, 0x88, 0x20,
+  0x81, 0x1a, 0x82, 0x3e, 0x80, 0xfd, 0x00, 0x20, 0x80, 0x0b, 0x88, 0x1e, 0x82, 0x20, 0x81, 0x39, 0x82, 0x7e, 0x84, 0x3b, 0x80, 0x05, 0x87, 0x1f,
+  0x80, 0x20, 0x82, 0x19, 0x82, 0x05, 0x82, 0x20, 0x80, 0x00, 0x88, 0x1e, 0x82, 0x61, 0x81, 0x1f, 0x80, 0xff, 0x82, 0x8c, 0x89, 0x1b, 0x81, 0x00,
+  0x00, 0x00, 0x80, 0xc3, 0x00, 0xcc, 0x80, 0x33, 0x80, 0x07, 0x8a, 0x99, 0x85, 0x1e, 0x01, 0x00, 0x20, 0x81, 0x1e, 0x00, 0x00, 0x81, 0x07, 0x82,
+  0x23, 0x8f, 0x1f, 0x82, 0xb7, 0x84, 0x1f, 0x00, 0xf5, 0x8b, 0x7c, 0x83, 0x1f, 0x80, 0x17, 0x83, 0x1f, 0x80, 0x83, 0x00, 0xf5, 0x8f, 0x1f, 0x00,
+  0xf5, 0x80, 0x38, 0x81, 0x5f, 0x80, 0x1b, 0x81, 0x28, 0x8e, 0x9f, 0x81, 0x9c, 0x82, 0x20, 0x81, 0x06, 0x8d, 0xbe, 0x81, 0x41, 0x88, 0x00, 0x8f,
+  0x1e, 0x89, 0x23, 0x8a, 0x13, 0x00, 0x1c, 0xf3, 0x00, 0x01, 0x20, 0x20, 0x9a, 0x17, 0x01, 0x20, 0xcc, 0x95, 0x1f, 0x83, 0x18, 0x01, 0x20, 0xf5,
+  0x95, 0x1f, 0x00, 0xf5, 0x81, 0x20, 0x01, 0x20, 0x64, 0x97, 0x1f, 0x00, 0x64, 0x80, 0x20, 0x01, 0x20, 0xcc, 0x98, 0x1f, 0x01, 0xf5, 0x64, 0x80,
+  0x3e, 0x96, 0x7f, 0x02, 0xf5, 0xcc, 0xf5, 0x81, 0x00, 0x97, 0x9f, 0x80, 0x1b, 0x81, 0x02, 0x98, 0x1f, 0x00, 0x44, 0x81, 0x02, 0x9d, 0x1f, 0x94,
+  0x60, 0x01, 0x20, 0xcc, 0x83, 0x7f, 0x94, 0x81, 0x02, 0x20, 0x44, 0x64, 0x82, 0x1f, 0x02, 0xcc, 0x64, 0x64, 0x81, 0xe7, 0x8f, 0x1f, 0x81, 0x17,
+  0x81, 0x1e, 0x03, 0x20, 0x20, 0x20, 0x64, 0x94, 0x1f, 0x80, 0x18, 0x83, 0x05, 0x92, 0x5e, 0x81, 0x1a, 0x81, 0x3b, 0x80, 0x05, 0x95, 0x1f, 0x81,
+  0x20, 0x80, 0x00, 0x8b, 0x19, 0x81, 0x0e, 0x01, 0x20, 0x44, 0x81, 0x1f, 0x01, 0xcc, 0xcc, 0x81, 0x7e, 0x8d, 0xd6, 0x80, 0x10, 0x80, 0x1e, 0x80,
+  0x1f, 0x80, 0x1e, 0x81, 0x20, 0x8c, 0x1f, 0x01, 0xf5, 0x20, 0x80, 0x42, 0x80, 0x77, 0x84, 0x1f, 0x8d, 0xdb, 0x02, 0x20, 0xf5, 0xcc, 0x82, 0x1c,
+  0x80, 0x03, 0x93, 0x1f, 0x00, 0x64, 0x80, 0x20, 0x80, 0x1b, 0x81, 0x9a, 0x00, 0xcc, 0x80, 0x22, 0x8e, 0xdc, 0x82, 0xd2, 0x80, 0x36, 0x80, 0x20,
+  0x80, 0x49, 0x91, 0xfc, 0x82, 0x39, 0x81, 0x1c, 0x02, 0xcc, 0x20, 0x00, 0x82, 0xae, 0x8c, 0x00, 0x03, 0x00, 0x00, 0x20, 0xf5, 0x80, 0x1f, 0x00,
+  0x64, 0x80, 0xaa, 0x80, 0x09, 0x8d, 0xe0, 0x82, 0x1f, 0x00, 0xcc, 0x80, 0x20, 0x00, 0x20, 0x81, 0x1b, 0x80, 0x09, 0x93, 0x40, 0x81, 0x3b, 0x80,
+  0x1b, 0x00, 0x00, 0x8f, 0x3e, 0x81, 0x1f, 0x80, 0x16, 0x85, 0x04, 0x8f, 0x1e, 0x82, 0x20, 0x85, 0x00, 0x91, 0x1e, 0x87, 0x21, 0x89, 0x12, 0x00,
+  0x1c, 0xf3, 0x00, 0x01, 0x20, 0x20, 0x9a, 0x17, 0x01, 0x20, 0xcc, 0x95, 0x1f, 0x83, 0x18, 0x01, 0x20, 0xf5, 0x95, 0x1f, 0x00, 0xf5, 0x81, 0x20,
+  0x01, 0x20, 0x64, 0x97, 0x1f, 0x00, 0x64, 0x80, 0x20, 0x01, 0x20, 0xcc, 0x98, 0x1f, 0x01, 0xf5, 0x64, 0x80, 0x3e, 0x96, 0x7f, 0x02, 0xf5, 0xcc,
+  0xf5, 0x81, 0x00, 0x97, 0x9f, 0x80, 0x1b, 0x81, 0x02, 0x98, 0x1f, 0x00, 0x44, 0x81, 0x02, 0x9d, 0x1f, 0x94, 0x60, 0x01, 0x20, 0xcc, 0x83, 0x7f,
+  0x94, 0x81, 0x02, 0x20, 0x44, 0x64, 0x82, 0x1f, 0x02, 0xcc, 0x64, 0x64, 0x81, 0xe7, 0x8f, 0x1f, 0x81, 0x17, 0x81, 0x1e, 0x03, 0x20, 0x20, 0x20,
+  0x64, 0x94, 0x1f, 0x80, 0x18, 0x83, 0x05, 0x92, 0x5e, 0x81, 0x1a, 0x81, 0x3b, 0x80, 0x05, 0x90, 0x1e, 0x82, 0x1f, 0x81, 0x20, 0x80, 0x00, 0x91,
+  0x1e, 0x81, 0x1f, 0x01, 0xcc, 0xcc, 0x81, 0x7e, 0x91, 0x5c, 0x82, 0x1f, 0x80, 0x1e, 0x81, 0x20, 0x93, 0x1f, 0x84, 0x1e, 0x00, 0xcc, 0x90, 0xdb,
+  0x83, 0x7c, 0x80, 0x3a, 0x93, 0xfb, 0x00, 0x00, 0x81, 0xbb, 0x00, 0x44, 0x80, 0x1f, 0x01, 0x20, 0xcc, 0x82, 0xbd, 0x92, 0x1f, 0x81, 0x20, 0x80,
+  0x1f, 0x81, 0xdf, 0x8b, 0x5b, 0x80, 0x00, 0x80, 0x36, 0x04, 0xcc, 0xf5, 0xcc, 0x44, 0x64, 0x80, 0x08, 0x00, 0x00, 0x80, 0x03, 0x8b, 0x1f, 0x82,
+  0xb2, 0x80, 0x5c, 0x03, 0xf5, 0x20, 0x44, 0x20, 0x81, 0xdd, 0x00, 0xf5, 0x8c, 0xe0, 0x81, 0x40, 0x00, 0x20, 0x80, 0x96, 0x01, 0xf5, 0x44, 0x80,
+  0x48, 0x80, 0x20, 0x80, 0x28, 0x8d, 0x7f, 0x01, 0x00, 0x00, 0x82, 0x40, 0x00, 0xf5, 0x80, 0x80, 0x81, 0x81, 0x8e, 0xdf, 0x81, 0x20, 0x85, 0x00,
+  0x01, 0x00, 0x00, 0x8e, 0x1e, 0x83, 0x21, 0x85, 0x00, 0x91, 0x1e, 0x87, 0x21, 0x89, 0x12, 0x00, 0x1c, 0xf3, 0x00, 0x01, 0x20, 0x20, 0x9a, 0x17,
+  0x01, 0x20, 0xcc, 0x95, 0x1f, 0x83, 0x18, 0x01, 0x20, 0xf5, 0x95, 0x1f, 0x00, 0xf5, 0x81, 0x20, 0x01, 0x20, 0x64, 0x97, 0x1f, 0x00, 0x64, 0x80,
+  0x20, 0x01, 0x20, 0xcc, 0x98, 0x1f, 0x01, 0xf5, 0x64, 0x80, 0x3e, 0x96, 0x7f, 0x02, 0xf5, 0xcc, 0xf5, 0x81, 0x00, 0x97, 0x9f, 0x82, 0x1e, 0x00,
+  0xf5, 0x96, 0x5f, 0x04, 0xcc, 0xf5, 0xcc, 0x44, 0x44, 0x80, 0x02, 0x9d, 0x3f, 0x94, 0x60, 0x01, 0x20, 0xcc, 0x9a, 0x20, 0x02, 0x20, 0x44, 0x64,
+  0x82, 0x1f, 0x02, 0xcc, 0x64, 0x64, 0x81, 0xe7, 0x8f, 0x1f, 0x81, 0x17, 0x81, 0x1e, 0x03, 0x20, 0x20, 0x20, 0x64, 0x94, 0x1f, 0x80, 0x18, 0x83,
+  0x05, 0x92, 0x5e, 0x81, 0x1a, 0x81, 0x3b, 0x01, 0xe0, 0x20, 0x8f, 0x1f, 0x01, 0x20, 0x44, 0x82, 0x1f, 0x81, 0x20, 0x80, 0x1f, 0x91, 0x1e, 0x81,
+  0x1f, 0x01, 0xcc, 0xcc, 0x82, 0x7e, 0x92, 0x1e, 0x80, 0x1f, 0x80, 0x1e, 0x81, 0x20, 0x91, 0x7c, 0x86, 0x1e, 0x00, 0xcc, 0x90, 0xdb, 0x83, 0x7c,
+  0x80, 0x3a, 0x93, 0xfb, 0x00, 0x00, 0x81, 0xbb, 0x00, 0x44, 0x80, 0x1f, 0x01, 0x20, 0xcc, 0x81, 0xe0, 0x93, 0x1f, 0x81, 0x20, 0x80, 0x1f, 0x81,
+  0xdf, 0x8b, 0x5b, 0x80, 0x00, 0x80, 0x36, 0x04, 0xcc, 0xf5, 0xcc, 0x44, 0x64, 0x80, 0x08, 0x00, 0x00, 0x80, 0x03, 0x8b, 0x1f, 0x82, 0xb2, 0x80,
+  0x5c, 0x03, 0xf5, 0x20, 0x44, 0x20, 0x81, 0xdd, 0x00, 0xf5, 0x8c, 0xdf, 0x81, 0x40, 0x00, 0x20, 0x80, 0x96, 0x01, 0xf5, 0x44, 0x80, 0x48, 0x80,
+  0x20, 0x80, 0x28, 0x8d, 0x7f, 0x01, 0x00, 0x00, 0x82, 0x40, 0x00, 0xf5, 0x80, 0x80, 0x81, 0x81, 0x8e, 0xdf, 0x81, 0x20, 0x85, 0x00, 0x01, 0x00,
+  0x00, 0x8e, 0x1e, 0x83, 0x21, 0x85, 0x00, 0x91, 0x1e, 0x87, 0x21, 0x89, 0x12, 0x00, 0x1c, 0xf3, 0x00, 0x01, 0x20, 0x20, 0x9a, 0x17, 0x01, 0x20,
+  0xcc, 0x95, 0x1f, 0x83, 0x18, 0x01, 0x20, 0xf5, 0x95, 0x1f, 0x00, 0xf5, 0x81, 0x20, 0x01, 0x20, 0x64, 0x97, 0x1f, 0x00, 0x64, 0x80, 0x20, 0x01,
+  0x20, 0xcc, 0x98, 0x1f, 0x01, 0xf5, 0x64, 0x80, 0x3e, 0x96, 0x7f, 0x02, 0xf5, 0xcc, 0xf5, 0x81, 0x00, 0x97, 0x9f, 0x82, 0x1e, 0x00, 0xf5, 0x96,
+  0x5f, 0x04, 0xcc, 0xf5, 0xcc, 0x44, 0x44, 0x80, 0x02, 0x9d, 0x3f, 0x94, 0x60, 0x01, 0x20, 0xcc, 0x9a, 0x20, 0x02, 0x20, 0x44, 0x64, 0x82, 0x1f,
+  0x02, 0xcc, 0x64, 0x64, 0x81, 0xe7, 0x8f, 0x1f, 0x81, 0x17, 0x81, 0x1e, 0x03, 0x20, 0x20, 0x20, 0x64, 0x94, 0x1f, 0x80, 0x18, 0x83, 0x05, 0x92,
+  0x5e, 0x81, 0x1a, 0x81, 0x3b, 0x01, 0xe0, 0x20, 0x8f, 0x1f, 0x01, 0x20, 0x44, 0x82, 0x1f, 0x81, 0x20, 0x90, 0x1d, 0x81, 0x1e, 0x81, 0x1f, 0x01,
+  0xcc, 0xcc, 0x81, 0x7e, 0x93, 0x1e, 0x80, 0x1f, 0x80, 0x1e, 0x81, 0x20, 0x95, 0x3e, 0x82, 0x1e, 0x00, 0xcc, 0x90, 0xdb, 0x83, 0x7c, 0x80, 0x3a,
+  0x93, 0xfb, 0x00, 0x00, 0x81, 0xbb, 0x00, 0x44, 0x80, 0x1f, 0x01, 0x20, 0xcc, 0x81, 0xe0, 0x93, 0x1f, 0x81, 0x20, 0x80, 0x1f, 0x81, 0xdf, 0x8b,
+  0x5b, 0x80, 0x00, 0x80, 0x36, 0x04, 0xcc, 0xf5, 0xcc, 0x44, 0x64, 0x80, 0x08, 0x00, 0x00, 0x80, 0x03, 0x8b, 0x1f, 0x82, 0xb2, 0x80, 0x5c, 0x03,
+  0xf5, 0x20, 0x44, 0x20, 0x81, 0xdd, 0x00, 0xf5, 0x8c, 0xe0, 0x81, 0x40, 0x00, 0x20, 0x80, 0x96, 0x01, 0xf5, 0x44, 0x80, 0x48, 0x80, 0x20, 0x80,
+  0x28, 0x8d, 0x7f, 0x01, 0x00, 0x00, 0x82, 0x40, 0x00, 0xf5, 0x80, 0x80, 0x81, 0x81, 0x8e, 0xdf, 0x81, 0x20, 0x85, 0x00, 0x01, 0x00, 0x00, 0x8e,
+  0x1e, 0x83, 0x21, 0x85, 0x00, 0x91, 0x1e, 0x87, 0x21, 0x89, 0x12, 0x00, 0x1c, 0xf4, 0x00, 0x01, 0x20, 0x20, 0x9a, 0x15, 0x01, 0x20, 0xcc, 0x93,
+  0x1f, 0x85, 0x16, 0x01, 0x20, 0xf5, 0x93, 0x1f, 0x00, 0xf5, 0x83, 0x20, 0x01, 0x20, 0x64, 0x95, 0x1f, 0x00, 0x64, 0x81, 0x20, 0x01, 0x20, 0xcc,
+  0x84, 0x27, 0x90, 0x1f, 0x02, 0xf5, 0x64, 0x20, 0x80, 0x3d, 0x01, 0xcc, 0x64, 0x95, 0x5f, 0x00, 0xf5, 0x82, 0x00, 0x93, 0x3e, 0x81, 0x58, 0x80,
+  0x1b, 0x81, 0x02, 0x93, 0x1f, 0x82, 0x20, 0x00, 0x44, 0x81, 0x02, 0x9d, 0x1f, 0x01, 0xcc, 0x20, 0x93, 0x80, 0x00, 0xcc, 0x80, 0xba, 0x80, 0x5f,
+  0x01, 0x64, 0x64, 0x82, 0xc8, 0x8e, 0x1e, 0x01, 0x44, 0x64, 0x82, 0x81, 0x80, 0xc3, 0x00, 0x20, 0x91, 0xc1, 0x00, 0x20, 0x81, 0x37, 0x01, 0xf5,
+  0xf5, 0x80, 0x05, 0x92, 0x1e, 0x82, 0x1f, 0x80, 0x19, 0x83, 0x00, 0x92, 0x5e, 0x81, 0x20, 0x03, 0x20, 0x64, 0xe0, 0xe0, 0x92, 0x3d, 0x00, 0x44,
+  0x82, 0x1f, 0x81, 0x3f, 0x91, 0x20, 0x80, 0x1e, 0x81, 0x1f, 0x01, 0xcc, 0xcc, 0x82, 0x9e, 0x92, 0x1e, 0x80, 0x1f, 0x80, 0x1e, 0x81, 0x20, 0x92,
+  0x5d, 0x85, 0x1e, 0x00, 0xcc, 0x90, 0xfb, 0x83, 0x7c, 0x80, 0x3a, 0x00, 0xcc, 0x81, 0x06, 0x8e, 0x1f, 0x00, 0x00, 0x81, 0xbb, 0x00, 0x44, 0x80,
+  0x1f, 0x01, 0x20, 0xcc, 0x80, 0xe0, 0x8f, 0x5f, 0x82, 0x1f, 0x81, 0x20, 0x80, 0x1f, 0x80, 0xe0, 0x8b, 0x1f, 0x80, 0x11, 0x81, 0x36, 0x04, 0xcc,
+  0xf5, 0xcc, 0x44, 0x64, 0x80, 0x08, 0x00, 0x00, 0x80, 0x03, 0x8b, 0x1f, 0x82, 0xb2, 0x80, 0x5c, 0x03, 0xf5, 0x20, 0x44, 0x20, 0x81, 0xdd, 0x00,
+  0xf5, 0x8c, 0xdf, 0x81, 0x40, 0x00, 0x20, 0x80, 0x96, 0x01, 0xf5, 0x44, 0x80, 0x48, 0x80, 0x20, 0x80, 0x28, 0x8d, 0x7f, 0x01, 0x00, 0x00, 0x82,
+  0x40, 0x00, 0xf5, 0x80, 0x80, 0x81, 0x81, 0x8e, 0xdf, 0x81, 0x20, 0x85, 0x00, 0x01, 0x00, 0x00, 0x8e, 0x1e, 0x83, 0x21, 0x85, 0x00, 0x91, 0x1e,
+  0x87, 0x21, 0x89, 0x12, 0x00, 0x1c, 0xff, 0x00, 0xe3, 0x00, 0x00, 0x20, 0x80, 0x00, 0x8f, 0x0a, 0x88, 0x1f, 0x02, 0xcc, 0xcc, 0xcc, 0x82, 0x16,
+  0x00, 0x20, 0x82, 0x09, 0x90, 0x40, 0x01, 0x64, 0x64, 0x81, 0x21, 0x80, 0x1d, 0x01, 0x64, 0x64, 0x90, 0x1e, 0x81, 0x20, 0x02, 0xcc, 0xf5, 0xf5,
+  0x81, 0x02, 0x93, 0x1e, 0x80, 0x20, 0x00, 0xf5, 0x83, 0x00, 0x94, 0x1e, 0x9f, 0x1f, 0x01, 0x44, 0x44, 0x80, 0x1d, 0x01, 0x44, 0x44, 0x96, 0x1f,
+  0x84, 0x7f, 0x96, 0x1f, 0x01, 0x64, 0xf5, 0x80, 0xda, 0x00, 0xf5, 0x95, 0x9e, 0x81, 0x40, 0x81, 0xdf, 0x96, 0x1e, 0x80, 0x40, 0x00, 0x64, 0x81,
+  0x02, 0x95, 0x1e, 0x00, 0x00, 0x82, 0x3d, 0x02, 0x20, 0x20, 0x00, 0x97, 0x3e, 0x00, 0xcc, 0x80, 0x01, 0x95, 0x40, 0x02, 0x00, 0x20, 0x64, 0x80,
+  0x9e, 0x02, 0xcc, 0xcc, 0x64, 0x93, 0x40, 0x00, 0x00, 0x82, 0x1f, 0x81, 0x02, 0x01, 0x20, 0x00, 0x91, 0x20, 0x80, 0x1e, 0x00, 0x20, 0x80, 0x5c,
+  0x01, 0x64, 0xcc, 0x80, 0x07, 0x90, 0x1f, 0x80, 0x3e, 0x00, 0xcc, 0x80, 0x01, 0x80, 0x23, 0x80, 0x01, 0x90, 0x40, 0x80, 0x1f, 0x00, 0xf5, 0x84,
+  0xff, 0x00, 0xf5, 0xb4, 0x1f, 0x9d, 0x5f, 0x00, 0x20, 0x80, 0x39, 0x83, 0x03, 0x91, 0xc0, 0x81, 0x60, 0x80, 0x59, 0x82, 0x04, 0x92, 0xdf, 0x81,
+  0x41, 0x85, 0x04, 0x90, 0x1f, 0x81, 0x20, 0x85, 0x00, 0x91, 0x1e, 0x87, 0x21, 0x89, 0x12, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x82,
+  0x00, 0x00, 0x20, 0x83, 0x00, 0x96, 0x1d, 0x00, 0x44, 0x80, 0x00, 0x02, 0x64, 0x64, 0x64, 0x93, 0x22, 0x82, 0x1d, 0x06, 0x44, 0x44, 0x20, 0x20,
+  0x64, 0xcc, 0xcc, 0x80, 0x22, 0x80, 0x2e, 0x91, 0x1e, 0x02, 0x44, 0x20, 0xcc, 0x81, 0x20, 0x80, 0x21, 0x00, 0xcc, 0x94, 0x1f, 0x00, 0xf5, 0x80,
+  0x1a, 0x00, 0xcc, 0x80, 0x24, 0x00, 0xf5, 0x8a, 0x1f, 0x84, 0x1e, 0x80, 0x7c, 0x00, 0xf5, 0x82, 0x40, 0x01, 0x20, 0xcc, 0x8c, 0x1f, 0x82, 0x97,
+  0x81, 0x04, 0x02, 0xf5, 0x64, 0xcc, 0x80, 0xa0, 0x00, 0xcc, 0x8d, 0x3f, 0x80, 0x53, 0x80, 0x74, 0x80, 0x23, 0x80, 0x19, 0x02, 0xf5, 0xcc, 0xf5,
+  0x82, 0x25, 0x87, 0x1e, 0x00, 0x00, 0x80, 0x4f, 0x80, 0x16, 0x80, 0x3d, 0x82, 0x08, 0x81, 0x00, 0x00, 0xcc, 0x80, 0x0b, 0x89, 0x1f, 0x00, 0xcc,
+  0x80, 0x18, 0x80, 0x76, 0x01, 0x20, 0x20, 0x84, 0x1f, 0x80, 0x49, 0x89, 0x1f, 0x81, 0xd4, 0x83, 0x61, 0x04, 0x44, 0x44, 0xcc, 0xf5, 0xcc, 0x80,
+  0xc8, 0x80, 0x6b, 0x89, 0x1f, 0x81, 0x9e, 0x81, 0xd7, 0x81, 0x60, 0x82, 0x4a, 0x00, 0x64, 0x89, 0x7f, 0x80, 0x60, 0x01, 0x20, 0x00, 0x80, 0xb7,
+  0x80, 0x06, 0x01, 0x64, 0xf5, 0x81, 0x6b, 0x80, 0x27, 0x89, 0xc0, 0x80, 0x1f, 0x02, 0x64, 0x20, 0x00, 0x82, 0x26, 0x81, 0x02, 0x83, 0x06, 0x89,
+  0x1f, 0x82, 0x20, 0x80, 0x42, 0x81, 0x66, 0x80, 0x85, 0x81, 0x06, 0x89, 0x1f, 0x82, 0x20, 0x81, 0x62, 0x80, 0x78, 0x83, 0x00, 0x00, 0xcc, 0x88,
+  0xde, 0x84, 0x20, 0x80, 0x60, 0x80, 0xdd, 0x81, 0x06, 0x80, 0x0b, 0x80, 0x08, 0x8a, 0x1f, 0x80, 0x20, 0x81, 0x00, 0x82, 0x1d, 0x84, 0x08, 0x8b,
+  0x1f, 0x84, 0x20, 0x83, 0x00, 0x8c, 0x1a, 0x8c, 0x21, 0x88, 0x12, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xa2, 0x00, 0x00, 0x20, 0x84,
+  0x00, 0x95, 0x1d, 0x00, 0x44, 0x80, 0x00, 0x03, 0x20, 0x20, 0x64, 0x64, 0x82, 0x22, 0x8d, 0x26, 0x82, 0x1d, 0x80, 0x1f, 0x04, 0xcc, 0x20, 0x64,
+  0xcc, 0xcc, 0x80, 0x22, 0x00, 0xcc, 0x8b, 0x1f, 0x84, 0x1e, 0x06, 0x44, 0x20, 0xf5, 0x64, 0x20, 0xcc, 0xcc, 0x80, 0x24, 0x00, 0xf5, 0x8a, 0x1f,
+  0x84, 0x1e, 0x80, 0x5b, 0x00, 0xf5, 0x82, 0x40, 0x01, 0x20, 0xcc, 0x8c, 0x1f, 0x00, 0x64, 0x81, 0x76, 0x81, 0x04, 0x02, 0xf5, 0x64, 0xcc, 0x80,
+  0x7f, 0x00, 0xcc, 0x8d, 0x3f, 0x80, 0x53, 0x80, 0x75, 0x81, 0x77, 0x04, 0x64, 0xf5, 0xf5, 0xcc, 0xf5, 0x82, 0x25, 0x87, 0x1e, 0x00, 0x00, 0x80,
+  0x4f, 0x80, 0x16, 0x80, 0x3d, 0x82, 0x08, 0x81, 0x00, 0x00, 0xcc, 0x80, 0x0b, 0x89, 0x1f, 0x00, 0xcc, 0x80, 0x18, 0x80, 0x76, 0x01, 0x20, 0x20,
+  0x84, 0x1f, 0x8a, 0xc1, 0x00, 0x00, 0x81, 0x93, 0x84, 0x61, 0x04, 0x44, 0x44, 0xcc, 0xf5, 0xcc, 0x80, 0xc8, 0x80, 0x6b, 0x89, 0x1f, 0x81, 0x9e,
+  0x81, 0xd7, 0x81, 0x60, 0x82, 0x4a, 0x00, 0x64, 0x89, 0x7f, 0x80, 0x60, 0x01, 0x20, 0x00, 0x80, 0xb7, 0x80, 0x06, 0x01, 0x64, 0xf5, 0x81, 0x6b,
+  0x80, 0x27, 0x89, 0xc0, 0x80, 0x1f, 0x02, 0x64, 0x20, 0x00, 0x82, 0x26, 0x81, 0x02, 0x83, 0x06, 0x89, 0x1f, 0x82, 0x20, 0x80, 0x42, 0x81, 0x66,
+  0x80, 0x85, 0x81, 0x06, 0x89, 0x1f, 0x82, 0x20, 0x81, 0x62, 0x80, 0x78, 0x83, 0x00, 0x00, 0xcc, 0x88, 0xde, 0x84, 0x20, 0x80, 0x60, 0x80, 0xdd,
+  0x81, 0x06, 0x80, 0x0b, 0x80, 0x08, 0x8a, 0x1f, 0x80, 0x20, 0x81, 0x00, 0x82, 0x1d, 0x84, 0x08, 0x8b, 0x1f, 0x84, 0x20, 0x83, 0x00, 0x8c, 0x1a,
+  0x8c, 0x21, 0x88, 0x12, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xee, 0x00, 0x00, 0x1c,
+  0xf3, 0x00, 0x01, 0x20, 0x20, 0x9a, 0x17, 0x01, 0x20, 0xcc, 0x95, 0x1f, 0x83, 0x18, 0x01, 0x20, 0xf5, 0x95, 0x1f, 0x00, 0xf5, 0x81, 0x20, 0x01,
+  0x20, 0x64, 0x97, 0x1f, 0x00, 0x64, 0x80, 0x20, 0x01, 0x20, 0xcc, 0x98, 0x1f, 0x01, 0xf5, 0x64, 0x80, 0x3e, 0x96, 0x7f, 0x02, 0xf5, 0xcc, 0xf5,
+  0x81, 0x00, 0x97, 0x9f, 0x80, 0x1b, 0x81, 0x02, 0x98, 0x1f, 0x00, 0x44, 0x81, 0x02, 0x9d, 0x1f, 0x94, 0x60, 0x01, 0x20, 0xcc, 0x83, 0x7f, 0x94,
+  0x81, 0x02, 0x20, 0x44, 0x64, 0x82, 0x1f, 0x02, 0xcc, 0x64, 0x64, 0x81, 0xe7, 0x8f, 0x1f, 0x81, 0x17, 0x81, 0x1e, 0x03, 0x20, 0x20, 0x20, 0x64,
+  0x94, 0x1f, 0x80, 0x18, 0x83, 0x05, 0x92, 0x5e, 0x81, 0x1a, 0x81, 0x3b, 0x80, 0x05, 0x90, 0x1e, 0x82, 0x1f, 0x81, 0x20, 0x80, 0x00, 0x91, 0x1e,
+  0x81, 0x1f, 0x01, 0xcc, 0xcc, 0x81, 0x7e, 0x91, 0x5c, 0x82, 0x1f, 0x80, 0x1e, 0x81, 0x20, 0x93, 0x1f, 0x84, 0x1e, 0x00, 0xcc, 0x90, 0xdb, 0x83,
+  0x7c, 0x80, 0x3a, 0x93, 0xfb, 0x00, 0x00, 0x81, 0xbb, 0x00, 0x44, 0x80, 0x1f, 0x01, 0x20, 0xcc, 0x82, 0xbd, 0x8b, 0x3b, 0x01, 0x20, 0x20, 0x82,
+  0x1f, 0x81, 0x20, 0x80, 0x1f, 0x81, 0xdf, 0x8b, 0x1f, 0x83, 0x36, 0x04, 0xcc, 0xf5, 0xcc, 0x44, 0x64, 0x80, 0x08, 0x00, 0x00, 0x80, 0x03, 0x8c,
+  0x7c, 0x80, 0x75, 0x80, 0x03, 0x04, 0xcc, 0xf5, 0x20, 0x44, 0x20, 0x81, 0xdd, 0x00, 0xf5, 0x8d, 0xe0, 0x80, 0x53, 0x00, 0x20, 0x80, 0x96, 0x02,
+  0xf5, 0x44, 0x20, 0x80, 0x4b, 0x80, 0x43, 0x00, 0xf5, 0x8d, 0xa0, 0x02, 0x00, 0x00, 0x00, 0x82, 0x40, 0x00, 0xf5, 0x80, 0x69, 0x81, 0x81, 0x8e,
+  0xdf, 0x81, 0x20, 0x85, 0x00, 0x01, 0x00, 0x00, 0x8e, 0x1e, 0x83, 0x21, 0x85, 0x00, 0x91, 0x1e, 0x87, 0x21, 0x89, 0x12, 0x00, 0x1c, 0xff, 0x00,
+  0xb4, 0x00, 0x01, 0x20, 0x20, 0x9a, 0x17, 0x01, 0x20, 0xcc, 0x95, 0x1f, 0x83, 0x18, 0x01, 0x20, 0xf5, 0x95, 0x1f, 0x00, 0xf5, 0x81, 0x20, 0x01,
+  0x20, 0x64, 0x8a, 0x1f, 0x88, 0x6c, 0x02, 0x20, 0xf5, 0x64, 0x80, 0x20, 0x01, 0x20, 0xcc, 0x89, 0x1f, 0x89, 0x6c, 0x80, 0x1f, 0x01, 0xf5, 0x64,
+  0x80, 0x3e, 0x89, 0x7f, 0x8b, 0x1f, 0x01, 0xcc, 0xf5, 0x81, 0x00, 0x96, 0x1f, 0x80, 0x1e, 0x82, 0x02, 0x8a, 0x1f, 0x00, 0x64, 0x85, 0x0d, 0x00,
+  0x20, 0x81, 0x1f, 0x00, 0x44, 0x81, 0x02, 0x8a, 0x9f, 0x80, 0x20, 0x84, 0x00, 0x00, 0x64, 0x85, 0x1f, 0x89, 0x60, 0x02, 0x1c, 0x20, 0x44, 0x83,
+  0x00, 0x03, 0x64, 0xcc, 0x64, 0xcc, 0x83, 0x7f, 0x8c, 0x81, 0x8d, 0x1f, 0x02, 0xcc, 0x64, 0x64, 0x81, 0xe7, 0x86, 0x1f, 0x00, 0x64, 0x88, 0x1f,
+  0x81, 0x9e, 0x81, 0x6f, 0x86, 0x94, 0x80, 0x1e, 0x00, 0x64, 0x82, 0x20, 0x80, 0x33, 0x00, 0x64, 0x80, 0xfc, 0x80, 0x22, 0x81, 0x06, 0x89, 0xd4,
+  0x82, 0x12, 0x80, 0x1e, 0x81, 0x05, 0x81, 0x2d, 0x81, 0x1e, 0x8c, 0xf4, 0x82, 0x72, 0x80, 0x05, 0x85, 0xc9, 0x8a, 0x1e, 0x00, 0xcc, 0x84, 0x13,
+  0x83, 0x5a, 0x88, 0xd9, 0x80, 0x1d, 0x80, 0x1e, 0x80, 0x8c, 0x82, 0x15, 0x81, 0x7b, 0x81, 0xb8, 0x00, 0x20, 0x80, 0x15, 0x88, 0x5b, 0x80, 0x0b,
+  0x84, 0x0f, 0x00, 0x20, 0x81, 0x49, 0x81, 0x11, 0x86, 0xdc, 0x80, 0x09, 0x82, 0x0a, 0x00, 0x00, 0x82, 0x00, 0x81, 0x4b, 0x81, 0x51, 0x80, 0x86,
+  0x86, 0x5e, 0x83, 0x07, 0x83, 0x1f, 0x05, 0x00, 0x20, 0xf5, 0x20, 0x00, 0x00, 0x80, 0x14, 0x8b, 0x83, 0x85, 0x1d, 0x81, 0x1f, 0x02, 0xcc, 0x20,
+  0x00, 0x8b, 0x1b, 0x8a, 0x1f, 0x80, 0x20, 0x81, 0x8e, 0x98, 0x1f, 0x87, 0x7a, 0x94, 0x20, 0x91, 0x1e, 0x88, 0x1f, 0x90, 0x7d, 0x89, 0x21, 0x8a,
+  0x13, 0x00, 0x1c, 0xff, 0x00, 0xd4, 0x00, 0x01, 0x20, 0x20, 0x9a, 0x17, 0x01, 0x20, 0xcc, 0x95, 0x1f, 0x83, 0x18, 0x01, 0x20, 0xf5, 0x95, 0x1f,
+  0x00, 0xf5, 0x81, 0x20, 0x01, 0x20, 0x64, 0x97, 0x1f, 0x00, 0x64, 0x80, 0x20, 0x01, 0x20, 0xcc, 0x98, 0x1f, 0x01, 0xf5, 0x64, 0x80, 0x3e, 0x86,
+  0x7f, 0x00, 0x20, 0x80, 0x00, 0x8b, 0x5f, 0x00, 0xf5, 0x81, 0x00, 0x87, 0x1f, 0x02, 0xcc, 0xcc, 0x64, 0x88, 0x20, 0x80, 0x59, 0x81, 0x21, 0x88,
+  0x5f, 0x01, 0x20, 0x20, 0x80, 0x20, 0x87, 0x0d, 0x80, 0x1c, 0x00, 0x44, 0x81, 0x02, 0x8a, 0x33, 0x81, 0x21, 0x83, 0x00, 0x00, 0x64, 0x85, 0x1f,
+  0x86, 0x60, 0x81, 0x20, 0x01, 0x64, 0x44, 0x83, 0x00, 0x03, 0x64, 0xcc, 0x64, 0xcc, 0x83, 0x7f, 0x88, 0x81, 0x91, 0x1f, 0x02, 0xcc, 0x64, 0x64,
+  0x81, 0xe7, 0x86, 0x1f, 0x84, 0x20, 0x82, 0x1f, 0x81, 0x9e, 0x81, 0x6f, 0x87, 0xb6, 0x80, 0x1f, 0x82, 0x20, 0x80, 0x33, 0x00, 0x64, 0x80, 0xfc,
+  0x80, 0x22, 0x81, 0x06, 0x89, 0x5f, 0x82, 0x12, 0x80, 0x1e, 0x81, 0x05, 0x81, 0x2d, 0x81, 0x1e, 0x88, 0x1f, 0x80, 0x1e, 0x82, 0x1a, 0x81, 0x05,
+  0x85, 0xc9, 0x8b, 0xe0, 0x80, 0xae, 0x81, 0x00, 0x83, 0x5a, 0x87, 0x19, 0x86, 0x5f, 0x00, 0xf5, 0x82, 0x6f, 0x81, 0x68, 0x88, 0xb7, 0x88, 0x40,
+  0x00, 0xf5, 0x80, 0x3c, 0x01, 0x00, 0x00, 0x80, 0x3f, 0x02, 0x20, 0x20, 0xf5, 0x8e, 0x1f, 0x03, 0x00, 0x20, 0x64, 0xf5, 0x80, 0x1d, 0x80, 0x1e,
+  0x80, 0x06, 0x91, 0x1f, 0x81, 0x14, 0x81, 0x1f, 0x80, 0x85, 0x82, 0x24, 0x8f, 0x1f, 0x81, 0x39, 0x86, 0x25, 0x8f, 0x1f, 0x80, 0x20, 0x81, 0x1f,
+  0x81, 0x83, 0x81, 0x06, 0x8f, 0x60, 0x80, 0x14, 0x81, 0x1a, 0x82, 0x00, 0x8e, 0xbe, 0x82, 0x20, 0x99, 0x1e, 0x88, 0x22, 0x8a, 0x13, 0x00, 0x1c,
+  0xff, 0x00, 0xff, 0x00, 0x92, 0x00, 0x01, 0x20, 0x20, 0x9a, 0x17, 0x01, 0x20, 0xcc, 0x95, 0x1f, 0x83, 0x18, 0x01, 0x20, 0xf5, 0x95, 0x1f, 0x00,
+  0xf5, 0x81, 0x20, 0x01, 0x20, 0x64, 0x97, 0x1f, 0x00, 0x64, 0x80, 0x20, 0x01, 0x20, 0xcc, 0x98, 0x1f, 0x01, 0xf5, 0x64, 0x80, 0x3e, 0x96, 0x7f,
+  0x02, 0xf5, 0xcc, 0xf5, 0x81, 0x00, 0x86, 0x1f, 0x00, 0x20, 0x81, 0x00, 0x89, 0x9f, 0x80, 0x1b, 0x81, 0x02, 0x86, 0x1f, 0x03, 0xcc, 0xcc, 0xcc,
+  0x64, 0x87, 0x21, 0x81, 0x1f, 0x00, 0x44, 0x81, 0x02, 0x87, 0x11, 0x00, 0x20, 0x80, 0x22, 0x80, 0x21, 0x83, 0x00, 0x00, 0x64, 0x85, 0x1f, 0x89,
+  0x80, 0x01, 0x20, 0x44, 0x84, 0x00, 0x03, 0x64, 0xcc, 0x64, 0xcc, 0x83, 0x7f, 0x88, 0x81, 0x91, 0x1f, 0x02, 0xcc, 0x64, 0x64, 0x81, 0xe7, 0x85,
+  0x1f, 0x00, 0x64, 0x89, 0x1f, 0x81, 0x9e, 0x81, 0x6f, 0x00, 0x64, 0x88, 0x1f, 0x83, 0x20, 0x80, 0x33, 0x00, 0x64, 0x80, 0xfc, 0x81, 0xb1, 0x80,
+  0x06, 0x88, 0x5f, 0x82, 0x11, 0x81, 0x52, 0x81, 0x06, 0x80, 0x2d, 0x82, 0x1e, 0x8b, 0x1f, 0x81, 0x52, 0x82, 0x39, 0x85, 0xc9, 0x88, 0xbf, 0x81,
+  0x20, 0x81, 0x92, 0x01, 0x20, 0x20, 0x82, 0x99, 0x89, 0x19, 0x82, 0x00, 0x00, 0x00, 0x81, 0x1f, 0x00, 0xf5, 0x81, 0x58, 0x81, 0x9b, 0x8f, 0x1e,
+  0x00, 0x00, 0x81, 0x59, 0x81, 0x1f, 0x83, 0x58, 0x00, 0x00, 0x8e, 0x1f, 0x02, 0x00, 0x20, 0x20, 0x82, 0x39, 0x00, 0x20, 0x80, 0x0a, 0x81, 0x00,
+  0x8e, 0x3f, 0x81, 0x1b, 0x82, 0x21, 0x91, 0x1f, 0x80, 0x7f, 0x81, 0x39, 0x83, 0x5b, 0x91, 0x1f, 0x81, 0x61, 0x89, 0x00, 0x8d, 0x1e, 0x8a, 0x23,
+  0x89, 0x13, 0x00, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xee, 0x00,
+};
+const PackedSheet packedDogsAlt = {32, 32, 4, 9, packedDogsAltOffsets, packedDogsAltData, NULL};
+
+// smallBg.h: 120x120 frames, 1 across, 1 down; 10081 bytes, from 28800
+static const uint32_t packedBgOffsets[] PROGMEM = {
+  0, 10081,
+};
+static const uint8_t packedBgData[] PROGMEM = {
+  0x03, 0x5d, 0x7e, 0xbe, 0xdf, 0x85, 0x00, 0x18, 0x4d, 0x71, 0x4d, 0x04, 0x2d, 0x31, 0x08, 0x08, 0x08, 0x2d, 0x08, 0x04, 0x04, 0x08, 0x08, 0x04,
+  0x29, 0x0d, 0x11, 0x3a, 0x39, 0x39, 0x39, 0x5d, 0x5e, 0x86, 0x21, 0x81, 0x00, 0x06, 0x76, 0x56, 0x0d, 0x32, 0x32, 0x32, 0x36, 0x80, 0x00, 0x0a,
+  0x3a, 0x3a, 0x3a, 0x36, 0x12, 0x16, 0x3a, 0x39, 0x5d, 0x7d, 0x39, 0x80, 0x0a, 0x05, 0x35, 0x5a, 0x7a, 0xbf, 0xff, 0xff, 0x81, 0x21, 0x00, 0xff,
+  0x80, 0x06, 0x06, 0x56, 0x12, 0x12, 0x11, 0x11, 0x36, 0xbf, 0x8a, 0x39, 0x89, 0x00, 0x03, 0x3d, 0x5d, 0x7e, 0xde, 0x87, 0x0d, 0x01, 0x4d, 0x04,
+  0x80, 0x71, 0x80, 0x73, 0x81, 0x76, 0x0b, 0x31, 0x08, 0x04, 0x31, 0x2d, 0x31, 0x3a, 0x3a, 0x39, 0x7d, 0x39, 0x5a, 0x88, 0x75, 0x02, 0x32, 0x32,
+  0x2e, 0x80, 0x76, 0x82, 0x77, 0x03, 0x36, 0x3a, 0x39, 0x3a, 0x82, 0x05, 0x00, 0x5d, 0x80, 0x77, 0x82, 0x10, 0x01, 0x5a, 0x56, 0x80, 0x73, 0x05,
+  0xff, 0x9b, 0x56, 0x56, 0x56, 0x12, 0x81, 0x22, 0x00, 0x3a, 0x87, 0x38, 0x82, 0x90, 0x88, 0x00, 0x05, 0x39, 0x7e, 0x5d, 0x7e, 0x5d, 0xbe, 0x84,
+  0x15, 0x03, 0x29, 0x04, 0x04, 0x09, 0x81, 0x77, 0x80, 0x00, 0x09, 0x0d, 0x31, 0x31, 0x11, 0x04, 0x08, 0x35, 0x30, 0x08, 0x15, 0x81, 0x78, 0x81,
+  0x40, 0x80, 0x23, 0x00, 0x9f, 0x81, 0x71, 0x82, 0x00, 0x82, 0x65, 0x80, 0x71, 0x83, 0x78, 0x02, 0x3d, 0x3d, 0x3a, 0x80, 0xfc, 0x82, 0x11, 0x80,
+  0x00, 0x04, 0x36, 0x36, 0x32, 0x32, 0x12, 0x81, 0x21, 0x80, 0xb3, 0x00, 0x7e, 0x84, 0x59, 0x01, 0xff, 0x96, 0x8c, 0x78, 0x00, 0x7e, 0x81, 0x00,
+  0x02, 0x5d, 0x59, 0xbf, 0x82, 0x0c, 0x01, 0x00, 0x08, 0x81, 0xe9, 0x82, 0x77, 0x0e, 0x35, 0x08, 0x0d, 0x31, 0x0d, 0x08, 0x08, 0x39, 0x11, 0x29,
+  0x09, 0x3a, 0x39, 0x59, 0x3d, 0x81, 0x60, 0x02, 0x32, 0x31, 0x0e, 0x87, 0x74, 0x82, 0x60, 0x02, 0x3a, 0x3a, 0x3d, 0x81, 0x78, 0x80, 0x5f, 0x83,
+  0xee, 0x81, 0x0a, 0x80, 0x04, 0x87, 0x97, 0x85, 0xf0, 0x03, 0xff, 0x29, 0x28, 0x96, 0x81, 0x06, 0x81, 0x00, 0x83, 0x11, 0x0e, 0x5d, 0x7e, 0x59,
+  0x5d, 0x7e, 0x7e, 0x59, 0x39, 0x5a, 0xdf, 0xbf, 0xdf, 0x08, 0x09, 0x0d, 0x80, 0x74, 0x00, 0x2d, 0x82, 0x7a, 0x11, 0x39, 0x08, 0x31, 0x31, 0x35,
+  0x08, 0x04, 0x30, 0x39, 0x2d, 0x04, 0x36, 0x36, 0x39, 0x39, 0x39, 0x36, 0x16, 0x81, 0x4e, 0x87, 0xed, 0x80, 0x76, 0x00, 0x39, 0x81, 0x03, 0x83,
+  0xf0, 0x86, 0x75, 0x8c, 0x76, 0x02, 0x3a, 0x5d, 0xbe, 0x83, 0x77, 0x0a, 0x00, 0x09, 0x04, 0xb7, 0xff, 0xff, 0x00, 0x24, 0x24, 0x25, 0x00, 0x83,
+  0x77, 0x03, 0x3d, 0x7d, 0x5d, 0x5e, 0x80, 0x78, 0x16, 0x39, 0x3d, 0x19, 0x35, 0x04, 0x55, 0x0d, 0x31, 0x08, 0x08, 0x0d, 0x35, 0x04, 0x08, 0x2d,
+  0x0c, 0x04, 0x31, 0x08, 0x31, 0x0c, 0x35, 0x31, 0x80, 0xf8, 0x00, 0x0d, 0x84, 0x44, 0x87, 0x75, 0x84, 0x76, 0x82, 0x73, 0x81, 0x69, 0x84, 0x20,
+  0x83, 0x00, 0x00, 0x12, 0x86, 0x75, 0x83, 0xef, 0x01, 0x7e, 0xdf, 0x80, 0xe0, 0x01, 0xff, 0x00, 0x80, 0xca, 0x06, 0xdb, 0x04, 0x00, 0x04, 0x29,
+  0x09, 0x00, 0x84, 0xef, 0x18, 0x39, 0x5d, 0x7e, 0x3a, 0x3a, 0x5e, 0x5d, 0x5d, 0x3e, 0x35, 0x08, 0x11, 0x55, 0x31, 0x2d, 0x08, 0x08, 0x35, 0x0d,
+  0x08, 0x0c, 0x31, 0x08, 0x04, 0x0d, 0x80, 0x04, 0x04, 0x35, 0x55, 0x31, 0x04, 0x09, 0x82, 0x46, 0x88, 0x74, 0x83, 0x56, 0x81, 0x77, 0x81, 0x00,
+  0x82, 0xea, 0x88, 0x78, 0x86, 0x97, 0x80, 0x21, 0x83, 0x25, 0x00, 0x9e, 0x82, 0xee, 0x01, 0x08, 0x04, 0x80, 0x75, 0x80, 0x7c, 0x00, 0x04, 0x85,
+  0x77, 0x03, 0x3a, 0x5d, 0x7e, 0x39, 0x80, 0x1d, 0x04, 0x59, 0x0c, 0x31, 0x35, 0x31, 0x80, 0xed, 0x11, 0x04, 0x0d, 0x39, 0x08, 0x08, 0x31, 0x35,
+  0x35, 0x08, 0x04, 0x0c, 0x0c, 0x08, 0x39, 0x0c, 0x35, 0x35, 0x2d, 0x80, 0x78, 0x8d, 0x00, 0x82, 0x78, 0x82, 0x54, 0x83, 0x76, 0x85, 0x13, 0x85,
+  0x07, 0x88, 0x97, 0x80, 0x59, 0x80, 0x78, 0x80, 0xef, 0x01, 0x04, 0x00, 0x80, 0x03, 0x80, 0x00, 0x00, 0x49, 0x83, 0x76, 0x04, 0xdf, 0x3a, 0x39,
+  0x7e, 0x5d, 0x80, 0x3f, 0x19, 0x09, 0x2d, 0x59, 0x11, 0x04, 0x04, 0x2d, 0x2d, 0x55, 0x59, 0x10, 0x04, 0x04, 0x31, 0x35, 0x59, 0x0d, 0x2d, 0x04,
+  0x08, 0x08, 0x0c, 0x55, 0x08, 0x0d, 0x08, 0x90, 0x78, 0x00, 0x12, 0x87, 0xdf, 0x86, 0xe3, 0x80, 0x15, 0x80, 0x01, 0x86, 0x13, 0x84, 0x74, 0x81,
+  0xf5, 0x04, 0x3a, 0xbe, 0xdf, 0xff, 0xb6, 0x80, 0x75, 0x00, 0x00, 0x81, 0x03, 0x00, 0x6d, 0x84, 0x76, 0x01, 0xdf, 0x3a, 0x80, 0xf0, 0x02, 0x5e,
+  0x3a, 0x5a, 0x80, 0x65, 0x80, 0x8c, 0x01, 0x2d, 0x08, 0x80, 0x00, 0x81, 0x77, 0x02, 0x0c, 0x39, 0x0c, 0x81, 0x0f, 0x05, 0x31, 0x08, 0x0d, 0x04,
+  0x31, 0x0d, 0x94, 0xf1, 0x84, 0x74, 0x00, 0x12, 0x87, 0x14, 0x88, 0x8f, 0x87, 0xef, 0x0d, 0x3a, 0x19, 0x3a, 0x9e, 0xdf, 0xff, 0xbb, 0x00, 0x04,
+  0x20, 0x00, 0x00, 0x25, 0xdb, 0x85, 0x76, 0x00, 0xdf, 0x80, 0x22, 0x03, 0x5e, 0x5d, 0x5d, 0x5a, 0x80, 0x1f, 0x81, 0x63, 0x00, 0x31, 0x81, 0x6d,
+  0x06, 0x08, 0x35, 0x35, 0x0d, 0x31, 0x08, 0x29, 0x80, 0x09, 0x00, 0x04, 0x80, 0xef, 0x05, 0x08, 0x55, 0x10, 0x08, 0x0d, 0x2e, 0x8e, 0xf2, 0x8e,
+  0x8a, 0x01, 0x12, 0x36, 0x80, 0x8d, 0x81, 0xe0, 0x80, 0xe2, 0x80, 0x08, 0x03, 0x39, 0x39, 0x3a, 0x3a, 0x80, 0x02, 0x80, 0x04, 0x0c, 0x39, 0x3a,
+  0x39, 0x9e, 0xdf, 0xfb, 0x00, 0x44, 0x24, 0x20, 0x20, 0x24, 0xff, 0x88, 0x77, 0x0d, 0x36, 0x39, 0x5d, 0x7e, 0x7d, 0x5d, 0x39, 0x36, 0x08, 0x2d,
+  0x11, 0x35, 0x35, 0x08, 0x80, 0xf8, 0x05, 0x00, 0x08, 0x35, 0x0d, 0x0d, 0x08, 0x83, 0x82, 0x01, 0x2d, 0x2d, 0x80, 0x86, 0x03, 0x31, 0x0d, 0x08,
+  0x0d, 0x8f, 0xf3, 0x8d, 0x00, 0x88, 0xe5, 0x87, 0x77, 0x03, 0x36, 0x3a, 0x5d, 0x5d, 0x80, 0x08, 0x0a, 0x9e, 0xff, 0xdb, 0x20, 0x24, 0x24, 0x44,
+  0x44, 0x00, 0x91, 0xff, 0x84, 0x7a, 0x83, 0x9c, 0x00, 0x31, 0x80, 0x70, 0x0a, 0x31, 0x35, 0x35, 0x35, 0x31, 0x04, 0x04, 0x31, 0x08, 0x08, 0x31,
+  0x80, 0xf7, 0x01, 0x08, 0x2d, 0x80, 0x0b, 0x09, 0x04, 0x04, 0x0c, 0x31, 0x0d, 0x04, 0x09, 0x08, 0x0d, 0x09, 0xa2, 0x77, 0x83, 0xde, 0x00, 0x3d,
+  0x83, 0x78, 0x00, 0x3e, 0x80, 0x0b, 0x00, 0x5e, 0x80, 0x0a, 0x16, 0x5e, 0x5d, 0x5e, 0x39, 0x39, 0x39, 0x7a, 0xff, 0xff, 0x6d, 0x49, 0x00, 0x44,
+  0x44, 0x20, 0x00, 0x92, 0x72, 0x7a, 0xdf, 0xdf, 0xff, 0xbb, 0x80, 0x25, 0x01, 0x36, 0x2d, 0x81, 0xdd, 0x05, 0x08, 0x0c, 0x0c, 0x31, 0x2c, 0x31,
+  0x80, 0x7d, 0x09, 0x2d, 0x08, 0x0c, 0x0d, 0x59, 0x04, 0x0d, 0x0d, 0x31, 0x0c, 0x80, 0xf1, 0x07, 0x08, 0x2d, 0x35, 0x0c, 0x04, 0x08, 0x31, 0x2d,
+  0xa2, 0xee, 0x80, 0x78, 0x05, 0x39, 0x3d, 0x3d, 0x3a, 0x3d, 0x39, 0x81, 0x77, 0x0a, 0x3d, 0x3a, 0x16, 0x5d, 0x7e, 0x39, 0x3a, 0x1a, 0x3a, 0x3d,
+  0x59, 0x81, 0x78, 0x00, 0x5a, 0x80, 0x79, 0x13, 0x92, 0x4d, 0x44, 0x24, 0x48, 0x20, 0x40, 0x31, 0x76, 0x5a, 0xff, 0x00, 0x39, 0x39, 0x3a, 0x11,
+  0x09, 0x35, 0x31, 0x2d, 0x80, 0xe8, 0x00, 0x2d, 0x80, 0x7b, 0x03, 0x04, 0x35, 0x10, 0x0c, 0x80, 0x6d, 0x00, 0x35, 0x80, 0x0a, 0x0a, 0x2c, 0x35,
+  0x08, 0x04, 0x08, 0x08, 0x09, 0x0d, 0x39, 0x0c, 0x04, 0x82, 0xed, 0x00, 0x2e, 0x83, 0x00, 0x9c, 0x79, 0x80, 0x74, 0x02, 0x39, 0x3d, 0x39, 0x81,
+  0x81, 0x04, 0x39, 0x3a, 0x3a, 0x5d, 0x7e, 0x80, 0xf0, 0x04, 0x3a, 0x39, 0x5d, 0x39, 0x59, 0x81, 0x8a, 0x05, 0x36, 0x56, 0x12, 0x29, 0x24, 0x40,
+  0x80, 0xf3, 0x0a, 0x44, 0x35, 0x5e, 0x04, 0x5e, 0x7e, 0x59, 0x08, 0x31, 0x0c, 0x2c, 0x80, 0x6a, 0x01, 0x35, 0x0d, 0x81, 0x70, 0x01, 0x35, 0x08,
+  0x80, 0x82, 0x80, 0x6f, 0x04, 0x0d, 0x0d, 0x2d, 0x39, 0x31, 0x81, 0xf0, 0x05, 0x09, 0x31, 0x35, 0x0d, 0x09, 0x36, 0x87, 0x77, 0x85, 0x7b, 0x88,
+  0x0e, 0x84, 0x8c, 0x00, 0x12, 0x81, 0x79, 0x81, 0x6e, 0x01, 0x39, 0x3d, 0x81, 0x6e, 0x00, 0x5d, 0x80, 0x08, 0x80, 0xc3, 0x80, 0x00, 0x00, 0x35,
+  0x80, 0x09, 0x80, 0x77, 0x00, 0x3a, 0x80, 0x9a, 0x0d, 0x32, 0x51, 0x24, 0x24, 0x44, 0x44, 0x24, 0x28, 0x76, 0x39, 0x5e, 0x35, 0x08, 0x0d, 0x80,
+  0x6a, 0x02, 0x2d, 0x35, 0x0d, 0x80, 0xde, 0x02, 0x31, 0x0c, 0x39, 0x84, 0x77, 0x0e, 0x0c, 0x08, 0x31, 0x39, 0x35, 0x0d, 0x31, 0x2c, 0x08, 0x09,
+  0x04, 0x0d, 0x08, 0x08, 0x3a, 0x80, 0x78, 0x8a, 0x68, 0x8f, 0x00, 0x85, 0xf2, 0x80, 0x78, 0x02, 0x39, 0x5d, 0x3a, 0x80, 0xf0, 0x00, 0x5e, 0x80,
+  0x81, 0x06, 0x7e, 0x04, 0x0d, 0x09, 0x09, 0x04, 0x00, 0x80, 0x0e, 0x00, 0x20, 0x85, 0x00, 0x0f, 0x40, 0x20, 0x20, 0x44, 0x44, 0x44, 0x00, 0x39,
+  0x39, 0x35, 0x2d, 0x24, 0x04, 0x04, 0x09, 0x31, 0x80, 0x6f, 0x03, 0x08, 0x31, 0x31, 0x0c, 0x81, 0x7e, 0x80, 0x76, 0x80, 0xf0, 0x03, 0x31, 0x31,
+  0x35, 0x35, 0x81, 0x83, 0x82, 0xfd, 0x02, 0x3a, 0x36, 0x12, 0x9c, 0x77, 0x80, 0x78, 0x82, 0xf0, 0x80, 0xda, 0x07, 0x3a, 0x7d, 0x39, 0x36, 0x36,
+  0x35, 0x59, 0x59, 0x80, 0x0b, 0x01, 0x5e, 0x00, 0x81, 0x40, 0x02, 0x00, 0x20, 0x20, 0x80, 0xe5, 0x00, 0x44, 0x81, 0x03, 0x01, 0x44, 0x00, 0x80,
+  0x00, 0x80, 0x0a, 0x04, 0x39, 0x39, 0x39, 0x3d, 0x35, 0x81, 0x5a, 0x81, 0x5f, 0x03, 0x39, 0x0d, 0x0d, 0x31, 0x81, 0x08, 0x80, 0x0a, 0x04, 0x2d,
+  0x35, 0x35, 0x0c, 0x31, 0x80, 0x0c, 0x02, 0x08, 0x08, 0x31, 0x80, 0x0c, 0x01, 0x2d, 0x35, 0xa2, 0xf0, 0x00, 0x12, 0x80, 0x77, 0x00, 0x35, 0x80,
+  0x77, 0x01, 0x59, 0x5e, 0x81, 0xf8, 0x05, 0x7e, 0x35, 0x3a, 0x3a, 0x39, 0x56, 0x80, 0x66, 0x04, 0x40, 0x20, 0x24, 0x20, 0x40, 0x80, 0x6b, 0x81,
+  0x00, 0x80, 0x87, 0x82, 0x78, 0x80, 0x1f, 0x01, 0x15, 0x3a, 0x80, 0x6b, 0x80, 0xe6, 0x05, 0x09, 0x31, 0x0c, 0x09, 0x0c, 0x09, 0x82, 0xdf, 0x81,
+  0x6e, 0x03, 0x0c, 0x0d, 0x0d, 0x59, 0x81, 0x78, 0x07, 0x31, 0x31, 0x04, 0x0d, 0x31, 0x0d, 0x15, 0x36, 0x9e, 0xef, 0x02, 0x0e, 0x12, 0x32, 0x80,
+  0xf0, 0x80, 0xc8, 0x80, 0x72, 0x80, 0xf0, 0x80, 0x05, 0x02, 0x36, 0x3a, 0x31, 0x81, 0xde, 0x02, 0x28, 0x20, 0x29, 0x80, 0x6f, 0x06, 0x00, 0x24,
+  0x29, 0x29, 0x29, 0x04, 0x08, 0x81, 0x76, 0x02, 0x00, 0x20, 0x24, 0x82, 0x28, 0x80, 0xd1, 0x00, 0x31, 0x80, 0x70, 0x01, 0x08, 0x2d, 0x81, 0xf6,
+  0x03, 0x08, 0x0d, 0x2d, 0x2d, 0x80, 0x77, 0x05, 0x2d, 0x04, 0x35, 0x08, 0x35, 0x35, 0x80, 0x77, 0x0a, 0x0c, 0x35, 0x55, 0x00, 0x2d, 0x04, 0x59,
+  0x36, 0x32, 0x0e, 0x0e, 0x9b, 0x78, 0x00, 0x0e, 0x80, 0xf1, 0x81, 0x6e, 0x80, 0x73, 0x00, 0x59, 0x82, 0x77, 0x01, 0x39, 0x3a, 0x80, 0xc4, 0x80,
+  0x65, 0x0b, 0x08, 0x00, 0x56, 0x32, 0x00, 0x09, 0x04, 0x32, 0x16, 0x36, 0x1a, 0x2d, 0x80, 0x50, 0x80, 0x13, 0x81, 0x77, 0x06, 0x35, 0x35, 0x36,
+  0x05, 0x2c, 0x35, 0x35, 0x80, 0xf0, 0x81, 0xe8, 0x81, 0x77, 0x00, 0x31, 0x80, 0xe6, 0x80, 0x1e, 0x81, 0x77, 0x0a, 0x35, 0x2d, 0x08, 0x2d, 0x11,
+  0x35, 0x31, 0x2c, 0x0d, 0x0d, 0x3a, 0x80, 0x78, 0x00, 0x12, 0x9e, 0x78, 0x80, 0x6e, 0x80, 0x6f, 0x02, 0x16, 0x39, 0x5d, 0x80, 0x07, 0x80, 0x53,
+  0x00, 0x04, 0x80, 0xcd, 0x81, 0x7a, 0x04, 0x59, 0x31, 0x00, 0x0d, 0x00, 0x80, 0x1c, 0x00, 0x16, 0x80, 0xd9, 0x0f, 0x08, 0x00, 0x00, 0x09, 0x35,
+  0x24, 0x35, 0x15, 0x36, 0x36, 0x09, 0x11, 0x39, 0x31, 0x2d, 0x31, 0x80, 0x8a, 0x81, 0x75, 0x05, 0x04, 0x2d, 0x0d, 0x31, 0x35, 0x0c, 0x83, 0x0a,
+  0x02, 0x39, 0x0c, 0x31, 0x80, 0x06, 0x09, 0x31, 0x0d, 0x10, 0x30, 0x04, 0x00, 0x39, 0x35, 0x36, 0x32, 0x9c, 0x77, 0x80, 0x78, 0x00, 0x36, 0x80,
+  0x5c, 0x80, 0xf0, 0x00, 0x35, 0x80, 0x03, 0x03, 0x11, 0x0d, 0x0d, 0x11, 0x80, 0x77, 0x81, 0xde, 0x02, 0x00, 0x39, 0x59, 0x81, 0xef, 0x80, 0x1b,
+  0x00, 0x2d, 0x80, 0x75, 0x13, 0x36, 0x00, 0x31, 0x3a, 0x00, 0x39, 0x15, 0x31, 0x08, 0x0c, 0x35, 0x39, 0x0c, 0x08, 0x31, 0x08, 0x2d, 0x04, 0x04,
+  0x29, 0x80, 0x8f, 0x02, 0x35, 0x04, 0x31, 0x83, 0xfc, 0x05, 0x04, 0x04, 0x35, 0x0c, 0x08, 0x04, 0x80, 0xa0, 0x05, 0x08, 0x0d, 0x2d, 0x29, 0x04,
+  0x35, 0x80, 0x78, 0x83, 0x77, 0x00, 0x0e, 0x8b, 0x00, 0x89, 0x78, 0x00, 0x32, 0x82, 0xf1, 0x00, 0x39, 0x80, 0x2a, 0x80, 0x75, 0x82, 0x77, 0x00,
+  0x08, 0x81, 0xed, 0x23, 0x00, 0x39, 0x39, 0x28, 0x35, 0x09, 0x32, 0x12, 0x36, 0x3a, 0x09, 0x00, 0x5a, 0x3a, 0x15, 0x00, 0x31, 0x28, 0x00, 0x15,
+  0x51, 0x08, 0x35, 0x35, 0x39, 0x31, 0x0d, 0x08, 0x09, 0x04, 0x28, 0x08, 0x08, 0x2d, 0x0d, 0x08, 0x80, 0x80, 0x02, 0x0d, 0x35, 0x31, 0x80, 0x6f,
+  0x80, 0x7b, 0x81, 0xf6, 0x81, 0x77, 0x80, 0xb2, 0x80, 0x4b, 0x00, 0x35, 0x80, 0x4d, 0x8f, 0x76, 0x8a, 0x78, 0x80, 0x77, 0x80, 0x78, 0x01, 0x35,
+  0x59, 0x82, 0x75, 0x81, 0x77, 0x80, 0x00, 0x09, 0x35, 0x19, 0x39, 0x00, 0x15, 0x15, 0x08, 0x5d, 0x31, 0x12, 0x80, 0x1a, 0x00, 0x0d, 0x80, 0x6c,
+  0x09, 0x35, 0x2d, 0x0d, 0x24, 0x00, 0x35, 0x08, 0x31, 0x2d, 0x0c, 0x80, 0xdf, 0x80, 0x5b, 0x80, 0x6a, 0x04, 0x0d, 0x35, 0x04, 0x04, 0x2d, 0x80,
+  0x11, 0x00, 0x2d, 0x80, 0x77, 0x01, 0x31, 0x31, 0x82, 0x14, 0x08, 0x04, 0x0d, 0x2d, 0x0d, 0x04, 0x51, 0x5e, 0x5a, 0x59, 0x80, 0x76, 0x80, 0xc5,
+  0x8f, 0x76, 0x8a, 0x82, 0x01, 0x0e, 0x12, 0x80, 0x79, 0x01, 0x31, 0x0c, 0x82, 0x74, 0x01, 0x0d, 0x11, 0x80, 0x77, 0x0d, 0x15, 0x11, 0x11, 0x15,
+  0x19, 0x04, 0x3d, 0x34, 0x08, 0x59, 0x7d, 0x11, 0x12, 0x36, 0x81, 0x00, 0x00, 0x35, 0x80, 0x77, 0x08, 0x28, 0x00, 0x11, 0x08, 0x2d, 0x08, 0x35,
+  0x0d, 0x29, 0x81, 0x60, 0x04, 0x08, 0x35, 0x31, 0x31, 0x39, 0x80, 0xe2, 0x80, 0x11, 0x80, 0x71, 0x03, 0x31, 0x11, 0x35, 0x31, 0x81, 0x15, 0x01,
+  0x04, 0x2d, 0x80, 0x08, 0x04, 0x0d, 0x2d, 0x35, 0x35, 0x59, 0x80, 0x79, 0x02, 0x35, 0x36, 0x12, 0x9b, 0x78, 0x00, 0x0e, 0x80, 0x6e, 0x84, 0xeb,
+  0x80, 0x76, 0x81, 0x73, 0x81, 0x78, 0x08, 0x00, 0x39, 0x59, 0x08, 0x38, 0x59, 0x59, 0x31, 0x12, 0x80, 0x74, 0x80, 0x79, 0x02, 0x2d, 0x09, 0x24,
+  0x80, 0x77, 0x01, 0x08, 0x08, 0x80, 0x6b, 0x05, 0x04, 0x31, 0x31, 0x31, 0x35, 0x35, 0x81, 0x02, 0x80, 0xe9, 0x81, 0x76, 0x03, 0x04, 0x11, 0x35,
+  0x0d, 0x80, 0x0c, 0x80, 0x08, 0x07, 0x08, 0x0d, 0x31, 0x35, 0x31, 0x0c, 0x08, 0x39, 0x83, 0x78, 0x01, 0x16, 0x32, 0x9a, 0x75, 0x87, 0x00, 0x82,
+  0x75, 0x03, 0x15, 0x18, 0x18, 0x15, 0x80, 0x00, 0x07, 0x04, 0x19, 0x39, 0x35, 0x79, 0x39, 0x59, 0x7d, 0x80, 0x3f, 0x80, 0x77, 0x06, 0x12, 0x09,
+  0x09, 0x25, 0x00, 0x11, 0x0d, 0x80, 0x73, 0x07, 0x04, 0x2d, 0x09, 0x31, 0x0c, 0x0c, 0x39, 0x0d, 0x80, 0x16, 0x80, 0x77, 0x81, 0xf0, 0x04, 0x04,
+  0x31, 0x35, 0x0c, 0x11, 0x81, 0x26, 0x02, 0x55, 0x0d, 0x09, 0x81, 0x16, 0x02, 0x59, 0x35, 0x09, 0x81, 0x0d, 0x80, 0x1f, 0x01, 0x31, 0x0d, 0x81,
+  0x5e, 0x84, 0x64, 0x82, 0x68, 0x80, 0x09, 0x00, 0x2e, 0x82, 0x05, 0x8c, 0x75, 0x81, 0x77, 0x01, 0x39, 0x39, 0x82, 0x77, 0x0b, 0x15, 0x19, 0x5d,
+  0x59, 0x59, 0x58, 0x7d, 0x59, 0x38, 0x18, 0x15, 0x36, 0x81, 0x1e, 0x01, 0x45, 0x00, 0x80, 0x1c, 0x00, 0x11, 0x80, 0x6a, 0x80, 0x6c, 0x07, 0x31,
+  0x39, 0x04, 0x59, 0x31, 0x11, 0x39, 0x2c, 0x81, 0x0c, 0x80, 0x0e, 0x00, 0x08, 0x82, 0xff, 0x00, 0x08, 0x80, 0x71, 0x80, 0x09, 0x07, 0x0c, 0x08,
+  0x04, 0x09, 0x0e, 0x0d, 0x11, 0x12, 0x81, 0x5b, 0x00, 0x09, 0x88, 0x5e, 0x01, 0x32, 0x32, 0x81, 0x77, 0x00, 0x32, 0x81, 0x77, 0x00, 0x2e, 0x88,
+  0x77, 0x82, 0x74, 0x80, 0x05, 0x04, 0x15, 0x15, 0x38, 0x59, 0x14, 0x81, 0x78, 0x08, 0x15, 0x19, 0x38, 0x5d, 0x34, 0x59, 0x39, 0x5d, 0x5d, 0x80,
+  0x0d, 0x00, 0x11, 0x81, 0x21, 0x80, 0x77, 0x82, 0x76, 0x80, 0x5b, 0x06, 0x59, 0x0c, 0x08, 0x35, 0x08, 0x08, 0x35, 0x82, 0x0e, 0x0a, 0x0d, 0x31,
+  0x08, 0x08, 0x0d, 0x0d, 0x35, 0x0d, 0x35, 0x59, 0x2d, 0x81, 0x1c, 0x03, 0x35, 0x31, 0x04, 0x04, 0x88, 0x6e, 0x80, 0x61, 0x82, 0x70, 0x81, 0x72,
+  0x81, 0x07, 0x03, 0x32, 0x0d, 0x32, 0x2d, 0x8e, 0xeb, 0x83, 0x78, 0x02, 0x14, 0x5d, 0x38, 0x82, 0x77, 0x0a, 0x15, 0x14, 0x59, 0x5d, 0x34, 0x15,
+  0x39, 0x38, 0x38, 0x14, 0x39, 0x81, 0x79, 0x00, 0x09, 0x80, 0x77, 0x01, 0x0d, 0x04, 0x80, 0x69, 0x01, 0x2d, 0x08, 0x80, 0x00, 0x00, 0x39, 0x80,
+  0x77, 0x01, 0x31, 0x39, 0x80, 0x63, 0x01, 0x0c, 0x31, 0x82, 0x77, 0x80, 0xe7, 0x80, 0x0e, 0x81, 0x1d, 0x02, 0x39, 0x0c, 0x09, 0x81, 0x6d, 0x83,
+  0xec, 0x00, 0x2e, 0x81, 0xda, 0x84, 0x78, 0x80, 0x73, 0x83, 0x03, 0x89, 0x75, 0x83, 0x7a, 0x81, 0x05, 0x81, 0xf0, 0x84, 0x78, 0x82, 0xf9, 0x04,
+  0x18, 0x18, 0x39, 0x14, 0x19, 0x80, 0x78, 0x01, 0x04, 0x00, 0x81, 0x1e, 0x00, 0x0d, 0x80, 0xd3, 0x04, 0x04, 0x04, 0x00, 0x55, 0x35, 0x80, 0xdc,
+  0x02, 0x08, 0x31, 0x31, 0x80, 0xdf, 0x80, 0x80, 0x03, 0x0d, 0x31, 0x2d, 0x35, 0x82, 0x88, 0x80, 0x78, 0x80, 0x0c, 0x00, 0x08, 0x82, 0x72, 0x83,
+  0x00, 0x81, 0x77, 0x00, 0x11, 0x84, 0x78, 0x85, 0x7f, 0x86, 0x76, 0x85, 0xf1, 0x80, 0xd5, 0x81, 0x78, 0x03, 0x19, 0x5d, 0x38, 0x18, 0x82, 0x77,
+  0x00, 0x18, 0x82, 0x80, 0x00, 0x19, 0x81, 0xf1, 0x03, 0x38, 0x39, 0x04, 0x00, 0x80, 0x1c, 0x80, 0x5b, 0x81, 0x77, 0x03, 0x51, 0x31, 0x08, 0x55,
+  0x80, 0x06, 0x00, 0x08, 0x80, 0x66, 0x80, 0x77, 0x06, 0x04, 0x0c, 0x35, 0x2d, 0x35, 0x0c, 0x35, 0x80, 0xfd, 0x80, 0xef, 0x02, 0x04, 0x04, 0x09,
+  0x80, 0x00, 0x84, 0xef, 0x80, 0x02, 0x00, 0x2e, 0x86, 0x70, 0x02, 0x0e, 0x31, 0x31, 0x8b, 0x77, 0x84, 0x76, 0x00, 0x15, 0x80, 0xdc, 0x00, 0x11,
+  0x82, 0xf0, 0x02, 0x39, 0x58, 0x39, 0x82, 0x77, 0x02, 0x14, 0x39, 0x5d, 0x81, 0x08, 0x00, 0x38, 0x80, 0x86, 0x04, 0x39, 0x38, 0x08, 0x00, 0x11,
+  0x80, 0x1d, 0x01, 0x35, 0x0d, 0x80, 0xe8, 0x81, 0x70, 0x00, 0x35, 0x82, 0xf8, 0x80, 0x77, 0x0b, 0x0c, 0x0d, 0x31, 0x39, 0x35, 0x04, 0x39, 0x08,
+  0x2d, 0x31, 0x35, 0x39, 0x80, 0x77, 0x01, 0x09, 0x05, 0x83, 0x75, 0x80, 0x74, 0x01, 0x0e, 0x0d, 0x80, 0x0a, 0x81, 0x77, 0x02, 0x11, 0x32, 0x12,
+  0x81, 0x82, 0x91, 0x00, 0x81, 0x77, 0x00, 0x19, 0x80, 0x77, 0x83, 0x78, 0x02, 0x59, 0x59, 0x59, 0x81, 0x0b, 0x81, 0x08, 0x00, 0x14, 0x81, 0x87,
+  0x81, 0xff, 0x05, 0x39, 0x04, 0x11, 0x11, 0x09, 0x31, 0x81, 0x6f, 0x82, 0xd5, 0x00, 0x28, 0x82, 0x75, 0x08, 0x04, 0x08, 0x31, 0x08, 0x08, 0x2d,
+  0x2d, 0x0c, 0x04, 0x80, 0xf5, 0x02, 0x08, 0x0d, 0x31, 0x82, 0x1c, 0x84, 0xed, 0x02, 0x09, 0x09, 0x32, 0x81, 0x77, 0x01, 0x0d, 0x32, 0x80, 0x03,
+  0x00, 0x11, 0x82, 0xf0, 0x95, 0x77, 0x81, 0x00, 0x80, 0x07, 0x80, 0x08, 0x02, 0x14, 0x59, 0x38, 0x80, 0x84, 0x00, 0x15, 0x83, 0x81, 0x81, 0xf2,
+  0x09, 0x18, 0x18, 0x39, 0x14, 0x19, 0x11, 0x15, 0x0d, 0x04, 0x15, 0x80, 0x59, 0x00, 0x0d, 0x82, 0x78, 0x02, 0x08, 0x04, 0x24, 0x83, 0x06, 0x82,
+  0x00, 0x00, 0x0c, 0x83, 0x06, 0x80, 0x87, 0x01, 0x11, 0x08, 0x82, 0xe8, 0x87, 0x77, 0x95, 0x72, 0x82, 0x76, 0x86, 0x78, 0x81, 0x79, 0x80, 0x78,
+  0x02, 0x39, 0x38, 0x14, 0x82, 0xf1, 0x02, 0x14, 0x38, 0x34, 0x81, 0xfb, 0x03, 0x18, 0x14, 0x18, 0x18, 0x81, 0x0e, 0x81, 0xf6, 0x02, 0x31, 0x31,
+  0x0c, 0x81, 0x6c, 0x05, 0x08, 0x24, 0x44, 0x04, 0x04, 0x29, 0x80, 0x09, 0x01, 0x24, 0x24, 0x82, 0x7c, 0x80, 0xee, 0x00, 0x0d, 0x82, 0x05, 0x01,
+  0x08, 0x2d, 0x81, 0xed, 0x80, 0x03, 0x01, 0x0d, 0x2e, 0x80, 0x03, 0x00, 0x0d, 0x80, 0x0d, 0x99, 0x77, 0x81, 0xf2, 0x00, 0x15, 0x80, 0x6b, 0x84,
+  0x78, 0x03, 0x19, 0x59, 0x59, 0x18, 0x82, 0x0b, 0x80, 0x83, 0x00, 0x34, 0x81, 0xf1, 0x02, 0x15, 0x19, 0x04, 0x81, 0x18, 0x05, 0x19, 0x0c, 0x31,
+  0x31, 0x08, 0x31, 0x82, 0x68, 0x00, 0x24, 0x80, 0x70, 0x00, 0x2d, 0x80, 0x07, 0x03, 0x44, 0x44, 0x24, 0x09, 0x80, 0x0f, 0x05, 0x08, 0x31, 0x2d,
+  0x31, 0x0c, 0x00, 0x80, 0x19, 0x03, 0x00, 0x08, 0x34, 0x11, 0x82, 0x77, 0x80, 0x03, 0xa0, 0x00, 0x81, 0x62, 0x02, 0x18, 0x15, 0x14, 0x80, 0x6d,
+  0x82, 0x78, 0x03, 0x34, 0x5d, 0x38, 0x14, 0x83, 0xf2, 0x80, 0x79, 0x00, 0x14, 0x81, 0x07, 0x00, 0x00, 0x80, 0x22, 0x80, 0x00, 0x05, 0x08, 0x08,
+  0x11, 0x04, 0x0d, 0x15, 0x81, 0x77, 0x81, 0x70, 0x80, 0x7c, 0x02, 0x44, 0x44, 0x44, 0x80, 0x76, 0x05, 0x0d, 0x04, 0x31, 0x00, 0x2d, 0x35, 0x80,
+  0x91, 0x07, 0x0d, 0x10, 0x15, 0x11, 0x35, 0x35, 0x09, 0x0e, 0x81, 0xeb, 0xa3, 0x77, 0x00, 0x08, 0x80, 0xac, 0x81, 0xda, 0x81, 0x5d, 0x05, 0x15,
+  0x15, 0x38, 0x38, 0x39, 0x39, 0x82, 0xe8, 0x83, 0x00, 0x02, 0x11, 0x11, 0x00, 0x81, 0x23, 0x81, 0x86, 0x06, 0x11, 0x15, 0x35, 0x04, 0x04, 0x11,
+  0x2d, 0x81, 0xe8, 0x81, 0x74, 0x00, 0x68, 0x80, 0x01, 0x01, 0x04, 0x08, 0x80, 0x3e, 0x06, 0x11, 0x04, 0x28, 0x08, 0x0d, 0x11, 0x0d, 0x80, 0x22,
+  0x02, 0x11, 0x39, 0x35, 0xa3, 0x74, 0x81, 0x00, 0x04, 0x08, 0x04, 0x0d, 0x00, 0x35, 0x80, 0xf1, 0x84, 0xf0, 0x04, 0x15, 0x14, 0x38, 0x59, 0x59,
+  0x81, 0x79, 0x84, 0x7c, 0x01, 0x11, 0x11, 0x82, 0x9c, 0x81, 0x0a, 0x01, 0x14, 0x59, 0x80, 0x7b, 0x02, 0x15, 0x59, 0x28, 0x83, 0x74, 0x03, 0x68,
+  0x64, 0x64, 0x24, 0x81, 0x91, 0x80, 0x1f, 0x81, 0x05, 0x80, 0x00, 0x04, 0x35, 0x35, 0x11, 0x59, 0x15, 0x9d, 0x6e, 0x01, 0x09, 0x00, 0x81, 0x00,
+  0x80, 0x07, 0x0b, 0x04, 0x08, 0x00, 0x15, 0x15, 0x35, 0x14, 0x18, 0x59, 0x14, 0x11, 0x04, 0x81, 0x60, 0x03, 0x14, 0x14, 0x38, 0x34, 0x80, 0x79,
+  0x02, 0x14, 0x38, 0x58, 0x84, 0xf2, 0x82, 0x77, 0x80, 0x17, 0x80, 0x72, 0x80, 0x85, 0x07, 0x15, 0x15, 0x2c, 0x44, 0x44, 0x64, 0x88, 0x68, 0x81,
+  0x02, 0x01, 0x28, 0x15, 0x81, 0x94, 0x82, 0x76, 0x81, 0xa0, 0x01, 0x15, 0x35, 0x81, 0x07, 0x9e, 0xe8, 0x00, 0x04, 0x80, 0xea, 0x80, 0x7a, 0x82,
+  0x77, 0x07, 0x15, 0x18, 0x15, 0x35, 0x35, 0x00, 0x09, 0x08, 0x82, 0xd9, 0x07, 0x18, 0x14, 0x39, 0x59, 0x59, 0x15, 0x14, 0x18, 0x84, 0xf1, 0x87,
+  0x77, 0x81, 0xf0, 0x03, 0x11, 0x15, 0x59, 0x24, 0x80, 0xef, 0x80, 0x77, 0x02, 0x88, 0x64, 0x09, 0x83, 0x76, 0x82, 0x34, 0x82, 0x78, 0x82, 0x06,
+  0x9e, 0xf0, 0x08, 0x04, 0x04, 0x08, 0x04, 0x04, 0x00, 0x20, 0x04, 0x00, 0x81, 0x30, 0x04, 0x14, 0x19, 0x00, 0x0d, 0x04, 0x81, 0xf0, 0x81, 0xf1,
+  0x03, 0x14, 0x38, 0x59, 0x35, 0x80, 0x13, 0x82, 0x04, 0x87, 0x77, 0x02, 0x11, 0x11, 0x38, 0x81, 0x5c, 0x01, 0x14, 0x28, 0x80, 0x76, 0x05, 0x44,
+  0x68, 0xac, 0x64, 0x88, 0x08, 0x83, 0x63, 0x83, 0x70, 0x00, 0x39, 0x82, 0xf5, 0x83, 0x2f, 0x9b, 0xef, 0x81, 0x76, 0x04, 0x04, 0x00, 0x40, 0x00,
+  0x2d, 0x81, 0x2f, 0x02, 0x19, 0x19, 0x00, 0x80, 0xfe, 0x81, 0x61, 0x83, 0x3d, 0x00, 0x15, 0x81, 0x69, 0x01, 0x39, 0x39, 0x80, 0xf3, 0x83, 0x5a,
+  0x81, 0x15, 0x02, 0x11, 0x35, 0x39, 0x81, 0x78, 0x02, 0x04, 0x64, 0x44, 0x80, 0x77, 0x03, 0x8c, 0xac, 0x68, 0x29, 0x88, 0x77, 0x02, 0x11, 0x39,
+  0x39, 0x82, 0x06, 0x95, 0xef, 0x00, 0x09, 0x81, 0x27, 0x84, 0x78, 0x80, 0xf1, 0x0a, 0x00, 0x20, 0x40, 0x08, 0x0d, 0x15, 0x00, 0x04, 0x0c, 0x15,
+  0x38, 0x81, 0x0d, 0x82, 0x73, 0x81, 0x47, 0x82, 0x68, 0x05, 0x19, 0x00, 0x04, 0x11, 0x0c, 0x04, 0x83, 0x76, 0x83, 0x8e, 0x06, 0x35, 0x15, 0x11,
+  0x31, 0x08, 0x44, 0x20, 0x80, 0x78, 0x02, 0x88, 0xb0, 0x88, 0x80, 0xef, 0x82, 0x49, 0x81, 0x19, 0x00, 0x35, 0x80, 0x02, 0x80, 0xf1, 0x80, 0x38,
+  0x86, 0x68, 0x00, 0x09, 0x80, 0x6a, 0x87, 0x76, 0x80, 0x0d, 0x82, 0x56, 0x81, 0x0c, 0x06, 0x2d, 0x04, 0x00, 0x00, 0x20, 0x20, 0x28, 0x80, 0x53,
+  0x04, 0x00, 0x08, 0x2d, 0x39, 0x00, 0x80, 0x0d, 0x01, 0x10, 0x14, 0x83, 0xeb, 0x81, 0x66, 0x80, 0x86, 0x01, 0x35, 0x00, 0x80, 0x00, 0x81, 0x29,
+  0x03, 0x28, 0x44, 0x64, 0x48, 0x82, 0xcd, 0x0b, 0x15, 0x4c, 0x24, 0x44, 0x44, 0x8c, 0x68, 0x68, 0x68, 0xb0, 0xd0, 0x88, 0x80, 0xef, 0x80, 0x47,
+  0x08, 0x29, 0x44, 0x44, 0x44, 0x31, 0x11, 0x39, 0x35, 0x11, 0x81, 0x94, 0x00, 0x2c, 0x80, 0x0c, 0x83, 0xf2, 0x04, 0x29, 0x48, 0x44, 0x44, 0x29,
+  0x89, 0x76, 0x03, 0x28, 0x44, 0x44, 0x4d, 0x84, 0x78, 0x00, 0x09, 0x81, 0x33, 0x01, 0x44, 0x20, 0x80, 0xce, 0x0d, 0x04, 0x08, 0x44, 0x28, 0x64,
+  0x44, 0x00, 0x0d, 0x15, 0x39, 0x39, 0x14, 0x15, 0x31, 0x80, 0x22, 0x0a, 0x24, 0x08, 0x08, 0x00, 0x00, 0x04, 0x19, 0x2c, 0x00, 0x00, 0x35, 0x81,
+  0x76, 0x05, 0x68, 0x6d, 0x8c, 0x69, 0x28, 0x10, 0x80, 0x36, 0x06, 0x2d, 0x64, 0x69, 0x68, 0x6d, 0x44, 0x68, 0x80, 0x93, 0x01, 0x88, 0xd0, 0x80,
+  0x77, 0x08, 0x0d, 0x11, 0x29, 0x48, 0x68, 0x6c, 0x8d, 0x24, 0x31, 0x83, 0xac, 0x05, 0x2d, 0x44, 0x69, 0x6c, 0x6c, 0x48, 0x80, 0x9d, 0x06, 0x0d,
+  0x49, 0x68, 0x68, 0x8c, 0x8d, 0x44, 0x84, 0xf1, 0x80, 0x75, 0x08, 0x09, 0x44, 0x68, 0x68, 0x8d, 0x48, 0x2c, 0x39, 0x39, 0x80, 0x94, 0x07, 0x29,
+  0x40, 0x64, 0x68, 0x8d, 0x8d, 0x64, 0x40, 0x80, 0x19, 0x0d, 0x00, 0x24, 0x68, 0x8d, 0x68, 0x68, 0x28, 0x15, 0x14, 0x15, 0x35, 0x39, 0x35, 0x4c,
+  0x80, 0x15, 0x01, 0x69, 0x24, 0x80, 0xe9, 0x05, 0x31, 0x2c, 0x24, 0x64, 0x44, 0x44, 0x80, 0xbb, 0x0b, 0x68, 0x69, 0x68, 0x64, 0x68, 0x68, 0x0c,
+  0x15, 0x34, 0x15, 0x44, 0x68, 0x80, 0x01, 0x07, 0x04, 0x08, 0x11, 0x0d, 0x00, 0xb0, 0xac, 0x28, 0x80, 0xb0, 0x08, 0x11, 0x24, 0x8c, 0x68, 0x44,
+  0x44, 0xad, 0x24, 0x15, 0x80, 0x3a, 0x04, 0x15, 0x11, 0x44, 0x69, 0x48, 0x80, 0x6f, 0x00, 0x24, 0x80, 0x0b, 0x01, 0x44, 0x68, 0x80, 0xef, 0x82,
+  0x78, 0x81, 0x74, 0x03, 0x09, 0x09, 0x24, 0x68, 0x80, 0x10, 0x11, 0x8c, 0x44, 0x34, 0x59, 0x35, 0x14, 0x11, 0x08, 0x44, 0x8d, 0x68, 0x44, 0x48,
+  0x8d, 0x20, 0x24, 0x0d, 0x11, 0x80, 0x16, 0x00, 0x44, 0x80, 0x91, 0x05, 0x30, 0x14, 0x35, 0x14, 0x35, 0x2c, 0x82, 0x64, 0x00, 0x44, 0x80, 0x77,
+  0x05, 0x00, 0x40, 0x68, 0x6c, 0x6d, 0x6c, 0x80, 0x3a, 0x02, 0x44, 0x24, 0x24, 0x80, 0x98, 0x10, 0x0c, 0x15, 0x59, 0x35, 0x44, 0x69, 0x68, 0x24,
+  0x04, 0x09, 0x16, 0x16, 0x09, 0x24, 0xd0, 0x88, 0x08, 0x80, 0x76, 0x01, 0x0d, 0x40, 0x81, 0x39, 0x01, 0xb1, 0x04, 0x80, 0xed, 0x81, 0x77, 0x80,
+  0x5c, 0x01, 0x48, 0xb1, 0x83, 0x77, 0x81, 0x16, 0x80, 0xb3, 0x87, 0x77, 0x00, 0x44, 0x80, 0x77, 0x05, 0x35, 0x14, 0x39, 0x55, 0x15, 0x0d, 0x82,
+  0x0c, 0x03, 0xad, 0x44, 0x20, 0x11, 0x80, 0x55, 0x82, 0x77, 0x00, 0x31, 0x80, 0xd1, 0x02, 0x15, 0x28, 0x69, 0x80, 0xaa, 0x01, 0x8c, 0x68, 0x81,
+  0x77, 0x04, 0x68, 0x68, 0x64, 0x44, 0x68, 0x81, 0x77, 0x15, 0x04, 0x04, 0x09, 0x04, 0x24, 0x0d, 0x15, 0x11, 0x55, 0x24, 0x88, 0x48, 0x04, 0x0d,
+  0x32, 0x11, 0x11, 0x04, 0x88, 0xd0, 0x88, 0x28, 0x80, 0x77, 0x80, 0x6a, 0x03, 0x68, 0x8d, 0x8c, 0x8d, 0x80, 0xef, 0x80, 0x83, 0x00, 0x09, 0x82,
+  0x0c, 0x0d, 0x8c, 0x04, 0x15, 0x14, 0x35, 0x24, 0x68, 0x6c, 0x91, 0x8d, 0x8d, 0x24, 0x0d, 0x09, 0x87, 0x77, 0x0b, 0x6c, 0x8d, 0x91, 0x44, 0x35,
+  0x39, 0x35, 0x35, 0x35, 0x11, 0x20, 0x68, 0x81, 0x27, 0x0b, 0x44, 0x24, 0x20, 0x44, 0x40, 0x44, 0x68, 0x8d, 0x8d, 0x8d, 0x68, 0x08, 0x80, 0xb4,
+  0x06, 0x15, 0x08, 0x68, 0x6c, 0x68, 0x8c, 0x8d, 0x81, 0xef, 0x01, 0x04, 0x48, 0x80, 0xbf, 0x80, 0x77, 0x11, 0x08, 0x64, 0x00, 0x12, 0x16, 0x0d,
+  0x04, 0x04, 0x0d, 0x15, 0x35, 0x20, 0x44, 0x04, 0x0c, 0x36, 0x0d, 0x0d, 0x80, 0x77, 0x07, 0x8c, 0xac, 0x68, 0x0d, 0x08, 0x31, 0x11, 0x24, 0x80,
+  0x6b, 0x00, 0x68, 0x81, 0x77, 0x80, 0x62, 0x00, 0x08, 0x80, 0x5d, 0x02, 0x68, 0x8c, 0x88, 0x80, 0x0c, 0x00, 0x35, 0x81, 0x16, 0x81, 0x77, 0x84,
+  0x76, 0x01, 0x0d, 0x29, 0x82, 0x26, 0x82, 0x54, 0x00, 0x35, 0x82, 0x1c, 0x00, 0x68, 0x80, 0x77, 0x80, 0x01, 0x83, 0x09, 0x01, 0x04, 0x04, 0x81,
+  0xe5, 0x82, 0x0b, 0x00, 0x48, 0x83, 0x09, 0x03, 0x6c, 0x91, 0xb1, 0x44, 0x80, 0x1e, 0x07, 0x00, 0x16, 0x0d, 0x0d, 0x16, 0x09, 0x04, 0x44, 0x80,
+  0x0b, 0x01, 0x09, 0x11, 0x80, 0x4c, 0x01, 0x0d, 0x08, 0x81, 0x0a, 0x80, 0x98, 0x80, 0x39, 0x0a, 0x44, 0x48, 0x48, 0x6d, 0x20, 0x44, 0x68, 0x40,
+  0x44, 0x40, 0x24, 0x80, 0x0d, 0x04, 0x48, 0x68, 0x68, 0x44, 0x20, 0x80, 0x14, 0x05, 0x64, 0x44, 0x68, 0x24, 0x00, 0x45, 0x81, 0x10, 0x80, 0x0c,
+  0x00, 0x44, 0x81, 0x19, 0x04, 0x44, 0x68, 0x69, 0x44, 0x24, 0x80, 0x0d, 0x00, 0x24, 0x83, 0x0c, 0x00, 0x68, 0x81, 0x17, 0x82, 0x08, 0x03, 0x68,
+  0x68, 0x20, 0x15, 0x80, 0x5a, 0x82, 0x4a, 0x01, 0x68, 0x68, 0x81, 0x77, 0x82, 0xbf, 0x01, 0xb4, 0x90, 0x80, 0x77, 0x09, 0x11, 0x0d, 0x04, 0x08,
+  0x11, 0x0d, 0x00, 0x91, 0x20, 0x04, 0x80, 0x75, 0x09, 0x04, 0x09, 0x12, 0x04, 0xb1, 0xd4, 0x8c, 0x04, 0x0d, 0x08, 0x80, 0x94, 0x80, 0x38, 0x07,
+  0x69, 0x68, 0x8d, 0xb1, 0xb1, 0xb1, 0xb0, 0xb0, 0x82, 0x0c, 0x15, 0x8d, 0x48, 0x8d, 0xb0, 0xb0, 0x91, 0x04, 0x04, 0x04, 0x28, 0x24, 0x09, 0x00,
+  0x20, 0x8d, 0x00, 0x04, 0x08, 0x00, 0x00, 0x48, 0x8d, 0x80, 0x6b, 0x80, 0x53, 0x06, 0x6c, 0x91, 0xb0, 0xb0, 0xb0, 0xd1, 0x68, 0x82, 0x0b, 0x01,
+  0x68, 0x68, 0x80, 0x33, 0x80, 0x7c, 0x83, 0x77, 0x02, 0x15, 0x04, 0x6c, 0x83, 0x0a, 0x80, 0xb1, 0x80, 0x1f, 0x00, 0x68, 0x80, 0x0b, 0x06, 0xb1,
+  0x8c, 0x48, 0x44, 0x04, 0x09, 0x11, 0x80, 0x6d, 0x80, 0x71, 0x04, 0x04, 0x04, 0x09, 0x09, 0x08, 0x80, 0x09, 0x08, 0x04, 0x68, 0x8d, 0x08, 0x11,
+  0x16, 0x09, 0xb1, 0x68, 0x80, 0xe9, 0x80, 0x2c, 0x06, 0x6c, 0x8c, 0x90, 0x8c, 0xb0, 0x8c, 0x68, 0x82, 0x4f, 0x0a, 0x44, 0x6c, 0x90, 0xb1, 0x00,
+  0x14, 0x1d, 0x11, 0x0c, 0x00, 0x08, 0x80, 0x2f, 0x0b, 0x11, 0x1d, 0x19, 0x04, 0x48, 0xb1, 0x88, 0x24, 0x00, 0x04, 0x00, 0x6d, 0x80, 0xc4, 0x80,
+  0xa0, 0x00, 0x8c, 0x83, 0x61, 0x03, 0x44, 0x68, 0x90, 0x90, 0x80, 0x77, 0x81, 0x6b, 0x80, 0x77, 0x01, 0x10, 0x15, 0x80, 0xdc, 0x00, 0x00, 0x81,
+  0x4c, 0x02, 0xb1, 0xb0, 0xb4, 0x82, 0xbf, 0x81, 0x82, 0x0b, 0x44, 0x44, 0x04, 0x11, 0x0d, 0x08, 0x04, 0x08, 0x09, 0x09, 0x00, 0x04, 0x80, 0x76,
+  0x80, 0xf3, 0x80, 0x80, 0x06, 0x0d, 0x0d, 0x11, 0x09, 0x44, 0x44, 0x40, 0x80, 0x9f, 0x01, 0x68, 0x48, 0x84, 0x27, 0x80, 0xa8, 0x00, 0x48, 0x81,
+  0x4a, 0x16, 0x64, 0x04, 0x00, 0x08, 0x08, 0x09, 0x00, 0x08, 0x0c, 0x09, 0x09, 0x11, 0x0c, 0x45, 0xa9, 0x24, 0x24, 0x00, 0x00, 0x05, 0x04, 0x24,
+  0x69, 0x82, 0x24, 0x01, 0x68, 0x64, 0x81, 0x4f, 0x80, 0xd1, 0x82, 0x7c, 0x80, 0x07, 0x06, 0x20, 0x04, 0x00, 0x00, 0x08, 0x11, 0x11, 0x80, 0xa2,
+  0x02, 0x7d, 0x35, 0x04, 0x80, 0x9a, 0x00, 0x8c, 0x80, 0xbf, 0x81, 0xc0, 0x06, 0x20, 0x40, 0x20, 0x04, 0x04, 0x00, 0x04, 0x80, 0xf0, 0x80, 0x78,
+  0x80, 0x03, 0x81, 0x72, 0x80, 0x7f, 0x05, 0x0d, 0x09, 0x08, 0x16, 0x08, 0x24, 0x81, 0x6a, 0x80, 0x6b, 0x02, 0x20, 0x44, 0x20, 0x80, 0x00, 0x84,
+  0xa7, 0x80, 0xb7, 0x1a, 0x00, 0x20, 0xd2, 0x64, 0x0c, 0x10, 0x0d, 0x08, 0x08, 0x0d, 0x08, 0x00, 0xca, 0xce, 0x04, 0x0c, 0x14, 0x18, 0x04, 0x44,
+  0x88, 0x48, 0x48, 0x44, 0x20, 0x44, 0x40, 0x80, 0x00, 0x81, 0x56, 0x80, 0x9f, 0x81, 0x33, 0x12, 0x44, 0x68, 0x69, 0x04, 0x59, 0x5d, 0x11, 0x04,
+  0x0c, 0x0d, 0x08, 0x11, 0x5d, 0x10, 0x08, 0x24, 0x68, 0x48, 0x64, 0x80, 0x97, 0x00, 0x20, 0x81, 0xbc, 0x03, 0x30, 0x50, 0x70, 0x00, 0x81, 0xbc,
+  0x00, 0x11, 0x80, 0x71, 0x81, 0x74, 0x02, 0x68, 0x24, 0x04, 0x80, 0xee, 0x08, 0x08, 0x0d, 0x04, 0x08, 0x12, 0x04, 0x50, 0x75, 0x24, 0x80, 0x44,
+  0x08, 0x48, 0xb1, 0x24, 0x30, 0x50, 0x50, 0x50, 0x74, 0x4c, 0x80, 0x79, 0x0b, 0x68, 0x68, 0x91, 0x00, 0x0c, 0x1c, 0x14, 0x00, 0xee, 0xa9, 0x00,
+  0x0c, 0x80, 0x9e, 0x0e, 0x11, 0x11, 0x08, 0x00, 0x24, 0x04, 0x11, 0x10, 0x1c, 0x04, 0x00, 0x20, 0x48, 0x8c, 0x44, 0x81, 0x25, 0x01, 0x54, 0x54,
+  0x80, 0x33, 0x07, 0x44, 0x68, 0x8c, 0x24, 0x4c, 0x50, 0x50, 0x54, 0x80, 0xd7, 0x03, 0x04, 0x08, 0x15, 0x19, 0x80, 0x58, 0x07, 0x28, 0x0d, 0x2d,
+  0x08, 0x04, 0x68, 0x6c, 0x68, 0x80, 0x8c, 0x80, 0x1f, 0x80, 0xbe, 0x03, 0x50, 0x30, 0x4c, 0x20, 0x80, 0x17, 0x09, 0x00, 0x04, 0x08, 0x24, 0x24,
+  0x04, 0x09, 0x04, 0x48, 0x68, 0x80, 0xef, 0x80, 0x7e, 0x06, 0x04, 0x04, 0x09, 0x09, 0x4c, 0x2c, 0x50, 0x82, 0x23, 0x01, 0xd5, 0x24, 0x80, 0x42,
+  0x02, 0x34, 0x30, 0x50, 0x80, 0xc9, 0x1f, 0x68, 0x68, 0xb5, 0x00, 0x00, 0x0c, 0x10, 0x11, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0xae, 0x04, 0x19,
+  0x0c, 0x2d, 0x0c, 0x04, 0x0d, 0x10, 0x08, 0x00, 0x04, 0x00, 0x24, 0xb1, 0x68, 0x50, 0x50, 0x80, 0xa0, 0x00, 0x78, 0x82, 0x77, 0x01, 0xd5, 0x20,
+  0x80, 0x84, 0x0e, 0x54, 0x28, 0x44, 0x68, 0x48, 0x00, 0x08, 0x0c, 0x0c, 0x04, 0x45, 0x44, 0x04, 0x45, 0x04, 0x80, 0x8d, 0x03, 0x68, 0x4c, 0x78,
+  0x54, 0x83, 0x54, 0x03, 0x20, 0x40, 0x20, 0x24, 0x80, 0x43, 0x81, 0x00, 0x00, 0x8d, 0x80, 0x08, 0x01, 0x88, 0x44, 0x80, 0x7c, 0x08, 0x04, 0x20,
+  0x04, 0x09, 0x0d, 0x0d, 0x04, 0x44, 0x64, 0x80, 0xe1, 0x00, 0x64, 0x80, 0x77, 0x02, 0x20, 0x44, 0x64, 0x80, 0x01, 0x82, 0xee, 0x02, 0x6c, 0xd5,
+  0x20, 0x80, 0xe0, 0x08, 0x0d, 0x09, 0x08, 0x1d, 0x19, 0x0d, 0x04, 0x0d, 0x0c, 0x80, 0xf4, 0x07, 0x15, 0x00, 0x08, 0x08, 0x04, 0x89, 0xce, 0x04,
+  0x80, 0x77, 0x81, 0x71, 0x01, 0x44, 0x24, 0x82, 0x56, 0x00, 0xb5, 0x80, 0xa4, 0x01, 0x64, 0x24, 0x80, 0x3d, 0x00, 0x24, 0x80, 0x58, 0x0e, 0x08,
+  0x0d, 0x08, 0x08, 0x08, 0x0c, 0x0d, 0x08, 0x24, 0xad, 0x68, 0x28, 0x30, 0x50, 0x70, 0x82, 0x48, 0x02, 0x20, 0xb1, 0x44, 0x80, 0xe1, 0x01, 0x0d,
+  0x0d, 0x80, 0x6d, 0x03, 0x00, 0x8d, 0x24, 0x44, 0x82, 0x27, 0x80, 0xf9, 0x80, 0x7d, 0x03, 0x68, 0xd5, 0xb1, 0x68, 0x81, 0xba, 0x07, 0x68, 0xb5,
+  0x44, 0xb5, 0xb1, 0xb0, 0xb1, 0xb1, 0x82, 0x0b, 0x80, 0xfc, 0x00, 0x8d, 0x80, 0x1d, 0x80, 0xa9, 0x18, 0x10, 0x11, 0x04, 0x0d, 0x11, 0x04, 0x08,
+  0x05, 0x10, 0x00, 0x45, 0x08, 0x11, 0x08, 0xf6, 0x00, 0x8d, 0x8d, 0x64, 0xb1, 0xb1, 0xb0, 0xb0, 0xb0, 0x8d, 0x84, 0x33, 0x80, 0x32, 0x00, 0x6c,
+  0x80, 0x09, 0x0e, 0x04, 0x11, 0x15, 0x0d, 0x00, 0x11, 0x11, 0x19, 0x0c, 0x0d, 0x19, 0x19, 0x08, 0x68, 0x6c, 0x80, 0x89, 0x82, 0x76, 0x04, 0x68,
+  0x20, 0x68, 0x24, 0x08, 0x80, 0x74, 0x06, 0x00, 0x24, 0x28, 0x28, 0x00, 0x89, 0x68, 0x80, 0x27, 0x03, 0x04, 0x04, 0x68, 0x88, 0x81, 0x58, 0x03,
+  0x48, 0x68, 0x8c, 0x90, 0x82, 0x77, 0x07, 0x48, 0x8c, 0x64, 0x8c, 0x8c, 0x90, 0x8d, 0x68, 0x80, 0xce, 0x0e, 0x68, 0x69, 0x24, 0x44, 0x00, 0x20,
+  0x89, 0x04, 0x05, 0x00, 0x11, 0x09, 0x04, 0x08, 0x0c, 0x80, 0xaf, 0x00, 0x11, 0x80, 0x04, 0x05, 0x49, 0x00, 0x0c, 0x19, 0x44, 0x00, 0x80, 0x4b,
+  0x04, 0x6c, 0x8c, 0xb0, 0x90, 0x8c, 0x83, 0xab, 0x01, 0x8c, 0x44, 0x80, 0x0c, 0x16, 0x68, 0x44, 0x48, 0x68, 0x28, 0x08, 0x19, 0x19, 0x0c, 0x04,
+  0x15, 0x0d, 0x08, 0x09, 0x08, 0x04, 0x00, 0x44, 0x68, 0x8c, 0xb1, 0xb1, 0x48, 0x83, 0xef, 0x03, 0x44, 0x04, 0x11, 0x0d, 0x81, 0xe3, 0x03, 0x64,
+  0x64, 0x8d, 0x20, 0x80, 0x5c, 0x09, 0x04, 0x04, 0x64, 0x8c, 0x48, 0x00, 0x08, 0x09, 0x04, 0x24, 0x80, 0x84, 0x82, 0x42, 0x02, 0x44, 0x90, 0x44,
+  0x80, 0xa5, 0x80, 0x0a, 0x80, 0x06, 0x05, 0x69, 0x00, 0x11, 0x08, 0x89, 0xae, 0x80, 0x1d, 0x11, 0x19, 0x04, 0x00, 0x2d, 0x11, 0x08, 0x00, 0x04,
+  0x0c, 0x19, 0x09, 0x0d, 0x08, 0x00, 0x00, 0x1d, 0x00, 0x05, 0x81, 0x78, 0x81, 0x2d, 0x81, 0x00, 0x80, 0x77, 0x80, 0x08, 0x00, 0x48, 0x82, 0xd8,
+  0x02, 0x04, 0x08, 0x08, 0x82, 0x02, 0x04, 0x09, 0x35, 0x0c, 0x10, 0x24, 0x80, 0x0f, 0x01, 0x8d, 0x64, 0x82, 0x20, 0x08, 0x20, 0x04, 0x0d, 0x11,
+  0x09, 0x08, 0x0d, 0x0d, 0x0d, 0x80, 0x68, 0x00, 0x8d, 0x80, 0x89, 0x0d, 0x24, 0x68, 0xad, 0x68, 0x24, 0x24, 0x04, 0x09, 0x0d, 0x04, 0x20, 0x24,
+  0x24, 0x20, 0x80, 0x70, 0x07, 0x68, 0x68, 0xb1, 0x20, 0x44, 0x20, 0x20, 0x20, 0x80, 0x0c, 0x80, 0x0d, 0x06, 0x6d, 0x00, 0x0d, 0x45, 0x49, 0x0d,
+  0x09, 0x80, 0xe9, 0x00, 0x05, 0x80, 0xc6, 0x04, 0xae, 0x65, 0x04, 0x1d, 0x0c, 0x80, 0x3b, 0x07, 0x00, 0x04, 0x09, 0x09, 0x24, 0x8c, 0x64, 0x24,
+  0x80, 0x26, 0x02, 0x44, 0x20, 0x24, 0x80, 0x58, 0x03, 0x68, 0x91, 0x44, 0x40, 0x81, 0x0c, 0x02, 0x44, 0x68, 0x48, 0x80, 0x1b, 0x0a, 0x00, 0x19,
+  0x0d, 0x11, 0x0c, 0x04, 0x08, 0x19, 0x15, 0x44, 0x8c, 0x82, 0xc1, 0x80, 0x9f, 0x06, 0x48, 0x40, 0x04, 0x11, 0x11, 0x0d, 0x0d, 0x81, 0xba, 0x05,
+  0x04, 0x20, 0x8d, 0x44, 0x24, 0x24, 0x80, 0xa9, 0x00, 0x24, 0x80, 0xfe, 0x80, 0x58, 0x04, 0x08, 0x58, 0x54, 0x54, 0x24, 0x80, 0xb5, 0x08, 0x48,
+  0x94, 0x24, 0x50, 0x54, 0x54, 0x54, 0x2c, 0x55, 0x82, 0x46, 0x05, 0x89, 0x00, 0x04, 0x00, 0x0d, 0x04, 0x80, 0xa8, 0x13, 0x09, 0x39, 0x04, 0x45,
+  0xf2, 0xce, 0x69, 0x04, 0x08, 0x11, 0x10, 0x0d, 0x09, 0x09, 0x04, 0x00, 0x24, 0x6c, 0x44, 0x4c, 0x80, 0x27, 0x01, 0x50, 0x55, 0x80, 0x33, 0x07,
+  0x44, 0x44, 0xb1, 0x24, 0x30, 0x78, 0x54, 0x4c, 0x81, 0xf2, 0x01, 0x08, 0x11, 0x80, 0x2e, 0x01, 0x15, 0x15, 0x80, 0xf2, 0x01, 0x00, 0x24, 0x80,
+  0x5b, 0x00, 0x24, 0x81, 0x1e, 0x80, 0xcc, 0x80, 0x77, 0x04, 0x12, 0x16, 0x11, 0x0d, 0x08, 0x80, 0x6a, 0x05, 0x24, 0x68, 0x20, 0x24, 0x44, 0x8d,
+  0x81, 0x75, 0x80, 0x24, 0x12, 0x0d, 0x11, 0x04, 0x2c, 0x30, 0x50, 0x40, 0x48, 0x44, 0x48, 0x68, 0x8c, 0x24, 0x75, 0x50, 0x30, 0x50, 0x2c, 0x50,
+  0x82, 0x50, 0x09, 0x68, 0x04, 0x00, 0x20, 0x00, 0x0d, 0x09, 0x08, 0x09, 0x04, 0x80, 0x47, 0x1f, 0xd2, 0x6d, 0x04, 0x05, 0x09, 0x08, 0x15, 0x0c,
+  0x09, 0x11, 0x00, 0x24, 0x20, 0x64, 0x44, 0x4c, 0x30, 0x50, 0x30, 0x51, 0x50, 0x24, 0x48, 0x64, 0x44, 0x48, 0x8c, 0x40, 0x54, 0x50, 0x50, 0x28,
+  0x80, 0x2e, 0x02, 0x69, 0x00, 0x00, 0x81, 0xa7, 0x00, 0x0c, 0x80, 0x55, 0x08, 0x20, 0x68, 0x68, 0x44, 0x2c, 0x78, 0x54, 0x50, 0x40, 0x80, 0x16,
+  0x02, 0x64, 0x40, 0x04, 0x80, 0x44, 0x80, 0xec, 0x84, 0x00, 0x01, 0x24, 0x00, 0x80, 0x77, 0x00, 0x08, 0x80, 0x74, 0x14, 0x09, 0x0d, 0x09, 0x4c,
+  0x4c, 0x2d, 0x24, 0x4c, 0x48, 0x60, 0x48, 0x68, 0x28, 0x74, 0x4c, 0x50, 0x2c, 0x4c, 0x2c, 0x24, 0x6c, 0x80, 0x85, 0x04, 0x48, 0x00, 0x09, 0x89,
+  0x20, 0x81, 0xa6, 0x01, 0x08, 0x0d, 0x80, 0x35, 0x01, 0x08, 0x11, 0x80, 0x3b, 0x09, 0x08, 0x29, 0x44, 0x2d, 0x00, 0x24, 0x24, 0x48, 0x44, 0x70,
+  0x80, 0x26, 0x04, 0x2c, 0x2c, 0x24, 0x4c, 0x6c, 0x80, 0x58, 0x06, 0x28, 0x75, 0x50, 0x4c, 0x2c, 0x44, 0x28, 0x80, 0xf0, 0x02, 0x20, 0x00, 0x0c,
+  0x81, 0xd5, 0x09, 0x09, 0x0c, 0x09, 0x24, 0x6c, 0x44, 0x50, 0x50, 0x50, 0x4c, 0x80, 0x98, 0x04, 0x68, 0x44, 0x20, 0x04, 0x28, 0x81, 0xe1, 0x80,
+  0x17, 0x01, 0x0d, 0x0d, 0x80, 0xc2, 0x00, 0x04, 0x81, 0x22, 0x04, 0x04, 0x0d, 0x0d, 0x09, 0x09, 0x80, 0x7b, 0x07, 0x4c, 0x28, 0x29, 0x28, 0x4c,
+  0x2c, 0x08, 0x20, 0x80, 0x74, 0x01, 0x50, 0x4c, 0x81, 0x0c, 0x04, 0x2c, 0x28, 0x24, 0x24, 0x04, 0x80, 0x74, 0x08, 0x08, 0x04, 0x85, 0x24, 0x08,
+  0x11, 0x00, 0x69, 0x04, 0x80, 0x24, 0x05, 0x00, 0x04, 0x45, 0xa9, 0xee, 0x20, 0x80, 0xb1, 0x02, 0x24, 0x48, 0x2c, 0x81, 0x27, 0x00, 0x2c, 0x80,
+  0x33, 0x03, 0x28, 0x48, 0x20, 0x50, 0x81, 0xa9, 0x03, 0x70, 0x2c, 0x50, 0x48, 0x80, 0x5d, 0x04, 0x00, 0x04, 0x09, 0x08, 0x08, 0x81, 0x50, 0x0c,
+  0x24, 0x28, 0x74, 0x50, 0x4c, 0x28, 0x28, 0x4c, 0x44, 0x44, 0x4c, 0x20, 0x4c, 0x80, 0x4c, 0x83, 0x6b, 0x80, 0xf8, 0x02, 0x08, 0x09, 0x09, 0x81,
+  0x0b, 0x08, 0x08, 0x12, 0x0d, 0x0d, 0x11, 0x11, 0x00, 0x54, 0x2c, 0x80, 0x24, 0x80, 0xc1, 0x02, 0x2c, 0x50, 0x54, 0x80, 0x77, 0x01, 0x50, 0x28,
+  0x80, 0x0c, 0x80, 0x34, 0x80, 0x75, 0x10, 0x08, 0x00, 0xf2, 0xce, 0x49, 0x08, 0x04, 0x44, 0x08, 0x08, 0x08, 0x00, 0x8d, 0x08, 0x29, 0xad, 0xf7,
+  0x81, 0x5c, 0x80, 0x1d, 0x00, 0x74, 0x80, 0xcd, 0x00, 0x50, 0x80, 0x23, 0x00, 0x30, 0x80, 0x32, 0x00, 0x4c, 0x80, 0x34, 0x80, 0x32, 0x04, 0x2c,
+  0x2c, 0x05, 0x04, 0x09, 0x80, 0x9f, 0x81, 0xac, 0x02, 0x04, 0x2c, 0x30, 0x80, 0x47, 0x09, 0x2c, 0x29, 0x48, 0x4c, 0x2c, 0x24, 0x00, 0x50, 0x51,
+  0x55, 0x81, 0x49, 0x01, 0x04, 0x11, 0x80, 0x77, 0x81, 0x7b, 0x83, 0xfc, 0x14, 0x15, 0x11, 0x0d, 0x11, 0x09, 0x50, 0x78, 0x50, 0x55, 0x4d, 0x54,
+  0x54, 0x2c, 0x50, 0x78, 0x54, 0x30, 0x58, 0x50, 0x50, 0x74, 0x80, 0x7d, 0x0a, 0x51, 0x4c, 0x28, 0x00, 0x00, 0x00, 0x0d, 0x24, 0xf7, 0xae, 0x00,
+  0x80, 0xc6, 0x0c, 0x0d, 0x08, 0x08, 0x0d, 0x04, 0x0d, 0x0c, 0x08, 0x00, 0x24, 0x00, 0x24, 0x50, 0x80, 0x6b, 0x03, 0x30, 0x50, 0x54, 0x54, 0x80,
+  0x34, 0x07, 0x74, 0x30, 0x54, 0x54, 0x30, 0x50, 0x58, 0x54, 0x81, 0x02, 0x03, 0x78, 0x2c, 0x29, 0x2d, 0x83, 0x52, 0x02, 0x04, 0x28, 0x2c, 0x80,
+  0x1d, 0x80, 0x10, 0x09, 0x50, 0x28, 0x2c, 0x50, 0x2c, 0x44, 0x74, 0x75, 0x00, 0x00, 0x81, 0xc1, 0x81, 0x74, 0x02, 0x11, 0x11, 0x09, 0x82, 0x97,
+  0x80, 0x25, 0x80, 0x0b, 0x0f, 0x08, 0x50, 0x2c, 0x50, 0x74, 0x4d, 0x50, 0x50, 0x4d, 0x50, 0x2c, 0x51, 0x30, 0x30, 0x78, 0x50, 0x80, 0xce, 0x09,
+  0x2c, 0x28, 0x4c, 0x24, 0x00, 0x8d, 0x20, 0x35, 0x31, 0x00, 0x81, 0x23, 0x05, 0x00, 0x2d, 0x04, 0x20, 0x09, 0x00, 0x80, 0xb1, 0x80, 0x32, 0x06,
+  0x00, 0x2c, 0x2c, 0x4c, 0x28, 0x4c, 0x2c, 0x80, 0x78, 0x80, 0x34, 0x01, 0x50, 0x51, 0x80, 0x32, 0x02, 0x2c, 0x50, 0x50, 0x81, 0x34, 0x00, 0x50,
+  0x80, 0x2a, 0x02, 0x25, 0x24, 0x44, 0x80, 0x22, 0x03, 0x24, 0x78, 0x30, 0x2c, 0x80, 0x8a, 0x0b, 0x75, 0x54, 0x71, 0x50, 0x78, 0x30, 0x40, 0x2c,
+  0x28, 0x24, 0x09, 0x09, 0x80, 0x6c, 0x02, 0x0d, 0x0d, 0x16, 0x80, 0x76, 0x80, 0x4e, 0x00, 0x08, 0x82, 0x7a, 0x04, 0x08, 0x0d, 0x16, 0x08, 0x2d,
+  0x80, 0x00, 0x10, 0x4d, 0x2d, 0x2d, 0x2c, 0x4d, 0x2d, 0x2c, 0x51, 0x2d, 0x74, 0x2c, 0x4d, 0x2c, 0x29, 0x29, 0x28, 0x28, 0x80, 0xef, 0x80, 0xe9,
+  0x80, 0x68, 0x80, 0x35, 0x03, 0x20, 0x89, 0xea, 0x24, 0x80, 0x32, 0x80, 0x77, 0x01, 0x00, 0x00, 0x81, 0x1a, 0x04, 0x2d, 0x4c, 0x50, 0x50, 0x51,
+  0x84, 0x35, 0x09, 0x2d, 0x4c, 0x28, 0x51, 0x2d, 0x75, 0x2d, 0x4d, 0x4d, 0x4d, 0x80, 0x2c, 0x01, 0x64, 0x49, 0x80, 0x33, 0x03, 0x28, 0x55, 0x2d,
+  0x2d, 0x80, 0x8d, 0x0b, 0x2c, 0x54, 0x50, 0x51, 0x2c, 0x51, 0x20, 0x2c, 0x2c, 0x04, 0x0d, 0x09, 0x80, 0x6b, 0x03, 0x09, 0x16, 0x16, 0x09, 0x81,
+  0x50, 0x00, 0x24, 0x81, 0x77, 0x80, 0x09, 0x08, 0x08, 0x11, 0x08, 0x2c, 0x2c, 0x2d, 0x4d, 0x2c, 0x2c, 0x80, 0xb7, 0x80, 0xf3, 0x07, 0x2d, 0x4d,
+  0x29, 0x2d, 0x2c, 0x2d, 0x2d, 0x28, 0x80, 0xa6, 0x03, 0x04, 0x00, 0x0d, 0x08, 0x80, 0x28, 0x09, 0x0d, 0x04, 0x09, 0x49, 0xce, 0xf7, 0x24, 0x0d,
+  0x04, 0x45, 0x80, 0x0a, 0x02, 0x04, 0x08, 0x4d, 0x81, 0x2a, 0x06, 0x2d, 0x4d, 0x4c, 0x2c, 0x4d, 0x29, 0x30, 0x80, 0x08, 0x02, 0x51, 0x50, 0x50,
+  0x80, 0x3c, 0x00, 0x50, 0x80, 0x7f, 0x08, 0x31, 0x28, 0x04, 0x04, 0x45, 0x24, 0x04, 0x24, 0x28, 0x82, 0x8d, 0x80, 0x00, 0x80, 0x25, 0x08, 0x2d,
+  0x2d, 0x00, 0x50, 0x28, 0x08, 0x0d, 0x09, 0x09, 0x80, 0xe1, 0x01, 0x11, 0x11, 0x80, 0x74, 0x00, 0x24, 0x81, 0xe9, 0x81, 0x02, 0x00, 0x24, 0x80,
+  0xd5, 0x09, 0x51, 0x50, 0x30, 0x30, 0x50, 0x30, 0x50, 0x78, 0x30, 0x50, 0x80, 0x05, 0x82, 0x04, 0x06, 0x50, 0x28, 0x4c, 0x50, 0x4c, 0x28, 0x00,
+  0x81, 0x67, 0x01, 0x04, 0x08, 0x80, 0x7e, 0x07, 0x45, 0x8d, 0x24, 0x0d, 0x2d, 0x64, 0x00, 0x04, 0x80, 0xa2, 0x02, 0x2c, 0x4c, 0x4c, 0x80, 0xa1,
+  0x80, 0x27, 0x01, 0x30, 0x2c, 0x81, 0x05, 0x00, 0x54, 0x81, 0x02, 0x80, 0xdc, 0x80, 0x0f, 0x05, 0x30, 0x2c, 0x08, 0x28, 0x04, 0x2c, 0x80, 0x07,
+  0x80, 0x00, 0x80, 0xc2, 0x09, 0x51, 0x51, 0x2d, 0x2c, 0x4d, 0x51, 0x00, 0x30, 0x28, 0x0d, 0x80, 0x00, 0x80, 0xe9, 0x06, 0x0d, 0x08, 0x44, 0x68,
+  0x68, 0x68, 0x44, 0x80, 0xc8, 0x04, 0x0d, 0x09, 0x32, 0x04, 0x28, 0x80, 0x33, 0x04, 0x78, 0x50, 0x50, 0x54, 0x74, 0x80, 0x76, 0x00, 0x78, 0x81,
+  0x3c, 0x02, 0x74, 0x30, 0x54, 0x81, 0x49, 0x81, 0x4a, 0x81, 0xdf, 0x80, 0x31, 0x02, 0x00, 0x04, 0x0c, 0x81, 0x07, 0x02, 0x0d, 0x04, 0x28, 0x80,
+  0x8d, 0x01, 0x50, 0x4c, 0x80, 0x03, 0x81, 0x22, 0x05, 0x30, 0x75, 0x30, 0x54, 0x58, 0x50, 0x81, 0x33, 0x00, 0x54, 0x80, 0x33, 0x0b, 0x50, 0x54,
+  0x54, 0x54, 0x78, 0x30, 0x74, 0x50, 0x2c, 0x54, 0x30, 0x30, 0x80, 0xbf, 0x00, 0x74, 0x80, 0x06, 0x81, 0x00, 0x07, 0x2c, 0x54, 0x20, 0x2c, 0x28,
+  0x0d, 0x16, 0x0d, 0x80, 0xee, 0x08, 0x04, 0x04, 0x00, 0x88, 0x89, 0xac, 0xac, 0x69, 0x44, 0x80, 0x81, 0x05, 0x0d, 0x12, 0x04, 0x4c, 0x30, 0x54,
+  0x80, 0x23, 0x03, 0x54, 0x78, 0x54, 0x50, 0x81, 0x03, 0x80, 0x00, 0x01, 0x54, 0x78, 0x80, 0x43, 0x05, 0x78, 0x50, 0x2c, 0x4c, 0x2c, 0x54, 0x80,
+  0xa4, 0x80, 0xef, 0x00, 0x00, 0x80, 0x78, 0x05, 0x04, 0x2d, 0x04, 0x28, 0x00, 0x04, 0x80, 0x8c, 0x01, 0x4c, 0x2c, 0x80, 0x76, 0x82, 0x77, 0x82,
+  0x00, 0x82, 0x70, 0x80, 0xb6, 0x80, 0x40, 0x80, 0x11, 0x80, 0x08, 0x80, 0x71, 0x80, 0x4f, 0x81, 0x09, 0x80, 0x10, 0x80, 0x7d, 0x05, 0x78, 0x44,
+  0x2c, 0x2c, 0x08, 0x09, 0x80, 0x74, 0x80, 0x3e, 0x06, 0x24, 0x44, 0x88, 0x8d, 0x8c, 0x44, 0x24, 0x80, 0x4e, 0x06, 0x11, 0x16, 0x04, 0x4c, 0x2c,
+  0x50, 0x78, 0x80, 0x29, 0x81, 0x3b, 0x80, 0x70, 0x80, 0x81, 0x80, 0xae, 0x03, 0x30, 0x50, 0x78, 0x50, 0x80, 0x5e, 0x06, 0x2c, 0x4c, 0x70, 0x4c,
+  0x00, 0x28, 0x4c, 0x81, 0x28, 0x02, 0x04, 0x00, 0x28, 0x80, 0x70, 0x80, 0x2b, 0x81, 0x8e, 0x81, 0x26, 0x81, 0xa9, 0x81, 0x7b, 0x81, 0xa6, 0x81,
+  0xeb, 0x81, 0xf7, 0x80, 0x39, 0x01, 0x54, 0x30, 0x80, 0x46, 0x82, 0xc2, 0x81, 0x7d, 0x81, 0x00, 0x02, 0x40, 0x50, 0x4c, 0x80, 0x3d, 0x09, 0x4c,
+  0x28, 0x4c, 0x28, 0x00, 0x44, 0x44, 0x24, 0x44, 0x24, 0x80, 0x02, 0x05, 0x4c, 0x28, 0x08, 0x0d, 0x04, 0x2c, 0x84, 0x2f, 0x80, 0xb0, 0x80, 0x40,
+  0x80, 0x0b, 0x80, 0x04, 0x80, 0x52, 0x00, 0x50, 0x80, 0x62, 0x80, 0x00, 0x81, 0x06, 0x80, 0x80, 0x81, 0xe7, 0x02, 0x2c, 0x4c, 0x4c, 0x81, 0x12,
+  0x01, 0x50, 0x4c, 0x80, 0x95, 0x00, 0x30, 0x80, 0x5a, 0x01, 0x50, 0x2c, 0x81, 0xe3, 0x80, 0x3b, 0x89, 0x40, 0x81, 0xb3, 0x81, 0x0d, 0x83, 0x7d,
+  0x80, 0x7b, 0x03, 0x30, 0x20, 0x50, 0x50, 0x82, 0xaf, 0x0c, 0x2c, 0x4c, 0x24, 0x68, 0x8c, 0x44, 0x68, 0x48, 0x68, 0x68, 0x20, 0x4c, 0x94, 0x80,
+  0x8a, 0x01, 0x2c, 0x74, 0x81, 0xbf, 0x80, 0x28, 0x00, 0x74, 0x81, 0xac, 0x80, 0xc0, 0x80, 0x0b, 0x80, 0x41, 0x05, 0x74, 0x50, 0x54, 0x4c, 0x30,
+  0x54, 0x82, 0x77, 0x01, 0x2c, 0x70, 0x81, 0x81, 0x01, 0x70, 0x4c, 0x80, 0x3d, 0x01, 0x50, 0x2c, 0x80, 0x5b, 0x80, 0x00, 0x80, 0x5a, 0x83, 0x72,
+  0x01, 0x54, 0x30, 0x80, 0x28, 0x82, 0xf6, 0x81, 0x32, 0x80, 0x00, 0x80, 0xe9, 0x81, 0x49, 0x85, 0x8b, 0x02, 0x74, 0x30, 0x20, 0x82, 0xbd, 0x00,
+  0x4c, 0x80, 0xb5, 0x0d, 0x04, 0x44, 0x88, 0x8c, 0x88, 0x8c, 0x8c, 0x44, 0x04, 0x50, 0x70, 0x28, 0x2c, 0x28, 0x81, 0xb6, 0x80, 0x96, 0x81, 0x3b,
+  0x01, 0x50, 0x78, 0x81, 0xa1, 0x00, 0x78, 0x80, 0x3c, 0x81, 0xa8, 0x81, 0x44, 0x00, 0x74, 0x82, 0x6b, 0x81, 0xef, 0x80, 0x06, 0x01, 0x54, 0x54,
+  0x80, 0x42, 0x82, 0x66, 0x81, 0x95, 0x81, 0x6b, 0x81, 0xa5, 0x80, 0xd8, 0x85, 0x40, 0x02, 0x54, 0x54, 0x74, 0x81, 0x15, 0x83, 0x0d, 0x81, 0xcc,
+  0x81, 0x9a, 0x00, 0x00, 0x80, 0x3f, 0x80, 0xf0, 0x06, 0x4c, 0x28, 0x4c, 0x28, 0x00, 0x24, 0x44, 0x80, 0x00, 0x05, 0x00, 0x28, 0x4c, 0x4c, 0x28,
+  0x28, 0x80, 0x14, 0x02, 0x30, 0x74, 0x54, 0x81, 0x7b, 0x00, 0x54, 0x80, 0xa0, 0x83, 0x43, 0x80, 0x01, 0x80, 0x05, 0x80, 0x38, 0x02, 0x30, 0x78,
+  0x2c, 0x82, 0x6d, 0x00, 0x74, 0x81, 0x84, 0x82, 0x0d, 0x00, 0x74, 0x82, 0x6d, 0x00, 0x78, 0x82, 0x60, 0x81, 0xa5, 0x81, 0x23, 0x00, 0x30, 0x80,
+  0x40, 0x82, 0x31, 0x82, 0x7a, 0x81, 0x6b, 0x81, 0x09, 0x01, 0x78, 0x50, 0x82, 0x4e, 0x03, 0x50, 0x20, 0x70, 0x4c, 0x80, 0xb3, 0x00, 0x4c, 0x80,
+  0x6b, 0x0c, 0x2c, 0x4c, 0x48, 0x00, 0x00, 0x00, 0x90, 0x6c, 0x4c, 0x48, 0x4c, 0x70, 0x4c, 0x81, 0xca, 0x00, 0x30, 0x80, 0x28, 0x80, 0x2c, 0x00,
+  0x50, 0x80, 0x2a, 0x82, 0x41, 0x81, 0x62, 0x82, 0x15, 0x02, 0x50, 0x30, 0x2c, 0x80, 0x42, 0x80, 0x7b, 0x02, 0x74, 0x2c, 0x2c, 0x81, 0x20, 0x01,
+  0x30, 0x2c, 0x80, 0x1b, 0x00, 0x50, 0x80, 0x23, 0x00, 0x50, 0x80, 0x0d, 0x81, 0x26, 0x01, 0x54, 0x74, 0x83, 0x26, 0x81, 0x3c, 0x83, 0x40, 0x81,
+  0x89, 0x81, 0x77, 0x84, 0x7d, 0x04, 0x30, 0x78, 0x44, 0x70, 0x4c, 0x80, 0x64, 0x02, 0x28, 0x28, 0x4c, 0x81, 0x03, 0x0b, 0x28, 0x24, 0x24, 0x6c,
+  0x95, 0x4c, 0x28, 0x70, 0x70, 0x2c, 0x2c, 0x2c, 0x80, 0x26, 0x81, 0x97, 0x80, 0x02, 0x80, 0x35, 0x00, 0x50, 0x80, 0xe5, 0x80, 0x01, 0x00, 0x74,
+  0x80, 0x07, 0x80, 0x38, 0x81, 0x19, 0x02, 0x50, 0x54, 0x74, 0x80, 0x16, 0x80, 0x44, 0x81, 0x9c, 0x81, 0xe5, 0x80, 0x09, 0x80, 0xfd, 0x80, 0x7f,
+  0x80, 0x54, 0x83, 0x26, 0x00, 0x50, 0x84, 0x40, 0x80, 0x08, 0x81, 0x6a, 0x81, 0x34, 0x81, 0x8a, 0x82, 0x83, 0x03, 0x54, 0x20, 0x2c, 0x50, 0x80,
+  0xf0, 0x01, 0x4c, 0x28, 0x81, 0x03, 0x00, 0x28, 0x80, 0xf6, 0x80, 0xeb, 0x04, 0x28, 0x94, 0x71, 0x28, 0x4c, 0x80, 0x34, 0x83, 0x21, 0x02, 0x50,
+  0x50, 0x78, 0x81, 0xbe, 0x01, 0x78, 0x74, 0x85, 0x70, 0x81, 0x15, 0x81, 0x4d, 0x81, 0x70, 0x80, 0xe3, 0x81, 0xcc, 0x00, 0x78, 0x82, 0x5b, 0x80,
+  0x21, 0x80, 0x6f, 0x83, 0x0b, 0x80, 0x05, 0x80, 0x7a, 0x83, 0x7e, 0x80, 0x40, 0x01, 0x54, 0x30, 0x80, 0x29, 0x80, 0x38, 0x80, 0x77, 0x80, 0x0c,
+  0x80, 0x15, 0x06, 0x54, 0x20, 0x50, 0x50, 0x2c, 0x4c, 0x50, 0x80, 0xf4, 0x00, 0x70, 0x80, 0x70, 0x80, 0x04, 0x80, 0x06, 0x80, 0x7a, 0x02, 0x4c,
+  0x50, 0x2c, 0x80, 0x5a, 0x82, 0x39, 0x80, 0x33, 0x81, 0x81, 0x80, 0x04, 0x02, 0x54, 0x54, 0x74, 0x80, 0xd7, 0x81, 0xc2, 0x82, 0x53, 0x01, 0x74,
+  0x74, 0x80, 0x1c, 0x80, 0xc1, 0x80, 0x1a, 0x80, 0x6a, 0x01, 0x78, 0x74, 0x81, 0xe6, 0x80, 0xe8, 0x00, 0x54, 0x80, 0x18, 0x80, 0x5d, 0x81, 0x65,
+  0x83, 0xf9, 0x83, 0x40, 0x80, 0x26, 0x81, 0x6e, 0x81, 0x29, 0x82, 0x34, 0x05, 0x20, 0x78, 0x30, 0x2c, 0x50, 0x50, 0x81, 0x71, 0x01, 0x4c, 0x2c,
+  0x82, 0x73, 0x01, 0x70, 0x70, 0x80, 0x87, 0x00, 0x74, 0x82, 0x41, 0x80, 0x5c, 0x81, 0xb7, 0x81, 0xdb, 0x00, 0x78, 0x81, 0xe1, 0x80, 0x09, 0x81,
+  0x00, 0x82, 0x0d, 0x80, 0x74, 0x81, 0x6e, 0x80, 0x02, 0x80, 0xc9, 0x84, 0x89, 0x81, 0x01, 0x80, 0x02, 0x82, 0xad, 0x80, 0xe0, 0x80, 0x00, 0x81,
+  0x08, 0x81, 0x42, 0x82, 0x4e, 0x81, 0x3f, 0x00, 0x74, 0x81, 0x28, 0x80, 0x03, 0x04, 0x50, 0x00, 0x28, 0x54, 0x2c, 0x80, 0xf1, 0x80, 0x00, 0x02,
+  0x28, 0x28, 0x4c, 0x80, 0x7a, 0x80, 0xec, 0x00, 0x2c, 0x82, 0x7c, 0x84, 0x2a, 0x80, 0xdf, 0x80, 0x42, 0x80, 0x32, 0x82, 0x0d, 0x81, 0xbd, 0x84,
+  0x89, 0x83, 0x81, 0x00, 0x54, 0x80, 0x67, 0x02, 0x54, 0x54, 0x2c, 0x81, 0x86, 0x81, 0x7e, 0x81, 0xfd, 0x81, 0xd4, 0x00, 0x78, 0x82, 0xef, 0x81,
+  0x92, 0x00, 0x54, 0x81, 0x7f, 0x81, 0x26, 0x81, 0x6c, 0x80, 0x83, 0x84, 0x36, 0x0a, 0x78, 0x00, 0x24, 0x08, 0x28, 0x4c, 0x50, 0x70, 0x70, 0x50,
+  0x2c, 0x80, 0x77, 0x82, 0xef, 0x02, 0x50, 0x4c, 0x94, 0x80, 0x88, 0x80, 0xb8, 0x83, 0x9a, 0x82, 0x67, 0x01, 0x30, 0x78, 0x81, 0x04, 0x84, 0xf2,
+  0x81, 0x8c, 0x82, 0x1c, 0x00, 0x2c, 0x82, 0x0f, 0x81, 0x77, 0x81, 0xd4, 0x82, 0x1b, 0x80, 0xd9, 0x81, 0x20, 0x84, 0xa9, 0x00, 0x78, 0x82, 0xa8,
+  0x81, 0x03, 0x00, 0x30, 0x80, 0x4f, 0x80, 0x31, 0x80, 0x25, 0x00, 0x74, 0x81, 0x88, 0x0d, 0x54, 0x54, 0x24, 0x24, 0x2c, 0x2c, 0x28, 0x50, 0x70,
+  0x08, 0x50, 0x71, 0x71, 0x70, 0x80, 0xed, 0x00, 0x50, 0x80, 0xee, 0x05, 0x70, 0x90, 0x70, 0x08, 0x28, 0x74, 0x81, 0x77, 0x84, 0x6a, 0x84, 0xdc,
+  0x81, 0xb0, 0x00, 0x54, 0x83, 0x73, 0x80, 0x88, 0x82, 0xfa, 0x80, 0x0b, 0x83, 0x9b, 0x80, 0x10, 0x84, 0x91, 0x86, 0x9e, 0x81, 0x0d, 0x82, 0x3c,
+  0x82, 0x10, 0x80, 0x26, 0x80, 0x39, 0x81, 0x84, 0x00, 0x50, 0x80, 0x95, 0x03, 0x54, 0x54, 0x20, 0x24, 0x81, 0xdb, 0x81, 0x7a, 0x00, 0x6c, 0x81,
+  0x74, 0x00, 0x95, 0x81, 0xf3, 0x04, 0x2c, 0x50, 0x71, 0x50, 0x30, 0x81, 0xb7, 0x83, 0x3f, 0x81, 0x3d, 0x82, 0x47, 0x80, 0xc5, 0x80, 0x66, 0x82,
+  0x70, 0x80, 0x5f, 0x00, 0x2c, 0x82, 0x6c, 0x84, 0x26, 0x81, 0xe6, 0x82, 0xee, 0x80, 0x2d, 0x00, 0x50, 0x81, 0x5f, 0x81, 0x19, 0x80, 0x18, 0x80,
+  0x6b, 0x00, 0x2c, 0x85, 0x25, 0x81, 0x6e, 0x80, 0xcd, 0x01, 0x30, 0x58, 0x81, 0x80, 0x06, 0x20, 0x48, 0x50, 0x70, 0x50, 0x50, 0x70, 0x80, 0x00,
+  0x10, 0x75, 0x50, 0x4c, 0x94, 0x4c, 0x2c, 0x95, 0x4c, 0x4c, 0x28, 0x2c, 0x2c, 0x70, 0x70, 0x74, 0x50, 0x74, 0x82, 0x2e, 0x81, 0x61, 0x80, 0xdb,
+  0x84, 0x4d, 0x80, 0x03, 0x83, 0x4c, 0x82, 0x41, 0x81, 0xc4, 0x81, 0xbe, 0x80, 0x4b, 0x81, 0x12, 0x82, 0xa6, 0x01, 0x30, 0x50, 0x81, 0xf8, 0x80,
+  0x04, 0x80, 0xa4, 0x85, 0x22, 0x02, 0x54, 0x54, 0x58, 0x83, 0x72, 0x82, 0xfd, 0x80, 0x13, 0x80, 0xa5, 0x05, 0x20, 0x48, 0x30, 0x2c, 0x50, 0x4c,
+  0x80, 0xe3, 0x02, 0x4c, 0x51, 0x50, 0x80, 0xeb, 0x01, 0x70, 0x74, 0x80, 0xef, 0x81, 0xff, 0x00, 0x78, 0x80, 0x9d, 0x00, 0x50, 0x81, 0x28, 0x81,
+  0x4b, 0x81, 0x66, 0x80, 0xd2, 0x81, 0x45, 0x80, 0xe7, 0x80, 0x6b, 0x01, 0x2c, 0x50, 0x80, 0x4f, 0x80, 0xb8, 0x82, 0x44, 0x84, 0x90, 0x81, 0x73,
+  0x80, 0x00, 0x01, 0x30, 0x50, 0x81, 0xd7, 0x03, 0x78, 0x54, 0x78, 0x74, 0x81, 0xe4, 0x80, 0x8f, 0x82, 0x6e, 0x80, 0x13, 0x81, 0x9a, 0x81, 0x93,
+  0x80, 0x09, 0x80, 0x12, 0x0b, 0x20, 0x24, 0x2c, 0x2c, 0x28, 0x28, 0x28, 0x4c, 0x70, 0x70, 0x4c, 0x28, 0x80, 0x73, 0x81, 0x75, 0x05, 0x4c, 0x74,
+  0x70, 0x08, 0x08, 0x4c, 0x82, 0xaf, 0x82, 0x7b, 0x81, 0x6c, 0x80, 0xd1, 0x82, 0xe5, 0x00, 0x2c, 0x83, 0x86, 0x81, 0x52, 0x80, 0x06, 0x81, 0x6c,
+  0x80, 0x0a, 0x00, 0x50, 0x80, 0xcf, 0x82, 0xd6, 0x80, 0xf9, 0x00, 0x78, 0x80, 0x30, 0x82, 0x2f, 0x80, 0x90, 0x81, 0x67, 0x02, 0x30, 0x30, 0x50,
+  0x81, 0x08, 0x81, 0x98, 0x81, 0x91, 0x83, 0x7a, 0x80, 0x59, 0x02, 0x20, 0x00, 0x2c, 0x80, 0x00, 0x13, 0x4c, 0x4c, 0x71, 0x4c, 0x70, 0x28, 0x70,
+  0x70, 0x70, 0x50, 0x4c, 0x28, 0x50, 0x2c, 0x4c, 0x94, 0x74, 0x50, 0x2c, 0x2c, 0x82, 0x2d, 0x81, 0xe4, 0x82, 0x06, 0x82, 0x31, 0x82, 0xbb, 0x81,
+  0x8b, 0x01, 0x50, 0x78, 0x81, 0x90, 0x81, 0x8d, 0x80, 0xd2, 0x81, 0x6d, 0x80, 0x07, 0x83, 0xa1, 0x83, 0xa4, 0x82, 0x77, 0x83, 0xe9, 0x00, 0x2c,
+  0x80, 0x98, 0x84, 0x12, 0x80, 0xaf, 0x00, 0x2c, 0x80, 0x39, 0x81, 0xa8, 0x02, 0x50, 0x00, 0x00, 0x80, 0xe0, 0x00, 0x50, 0x80, 0xe6, 0x01, 0x4c,
+  0x95, 0x80, 0x02, 0x0c, 0x95, 0x99, 0x71, 0x74, 0x50, 0x50, 0x50, 0x74, 0x78, 0x74, 0x50, 0x30, 0x30, 0x82, 0x4f, 0x82, 0x69, 0x82, 0x4c, 0x81,
+  0x77, 0x80, 0x0a, 0x80, 0x68, 0x83, 0x39, 0x82, 0xe8, 0x82, 0x7e, 0x80, 0xe8, 0x82, 0xce, 0x82, 0x9e, 0x82, 0x0f, 0x80, 0x09, 0x82, 0x83, 0x80,
+  0x2b, 0x00, 0x2c, 0x80, 0x17, 0x00, 0x78, 0x81, 0x1b, 0x02, 0x78, 0x30, 0x2c, 0x81, 0x45, 0x81, 0x27, 0x80, 0xf9, 0x03, 0x20, 0x48, 0x75, 0x2c,
+  0x80, 0xe7, 0x03, 0x70, 0x70, 0x95, 0x4c, 0x80, 0xef, 0x0b, 0x2c, 0x70, 0x71, 0x75, 0x2c, 0x4c, 0x74, 0x4c, 0x2c, 0x50, 0x50, 0x70, 0x81, 0x55,
+  0x82, 0x60, 0x00, 0x74, 0x82, 0x05, 0x81, 0x31, 0x01, 0x78, 0x58, 0x82, 0xe1, 0x82, 0x8f, 0x82, 0x1d, 0x80, 0x5c, 0x81, 0x68, 0x00, 0x50, 0x81,
+  0x15, 0x81, 0xd5, 0x00, 0x50, 0x80, 0x66, 0x82, 0x09, 0x81, 0x9d, 0x83, 0xa5, 0x80, 0x65, 0x82, 0xb4, 0x03, 0x50, 0x54, 0x58, 0x30, 0x81, 0xd1,
+  0x84, 0x0e, 0x0a, 0x20, 0x6c, 0x50, 0x28, 0x4c, 0x94, 0x50, 0x4c, 0x70, 0x6c, 0x28, 0x81, 0x77, 0x05, 0x50, 0x4c, 0x51, 0x2c, 0x28, 0x2c, 0x80,
+  0x06, 0x02, 0x28, 0x70, 0x98, 0x81, 0x3d, 0x02, 0x54, 0x78, 0x74, 0x81, 0xb7, 0x80, 0x7b, 0x00, 0x30, 0x80, 0xae, 0x81, 0x66, 0x82, 0x8b, 0x81,
+  0xf2, 0x80, 0x03, 0x84, 0xdc, 0x80, 0x07, 0x80, 0x88, 0x81, 0x8f, 0x00, 0x30, 0x83, 0xac, 0x81, 0x16, 0x00, 0x78, 0x83, 0x8a, 0x82, 0x82, 0x83,
+  0xad, 0x00, 0x78, 0x80, 0xbb, 0x80, 0x21, 0x83, 0x15, 0x16, 0x20, 0x24, 0x50, 0x2c, 0x2c, 0x4c, 0x28, 0x28, 0x4c, 0x4c, 0x71, 0x4c, 0x4c, 0x74,
+  0x50, 0x4c, 0x94, 0x70, 0x2c, 0x4c, 0x70, 0x70, 0x50, 0x80, 0x8c, 0x81, 0x41, 0x81, 0x5f, 0x81, 0xb4, 0x81, 0x51, 0x83, 0xa8, 0x80, 0x08, 0x80,
+  0x62, 0x80, 0x17, 0x80, 0x1e, 0x81, 0x43, 0x02, 0x30, 0x54, 0x74, 0x82, 0xe8, 0x80, 0xcb, 0x85, 0x0d, 0x04, 0x50, 0x50, 0x30, 0x30, 0x74, 0x83,
+  0x24, 0x00, 0x74, 0x81, 0x26, 0x00, 0x50, 0x80, 0xba, 0x84, 0xe5, 0x01, 0x54, 0x30, 0x80, 0xc0, 0x80, 0x92, 0x08, 0x50, 0x30, 0x00, 0x24, 0x2c,
+  0x50, 0x50, 0x2c, 0x04, 0x80, 0xeb, 0x81, 0x6b, 0x80, 0x76, 0x01, 0x70, 0x4c, 0x80, 0x78, 0x04, 0x74, 0x50, 0x50, 0x70, 0x2c, 0x81, 0x20, 0x81,
+  0x9f, 0x80, 0x2b, 0x01, 0x54, 0x50, 0x81, 0x04, 0x82, 0x7d, 0x00, 0x2c, 0x81, 0x0c, 0x82, 0xb5, 0x86, 0x4d, 0x82, 0xe7, 0x82, 0xfb, 0x00, 0x30,
+  0x83, 0xee, 0x00, 0x30, 0x81, 0x07, 0x81, 0xe4, 0x02, 0x50, 0x54, 0x74, 0x82, 0x17, 0x85, 0xfa, 0x83, 0x1d, 0x80, 0x7e, 0x80, 0xef, 0x02, 0x04,
+  0x2c, 0x54, 0x80, 0xef, 0x0b, 0x91, 0x4c, 0x2c, 0x70, 0x4c, 0x70, 0x08, 0x50, 0x74, 0x2c, 0x50, 0x4c, 0x80, 0x82, 0x80, 0x1f, 0x00, 0x74, 0x81,
+  0x34, 0x80, 0x67, 0x80, 0x43, 0x00, 0x78, 0x82, 0x4e, 0x83, 0x3e, 0x83, 0x5f, 0x82, 0xff, 0x00, 0x50, 0x82, 0xf4, 0x80, 0x88, 0x81, 0x4a, 0x80,
+  0xa6, 0x81, 0x0e, 0x83, 0x59, 0x80, 0x09, 0x80, 0xf0, 0x86, 0x94, 0x81, 0x3f, 0x81, 0x53, 0x00, 0x50, 0x80, 0x71, 0x84, 0x86, 0x02, 0x20, 0x48,
+  0x2c, 0x80, 0xf0, 0x00, 0x74, 0x81, 0xeb, 0x00, 0x28, 0x80, 0xf8, 0x00, 0x4c, 0x80, 0xf7, 0x00, 0x2c, 0x81, 0x7c, 0x80, 0xf1, 0x83, 0xa4, 0x81,
+  0x53, 0x82, 0x4a, 0x80, 0x48, 0x00, 0x78, 0x81, 0x64, 0x81, 0x4a, 0x81, 0xc9, 0x81, 0x64, 0x82, 0xba, 0x80, 0x3e, 0x81, 0x1f, 0x80, 0x04, 0x84,
+  0x75, 0x02, 0x30, 0x30, 0x58, 0x80, 0x03, 0x81, 0x1a, 0x84, 0x7b, 0x81, 0x86, 0x81, 0x08, 0x01, 0x70, 0x90, 0x84, 0x52, 0x00, 0x50, 0x80, 0xef,
+  0x81, 0x6d, 0x80, 0x00, 0x01, 0x90, 0x95, 0x80, 0x74, 0x81, 0x77, 0x00, 0x70, 0x81, 0x88, 0x00, 0x78, 0x80, 0xed, 0x84, 0x9a, 0x83, 0x5b, 0x84,
+  0xf0, 0x84, 0x59, 0x80, 0x12, 0x81, 0x7d, 0x80, 0x8a, 0x80, 0x05, 0x00, 0x74, 0x81, 0xf1, 0x81, 0x58, 0x81, 0x66, 0x83, 0x02, 0x04, 0x54, 0x54,
+  0x2c, 0x54, 0x58, 0x82, 0xec, 0x80, 0x03, 0x01, 0x78, 0x74, 0x80, 0xab, 0x82, 0x18, 0x02, 0x78, 0xb4, 0x2c, 0x82, 0x27, 0x80, 0xd3, 0x00, 0x00,
+  0x81, 0x77, 0x01, 0x50, 0x4c, 0x80, 0x70, 0x06, 0x4c, 0x2c, 0x70, 0x6c, 0x08, 0x50, 0x50, 0x80, 0x82, 0x00, 0x70, 0x80, 0xc1, 0x00, 0x50, 0x84,
+  0xaa, 0x83, 0x7b, 0x00, 0x50, 0x81, 0xae, 0x80, 0x0a, 0x01, 0x78, 0x78, 0x80, 0x50, 0x83, 0x90, 0x80, 0x4c, 0x81, 0x8d, 0x80, 0xba, 0x00, 0x54,
+  0x82, 0x2b, 0x81, 0x81, 0x82, 0x18, 0x00, 0x50, 0x81, 0x8e, 0x82, 0x7c, 0x81, 0xba, 0x83, 0xf5, 0x01, 0x78, 0x58, 0x80, 0xca, 0x02, 0x50, 0x2c,
+  0x54, 0x80, 0xcd, 0x82, 0xfb, 0x00, 0x30, 0x80, 0x77, 0x80, 0xde, 0x0a, 0x4c, 0x70, 0x6c, 0x70, 0x28, 0x70, 0x4c, 0x50, 0x71, 0x50, 0x74, 0x80,
+  0x7d, 0x00, 0x4c, 0x80, 0x75, 0x03, 0x2c, 0x4c, 0x30, 0x2c, 0x80, 0x4f, 0x82, 0x42, 0x81, 0xa8, 0x81, 0xf2, 0x80, 0x46, 0x01, 0x54, 0x74, 0x80,
+  0x45, 0x81, 0x94, 0x01, 0x74, 0x78, 0x81, 0x8a, 0x82, 0x42, 0x00, 0x74, 0x80, 0x02, 0x00, 0x78, 0x82, 0x63, 0x83, 0xa8, 0x81, 0x8c, 0x01, 0x30,
+  0x50, 0x82, 0xaa, 0x83, 0x13, 0x80, 0x00, 0x82, 0x86, 0x81, 0x07, 0x80, 0x00, 0x80, 0x7d, 0x80, 0x07, 0x81, 0x77, 0x80, 0x78, 0x00, 0x28, 0x80,
+  0xe5, 0x09, 0x70, 0x28, 0x4c, 0x70, 0x95, 0x4c, 0x4c, 0x90, 0x4c, 0x50, 0x80, 0xef, 0x01, 0x54, 0x2c, 0x81, 0x66, 0x80, 0x5a, 0x00, 0x2c, 0x82,
+  0x9e, 0x81, 0x00, 0x81, 0x48, 0x80, 0x05, 0x80, 0xdd, 0x83, 0x40, 0x81, 0x05, 0x00, 0x74, 0x80, 0x9e, 0x81, 0x46, 0x81, 0x96, 0x84, 0xcb, 0x80,
+  0xae, 0x81, 0xa2, 0x82, 0xe6, 0x81, 0x6a, 0x82, 0xfd, 0x01, 0x50, 0x34, 0x80, 0xef, 0x80, 0x24, 0x82, 0x4c, 0x80, 0x03, 0x0c, 0x30, 0x00, 0x24,
+  0x50, 0x4c, 0x4c, 0x50, 0x2c, 0x70, 0x70, 0x70, 0x6c, 0x4c, 0x80, 0x00, 0x00, 0x70, 0x81, 0xef, 0x02, 0x28, 0x4c, 0x74, 0x82, 0xdd, 0x81, 0xe6,
+  0x00, 0x50, 0x82, 0x05, 0x83, 0x68, 0x81, 0x6a, 0x81, 0xd9, 0x81, 0x10, 0x81, 0x92, 0x81, 0x52, 0x83, 0xe5, 0x82, 0x52, 0x80, 0x85, 0x83, 0xaa,
+  0x81, 0x0f, 0x82, 0xe8, 0x81, 0x44, 0x80, 0x07, 0x80, 0x4d, 0x80, 0x19, 0x00, 0x50, 0x82, 0x72, 0x02, 0x50, 0x50, 0x58, 0x82, 0x87, 0x06, 0x00,
+  0x48, 0x50, 0x50, 0x95, 0x4c, 0x08, 0x80, 0x70, 0x80, 0x7a, 0x06, 0x4c, 0x4c, 0x71, 0x71, 0x4c, 0x4d, 0x28, 0x80, 0x7c, 0x00, 0x30, 0x80, 0x29,
+  0x80, 0x26, 0x82, 0x22, 0x85, 0xdb, 0x80, 0x5a, 0x81, 0xbd, 0x00, 0x2c, 0x81, 0x0d, 0x02, 0x30, 0x54, 0x74, 0x80, 0x5e, 0x80, 0xcf, 0x82, 0x69,
+  0x00, 0x54, 0x82, 0xc6, 0x80, 0x10, 0x83, 0xa1, 0x82, 0x77, 0x81, 0xb3, 0x82, 0x11, 0x01, 0x54, 0x78, 0x81, 0x0a, 0x80, 0x08, 0x80, 0xb2, 0x80,
+  0x7e, 0x82, 0x0a, 0x01, 0x30, 0x54, 0x80, 0x77, 0x02, 0x2c, 0x2c, 0x50, 0x80, 0x71, 0x0d, 0x4c, 0x4c, 0x28, 0x70, 0x70, 0x28, 0x50, 0x71, 0x4c,
+  0x28, 0x08, 0x4c, 0x4c, 0x50, 0x80, 0xa9, 0x80, 0x1f, 0x81, 0x4d, 0x80, 0x6e, 0x00, 0x2c, 0x80, 0x60, 0x81, 0x7d, 0x80, 0x39, 0x80, 0x12, 0x80,
+  0x1a, 0x80, 0x57, 0x80, 0x53, 0x82, 0x54, 0x81, 0x44, 0x81, 0x26, 0x80, 0x0d, 0x00, 0x78, 0x81, 0x18, 0x83, 0x62, 0x81, 0x0d, 0x00, 0x30, 0x80,
+  0xe7, 0x84, 0x22, 0x82, 0xb6, 0x00, 0x30, 0x81, 0x31, 0x80, 0xb6, 0x83, 0x86, 0x05, 0x00, 0x48, 0x54, 0x2c, 0x28, 0x50, 0x81, 0xec, 0x80, 0x7b,
+  0x09, 0x70, 0x95, 0x2c, 0x4c, 0x74, 0x4c, 0x08, 0x70, 0x74, 0x4c, 0x80, 0xcf, 0x81, 0x25, 0x82, 0x6a, 0x84, 0xd2, 0x81, 0x06, 0x82, 0x6c, 0x82,
+  0x7d, 0x02, 0x78, 0x50, 0x2c, 0x81, 0x8a, 0x00, 0x50, 0x80, 0x49, 0x00, 0x0c, 0x83, 0x17, 0x01, 0x30, 0x78, 0x81, 0x27, 0x80, 0x6e, 0x82, 0xad,
+  0x80, 0x24, 0x83, 0xe3, 0x84, 0x3c, 0x80, 0xc7, 0x83, 0x09, 0x00, 0x58, 0x82, 0x23, 0x03, 0x54, 0x20, 0x48, 0x50, 0x80, 0xdd, 0x0c, 0x28, 0x4c,
+  0x90, 0x70, 0x28, 0x4c, 0x4c, 0x2c, 0x70, 0x50, 0x70, 0x95, 0x95, 0x81, 0x84, 0x81, 0xd0, 0x81, 0x7a, 0x84, 0x77, 0x82, 0x48, 0x81, 0x0b, 0x83,
+  0x8c, 0x80, 0xc9, 0x80, 0x3c, 0x81, 0xde, 0x81, 0x7c, 0x81, 0x08, 0x81, 0x7a, 0x82, 0xee, 0x03, 0x54, 0x74, 0x50, 0x78, 0x81, 0x64, 0x82, 0x72,
+  0x81, 0x69, 0x80, 0x12, 0x80, 0x6a, 0x85, 0x00, 0x02, 0x30, 0x54, 0x7c, 0x82, 0x77, 0x07, 0x30, 0x20, 0x28, 0x30, 0x50, 0x74, 0x2c, 0x2c, 0x80,
+  0x7c, 0x01, 0x2c, 0x2c, 0x80, 0x77, 0x00, 0x4c, 0x80, 0x01, 0x80, 0x75, 0x03, 0x4c, 0x2c, 0x0c, 0x2c, 0x82, 0x71, 0x81, 0xa4, 0x82, 0xe7, 0x82,
+  0x5a, 0x81, 0x51, 0x01, 0x54, 0x74, 0x81, 0x10, 0x81, 0x7e, 0x83, 0xfd, 0x01, 0x30, 0x58, 0x81, 0x7a, 0x82, 0xc3, 0x81, 0x31, 0x80, 0x70, 0x82,
+  0x99, 0x80, 0x2b, 0x81, 0x33, 0x81, 0x8c, 0x83, 0x42, 0x80, 0x16, 0x80, 0xa5, 0x81, 0xb2, 0x07, 0x2c, 0x54, 0x78, 0x74, 0x30, 0x20, 0x04, 0x2c,
+  0x80, 0x0e, 0x01, 0x4c, 0x50, 0x80, 0x6c, 0x04, 0x2c, 0x2c, 0x74, 0x95, 0x28, 0x80, 0x7f, 0x80, 0xf8, 0x03, 0x28, 0x50, 0x50, 0x2c, 0x80, 0x60,
+  0x84, 0x43, 0x02, 0x78, 0x54, 0x75, 0x82, 0x82, 0x81, 0x4b, 0x81, 0xdb, 0x83, 0x48, 0x82, 0x04, 0x83, 0x5d, 0x81, 0x27, 0x81, 0x09, 0x81, 0x03,
+  0x81, 0x7f, 0x00, 0x74, 0x81, 0x26, 0x03, 0x74, 0x54, 0x58, 0x58, 0x81, 0x3b, 0x80, 0x24, 0x80, 0xb6, 0x02, 0x2c, 0x0c, 0x78, 0x80, 0x77, 0x80,
+  0x42, 0x01, 0x74, 0x30, 0x80, 0x77, 0x07, 0x54, 0x30, 0xac, 0x28, 0x50, 0x2c, 0x08, 0x50, 0x81, 0xe5, 0x02, 0x2c, 0x4c, 0x50, 0x80, 0xed, 0x03,
+  0x75, 0x95, 0x50, 0x04, 0x80, 0x0c, 0x02, 0x74, 0x54, 0x0c, 0x80, 0x3f, 0x00, 0x2c, 0x84, 0x5d, 0x84, 0x5f, 0x81, 0x09, 0x00, 0x50, 0x80, 0xd9,
+  0x82, 0x09, 0x80, 0x4b, 0x00, 0x30, 0x81, 0xfb, 0x80, 0x0a, 0x00, 0x58, 0x82, 0x19, 0x80, 0xf1, 0x81, 0x60, 0x82, 0x11, 0x82, 0x7e, 0x80, 0x8b,
+  0x80, 0x05, 0x83, 0x0e, 0x01, 0x54, 0x2c, 0x80, 0x4b, 0x02, 0x2c, 0x50, 0x78, 0x81, 0xfe, 0x80, 0x42, 0x0b, 0x54, 0x50, 0xac, 0x48, 0x74, 0x30,
+  0x54, 0x50, 0x2c, 0x4c, 0x4c, 0x71, 0x80, 0x75, 0x0a, 0x50, 0x70, 0x50, 0x74, 0x95, 0x70, 0x4c, 0x74, 0x70, 0x74, 0x78, 0x80, 0x9a, 0x00, 0x30,
+  0x81, 0x32, 0x01, 0x50, 0x50, 0x81, 0xe5, 0x80, 0xb6, 0x83, 0x6a, 0x82, 0x38, 0x83, 0x87, 0x81, 0x52, 0x80, 0x58, 0x80, 0x3e, 0x81, 0x9c, 0x80,
+  0x1a, 0x82, 0x69, 0x81, 0x53, 0x82, 0x67, 0x81, 0x96, 0x82, 0x02, 0x80, 0x3f, 0x00, 0x50, 0x80, 0x72, 0x81, 0x4a, 0x82, 0x28, 0x00, 0x50, 0x80,
+  0x08, 0x0d, 0x30, 0x54, 0xac, 0x6c, 0x50, 0x08, 0x2c, 0x50, 0x70, 0x70, 0x28, 0x51, 0x70, 0x70, 0x80, 0xf5, 0x03, 0x50, 0x75, 0x70, 0x50, 0x80,
+  0xf7, 0x02, 0x2c, 0x54, 0x30, 0x81, 0xac, 0x80, 0x65, 0x00, 0x74, 0x82, 0x51, 0x80, 0x60, 0x00, 0x50, 0x82, 0xbd, 0x80, 0x5c, 0x81, 0xe8, 0x82,
+  0x1d, 0x80, 0x5f, 0x00, 0x74, 0x80, 0xa8, 0x82, 0x57, 0x84, 0xd5, 0x80, 0x8e, 0x00, 0x78, 0x81, 0x86, 0x82, 0x2a, 0x82, 0x67, 0x83, 0xde, 0x82,
+  0xb9, 0x80, 0xf1, 0x82, 0x0e, 0x81, 0xc8, 0x08, 0x54, 0xd0, 0x48, 0x54, 0x08, 0x08, 0x2c, 0x4c, 0x4d, 0x80, 0x72, 0x04, 0x4c, 0x4c, 0x2c, 0x4c,
+  0x28, 0x80, 0x74, 0x80, 0x01, 0x00, 0x2c, 0x81, 0x33, 0x02, 0x30, 0x30, 0x79, 0x80, 0x32, 0x81, 0xa9, 0x80, 0xd3, 0x80, 0x6d, 0x80, 0x2d, 0x82,
+  0x54, 0x83, 0x62, 0x80, 0x11, 0x80, 0x70, 0x00, 0x70, 0x81, 0x05, 0x81, 0x02, 0x81, 0x73, 0x81, 0x76, 0x00, 0x30, 0x82, 0x39, 0x80, 0x2d, 0x02,
+  0x78, 0x30, 0x2c, 0x82, 0x7e, 0x80, 0x06, 0x01, 0x74, 0x58, 0x80, 0x2e, 0x00, 0x74, 0x81, 0x39, 0x00, 0x74, 0x80, 0x28, 0x82, 0x31, 0x0a, 0x30,
+  0xd0, 0x28, 0x30, 0x2c, 0x2c, 0x2c, 0x2d, 0x08, 0x70, 0x99, 0x81, 0x76, 0x0f, 0x95, 0x94, 0x4c, 0x70, 0x70, 0x2c, 0x74, 0x74, 0x4c, 0x50, 0x30,
+  0x2c, 0x50, 0x2c, 0x30, 0x75, 0x82, 0x65, 0x00, 0x74, 0x80, 0xba, 0x80, 0xa6, 0x82, 0x6f, 0x80, 0xe8, 0x81, 0x05, 0x81, 0x82, 0x82, 0xfd, 0x80,
+  0xee, 0x80, 0x48, 0x00, 0x74, 0x82, 0x83, 0x81, 0xe7, 0x80, 0x1b, 0x81, 0x16, 0x82, 0x9e, 0x00, 0x2c, 0x80, 0x06, 0x00, 0x50, 0x81, 0x68, 0x80,
+  0x3f, 0x81, 0x8b, 0x80, 0x1c, 0x80, 0x07, 0x80, 0x4b, 0x81, 0x27, 0x80, 0x77, 0x80, 0xdf, 0x00, 0x75, 0x80, 0xe4, 0x0e, 0x4c, 0x2c, 0x50, 0x70,
+  0x2c, 0x2c, 0x95, 0x4c, 0x70, 0x28, 0x50, 0x74, 0x74, 0x50, 0x50, 0x80, 0x51, 0x80, 0xe6, 0x81, 0x63, 0x00, 0x54, 0x80, 0xc2, 0x80, 0xc7, 0x81,
+  0x4a, 0x81, 0x3c, 0x01, 0x78, 0x74, 0x80, 0xc2, 0x87, 0x00, 0x80, 0x46, 0x81, 0x26, 0x85, 0x02, 0x82, 0xec, 0x80, 0x9b, 0x82, 0xb1, 0x81, 0x2b,
+  0x80, 0x94, 0x82, 0x79, 0x80, 0x3a, 0x80, 0x2a, 0x82, 0x45, 0x00, 0x50, 0x80, 0x54, 0x04, 0xd0, 0x24, 0x50, 0x2c, 0x2c, 0x80, 0x65, 0x05, 0x75,
+  0x4c, 0x4c, 0x50, 0x50, 0x70, 0x80, 0x02, 0x01, 0x71, 0x70, 0x80, 0x83, 0x80, 0x75, 0x80, 0x2e, 0x80, 0xd2, 0x80, 0xc6, 0x80, 0xac, 0x81, 0xb5,
+  0x81, 0xc7, 0x82, 0xf6, 0x02, 0x54, 0x54, 0x74, 0x81, 0x6e, 0x81, 0x07, 0x81, 0xeb, 0x80, 0xbb, 0x81, 0xcd, 0x80, 0x1e, 0x00, 0x74, 0x81, 0xed,
+  0x80, 0x2e, 0x02, 0x50, 0x54, 0x58, 0x81, 0xac, 0x00, 0x78, 0x83, 0xdd, 0x81, 0x22, 0x83, 0x93, 0x80, 0x1e, 0x80, 0x31, 0x82, 0xab, 0x01, 0x50,
+  0x54,
+};
+const PackedSheet packedBg = {120, 120, 1, 1, packedBgOffsets, packedBgData, NULL};
+
+// bubble.h: 32x32 frames, 1 across, 1 down; 88 bytes, from 2048
+static const uint32_t packedBubbleOffsets[] PROGMEM = {
+  0, 88,
+};
+static const uint8_t packedBubbleData[] PROGMEM = {
+  0x00, 0x1c, 0xc1, 0x00, 0x00, 0x00, 0x93, 0x00, 0x86, 0x1e, 0x00, 0xff, 0x93, 0x00, 0x84, 0x20, 0x95, 0x1e, 0x84, 0x20, 0x00, 0xdb, 0xff, 0x1f,
+  0xff, 0x1f, 0xff, 0x1f, 0xff, 0x1f, 0x95, 0x1f, 0x96, 0x20, 0x82, 0x1e, 0x82, 0x20, 0x82, 0x00, 0x81, 0x11, 0x8a, 0x00, 0x83, 0x1e, 0x81, 0x20,
+  0x81, 0x00, 0x83, 0x1f, 0x83, 0x0b, 0x81, 0x00, 0x85, 0x1d, 0x85, 0x24, 0x83, 0x1f, 0x8c, 0x15, 0xa7, 0x1f, 0x00, 0x3c, 0x82, 0xa5, 0x97, 0x1f,
+  0x83, 0x20, 0x98, 0x1f, 0x80, 0x20, 0x88, 0xb3, 0x92, 0x82, 0x81, 0xc5, 0x99, 0x20, 0x90, 0x00,
+};
+const PackedSheet packedBubble = {32, 32, 1, 1, packedBubbleOffsets, packedBubbleData, NULL};
+
+// emoji.h: 16x16 frames, 13 across, 1 down; 1297 bytes, from 6656
+static const uint32_t packedEmojisOffsets[] PROGMEM = {
+  0, 67, 174, 262, 385, 503, 680, 741, 845, 985, 1047, 1095,
+  1163, 1297,
+};
+static const uint8_t packedEmojisData[] PROGMEM = {
+  0x02, 0x1c, 0x1c, 0x40, 0x80, 0x00, 0x00, 0x1c, 0x80, 0x00, 0x84, 0x07, 0x01, 0x40, 0xe9, 0x80, 0x00, 0x80, 0x08, 0x84, 0x07, 0x82, 0x06, 0x80,
+  0x08, 0x8c, 0x07, 0x85, 0x00, 0xbe, 0x0f, 0x85, 0x60, 0x85, 0x0e, 0x80, 0x78, 0x00, 0xc9, 0x85, 0x0d, 0x00, 0xc9, 0x82, 0x97, 0x86, 0x10, 0x84,
+  0x0e, 0x85, 0x10, 0x86, 0x0e, 0x83, 0x10, 0x88, 0x0e, 0x81, 0x10, 0x8a, 0x0e, 0x81, 0xdc, 0x8a, 0x0e, 0x87, 0x00, 0x00, 0x1c, 0x83, 0x00, 0x00,
+  0x44, 0x84, 0x07, 0x85, 0x00, 0x00, 0x44, 0x8b, 0x10, 0x02, 0x44, 0xb1, 0xb1, 0x89, 0x10, 0x80, 0x0e, 0x8d, 0x0f, 0x00, 0x44, 0x89, 0x10, 0x04,
+  0x44, 0x44, 0x44, 0xb1, 0xad, 0x87, 0x10, 0x81, 0x2e, 0x01, 0xad, 0xad, 0x86, 0x52, 0x84, 0x0e, 0x01, 0x24, 0xad, 0x84, 0x10, 0x82, 0x0f, 0x01,
+  0x44, 0xad, 0x80, 0x00, 0x82, 0x10, 0x02, 0x44, 0x44, 0x24, 0x80, 0x3f, 0x82, 0x0e, 0x81, 0x0f, 0x81, 0x4a, 0x83, 0x00, 0x80, 0x14, 0x01, 0x44,
+  0x1c, 0x80, 0x18, 0x83, 0x1c, 0x82, 0x06, 0x82, 0x0f, 0x80, 0x06, 0x86, 0x03, 0x84, 0x10, 0x83, 0x1c, 0x82, 0x20, 0x84, 0x10, 0x84, 0x20, 0x84,
+  0x9d, 0x85, 0x00, 0x01, 0x1c, 0x1c, 0x00, 0x1c, 0x81, 0x00, 0x00, 0x44, 0x82, 0x00, 0x82, 0x0a, 0x81, 0x0d, 0x01, 0x64, 0xe8, 0x82, 0x00, 0x00,
+  0x64, 0x83, 0x11, 0x84, 0x0d, 0x82, 0x11, 0x81, 0x1d, 0x87, 0x0e, 0x01, 0xe8, 0xe8, 0x80, 0x21, 0x88, 0x1e, 0x81, 0x20, 0x81, 0x1e, 0x00, 0x44,
+  0x82, 0x23, 0x82, 0x05, 0x83, 0x0a, 0x00, 0xe8, 0x80, 0x05, 0x84, 0x08, 0x84, 0x1a, 0x81, 0x00, 0x89, 0x0f, 0x8a, 0x34, 0x8e, 0x0f, 0x89, 0x70,
+  0x82, 0x6f, 0x85, 0x3e, 0x80, 0x90, 0x82, 0x65, 0x84, 0x63, 0x81, 0x8f, 0x8d, 0xaf, 0x81, 0xdd, 0x84, 0x3b, 0x87, 0xe1, 0x87, 0xef, 0x00, 0x1c,
+  0x81, 0x00, 0x00, 0x48, 0x82, 0x00, 0x82, 0x0a, 0x81, 0x0d, 0x01, 0x68, 0xf8, 0x82, 0x00, 0x00, 0x68, 0x83, 0x11, 0x84, 0x0d, 0x82, 0x11, 0x81,
+  0x1d, 0x87, 0x0e, 0x01, 0xf8, 0xf8, 0x80, 0x21, 0x88, 0x1e, 0x80, 0x20, 0x00, 0x3c, 0x81, 0x1e, 0x00, 0x68, 0x82, 0x13, 0x82, 0x05, 0x00, 0x48,
+  0x80, 0x0f, 0x80, 0x07, 0x86, 0x02, 0x8f, 0x0f, 0x01, 0xf6, 0xf6, 0x87, 0x3e, 0x04, 0xf6, 0xf6, 0x48, 0x48, 0xf7, 0x87, 0x10, 0x02, 0xf6, 0xf6,
+  0xf7, 0x80, 0x0f, 0x00, 0xf7, 0x87, 0x0f, 0x07, 0xf7, 0xf7, 0x48, 0x1c, 0x48, 0xf6, 0xf8, 0x8c, 0x83, 0x0e, 0x02, 0x8c, 0xf8, 0xf6, 0x80, 0x7f,
+  0x83, 0x70, 0x81, 0x00, 0x83, 0x8f, 0x01, 0x1c, 0x6c, 0x87, 0x4f, 0x00, 0x6c, 0x83, 0xcf, 0x85, 0x2f, 0x86, 0xe1, 0x00, 0x8c, 0x82, 0x00, 0x82,
+  0x0a, 0x00, 0x1c, 0x8f, 0x00, 0x00, 0x64, 0x80, 0x00, 0x89, 0x0e, 0x00, 0xcc, 0x80, 0x00, 0x87, 0x10, 0x80, 0x0e, 0x03, 0xd5, 0xd5, 0xcc, 0xd0,
+  0x85, 0x10, 0x03, 0x64, 0x88, 0xac, 0xac, 0x80, 0x10, 0x87, 0x0f, 0x02, 0x8c, 0xcc, 0xac, 0x80, 0x21, 0x86, 0x31, 0x01, 0x64, 0x88, 0x80, 0x20,
+  0x80, 0x11, 0x86, 0x0f, 0x04, 0xac, 0x88, 0x88, 0xcc, 0xcc, 0x80, 0x11, 0x87, 0x40, 0x80, 0x00, 0x80, 0x0f, 0x00, 0x88, 0x86, 0x10, 0x04, 0x64,
+  0x8c, 0x8c, 0x8c, 0x88, 0x87, 0x0f, 0x82, 0x90, 0x03, 0xac, 0x88, 0xf9, 0x40, 0x8c, 0xa3, 0x02, 0xd9, 0x64, 0xda, 0x8a, 0xb6, 0x04, 0x60, 0xfa,
+  0x64, 0x40, 0x5c, 0x8a, 0x23, 0x01, 0xd5, 0xfe, 0x89, 0xc7, 0x03, 0x1c, 0x64, 0xf5, 0x8c, 0x8a, 0x0f, 0x04, 0x1c, 0x64, 0x60, 0x1c, 0x1c, 0x00,
+  0x1c, 0x81, 0x00, 0x00, 0x49, 0x81, 0x00, 0x00, 0x92, 0x82, 0x0a, 0x80, 0x00, 0x09, 0x31, 0x31, 0xbb, 0xbb, 0x84, 0xd7, 0xbb, 0x92, 0x49, 0x2d,
+  0x83, 0x0e, 0x0a, 0xbb, 0xbb, 0xff, 0xff, 0x84, 0xfb, 0xdb, 0xbb, 0xbb, 0xbb, 0x49, 0x82, 0x0e, 0x06, 0xff, 0xff, 0xff, 0xa4, 0xff, 0xdf, 0xff,
+  0x80, 0x10, 0x00, 0xb7, 0x80, 0x10, 0x00, 0x49, 0x82, 0x0f, 0x01, 0xfb, 0xff, 0x80, 0x11, 0x81, 0x20, 0x02, 0x31, 0xbb, 0xdf, 0x83, 0x0e, 0x80,
+  0x00, 0x80, 0x20, 0x05, 0x31, 0x49, 0xbb, 0xdf, 0x89, 0x88, 0x81, 0x0e, 0x80, 0x16, 0x81, 0x41, 0x04, 0x49, 0x89, 0x89, 0xfb, 0xfb, 0x83, 0x1e,
+  0x03, 0xff, 0xbb, 0x89, 0x89, 0x80, 0x0f, 0x00, 0xad, 0x83, 0x0c, 0x09, 0xff, 0xfb, 0xd6, 0xd6, 0xa9, 0xa9, 0x49, 0x49, 0xbb, 0xdb, 0x84, 0x0e,
+  0x02, 0xd2, 0x8d, 0x8d, 0x80, 0x2f, 0x01, 0x2d, 0xbb, 0x81, 0x50, 0x80, 0x00, 0x01, 0xd6, 0x8e, 0x80, 0x4e, 0x80, 0x60, 0x00, 0x49, 0x81, 0x8e,
+  0x80, 0x90, 0x00, 0xad, 0x80, 0x4d, 0x81, 0x90, 0x80, 0x0f, 0x81, 0x00, 0x00, 0x89, 0x85, 0x0f, 0x81, 0xaf, 0x82, 0xbf, 0x80, 0x00, 0x00, 0x31,
+  0x84, 0xdd, 0x84, 0xcf, 0x81, 0x1d, 0x8d, 0xef, 0x00, 0x1c, 0x83, 0x00, 0x00, 0x49, 0x84, 0x00, 0x84, 0x0e, 0x01, 0x1c, 0xb6, 0x81, 0x00, 0x02,
+  0x49, 0x49, 0xb6, 0x85, 0x0f, 0x82, 0x23, 0x00, 0xb6, 0x8c, 0x0e, 0x8a, 0x0d, 0x8d, 0x0e, 0x84, 0x4f, 0x84, 0x06, 0x82, 0x4f, 0x80, 0x00, 0x81,
+  0x08, 0x9a, 0x56, 0x8c, 0x1c, 0x85, 0x3f, 0x85, 0x50, 0x84, 0x48, 0x83, 0xa0, 0xa9, 0x48, 0x8c, 0xdf, 0x85, 0x90, 0x00, 0x1c, 0x00, 0x1c, 0x91,
+  0x00, 0x00, 0x00, 0x84, 0x00, 0x86, 0x0e, 0x02, 0x92, 0x92, 0x92, 0x80, 0x04, 0x83, 0x10, 0x83, 0x18, 0x81, 0x03, 0x00, 0x92, 0x81, 0x0f, 0x84,
+  0x29, 0x83, 0x0a, 0x81, 0x04, 0x81, 0x2a, 0x84, 0x23, 0x00, 0x92, 0x84, 0x1f, 0x00, 0x92, 0x84, 0x14, 0x83, 0x3e, 0x81, 0x04, 0x81, 0x3c, 0x84,
+  0x24, 0x83, 0x23, 0x81, 0x64, 0x80, 0x01, 0x84, 0x4f, 0x81, 0x1c, 0x81, 0x1a, 0x81, 0x27, 0x81, 0x79, 0x85, 0x65, 0x00, 0x04, 0x81, 0x41, 0x80,
+  0x25, 0x80, 0x0a, 0x80, 0x17, 0x00, 0x92, 0x83, 0x0f, 0x82, 0x4a, 0x83, 0x38, 0x83, 0x0f, 0x82, 0x33, 0x82, 0xb4, 0x00, 0x71, 0x85, 0xd1, 0x80,
+  0x0b, 0x81, 0x8c, 0x8f, 0x00, 0x00, 0x1c, 0x93, 0x00, 0x01, 0x4d, 0x4d, 0x89, 0x0c, 0x03, 0x1c, 0x4d, 0xb7, 0xb7, 0x80, 0x04, 0x85, 0x0e, 0x07,
+  0xdb, 0x4d, 0x4d, 0xbb, 0xbb, 0x4d, 0x4d, 0x96, 0x83, 0x10, 0x04, 0x4d, 0xdb, 0xdb, 0xdb, 0xbb, 0x80, 0x00, 0x02, 0x96, 0x96, 0x97, 0x84, 0x10,
+  0x80, 0x0c, 0x03, 0xb7, 0xb7, 0xb7, 0xbb, 0x85, 0x0e, 0x80, 0x0f, 0x03, 0x96, 0x49, 0x49, 0x72, 0x81, 0x32, 0x81, 0x0e, 0x00, 0x96, 0x80, 0x1e,
+  0x03, 0x49, 0x1c, 0x1c, 0x49, 0x81, 0x31, 0x80, 0x10, 0x02, 0x4d, 0x96, 0xb7, 0x82, 0x0f, 0x81, 0x25, 0x82, 0x51, 0x01, 0x4d, 0x4d, 0x80, 0x3a,
+  0x02, 0x49, 0x49, 0x97, 0x80, 0x34, 0x84, 0x40, 0x00, 0x96, 0x80, 0x4c, 0x80, 0x51, 0x84, 0x6f, 0x02, 0x49, 0x72, 0x96, 0x80, 0x22, 0x04, 0xb7,
+  0x49, 0x49, 0x96, 0x6e, 0x85, 0x60, 0x05, 0x1c, 0x49, 0x96, 0x96, 0x49, 0x1c, 0x84, 0x2e, 0x81, 0xaf, 0x82, 0x0f, 0x00, 0x29, 0x95, 0xcf, 0x89,
+  0x00, 0x00, 0x1c, 0x81, 0x00, 0x00, 0xff, 0x82, 0x05, 0x86, 0x00, 0x00, 0xff, 0x8b, 0x0f, 0x00, 0xff, 0x8b, 0x0f, 0x02, 0xff, 0xff, 0x00, 0x80,
+  0x11, 0x86, 0x13, 0x80, 0x0e, 0x82, 0x00, 0x84, 0x10, 0x85, 0x0e, 0x9a, 0x10, 0x80, 0x3d, 0x8a, 0x10, 0x80, 0x07, 0x82, 0x11, 0x84, 0x53, 0x82,
+  0x17, 0x81, 0x10, 0x86, 0x63, 0x82, 0x04, 0x87, 0x0f, 0x83, 0x14, 0xbd, 0x0f, 0x82, 0x77, 0x00, 0x1c, 0xa1, 0x00, 0x00, 0xff, 0x82, 0x00, 0x8b,
+  0x0d, 0x86, 0x11, 0x85, 0x08, 0x84, 0x07, 0x8b, 0x28, 0x83, 0x0e, 0x85, 0x2d, 0x89, 0x06, 0x84, 0x09, 0x87, 0x31, 0x87, 0x4f, 0x87, 0x3f, 0x85,
+  0x05, 0x88, 0x2d, 0x87, 0x12, 0x88, 0x9f, 0x86, 0x04, 0x8b, 0x3a, 0x97, 0x0f, 0x86, 0x00, 0x00, 0x1c, 0x81, 0x00, 0x00, 0x00, 0x82, 0x00, 0x82,
+  0x0a, 0x82, 0x0d, 0x00, 0xff, 0x82, 0x00, 0x84, 0x11, 0x82, 0x0e, 0x84, 0x04, 0x86, 0x1d, 0x85, 0x05, 0x80, 0x0f, 0x84, 0x2b, 0x83, 0x06, 0x84,
+  0x0e, 0x85, 0x0f, 0xa5, 0x07, 0x02, 0x00, 0x00, 0xe0, 0x81, 0x00, 0x88, 0x0f, 0x83, 0x1e, 0x86, 0x67, 0x86, 0x0f, 0x82, 0x60, 0x88, 0x0e, 0x86,
+  0xad, 0x86, 0xb1, 0x87, 0x10, 0x89, 0xc0, 0x87, 0x0e, 0x8b, 0xef, 0x00, 0x1c, 0x81, 0x00, 0x09, 0x5c, 0xd8, 0x1c, 0x1c, 0xf8, 0xf8, 0x1c, 0x1c,
+  0xbc, 0x3c, 0x82, 0x0e, 0x01, 0x1c, 0xdc, 0x80, 0x0b, 0x81, 0x00, 0x01, 0xf8, 0xdc, 0x80, 0x04, 0x01, 0x3c, 0x9c, 0x81, 0x0a, 0x03, 0x9c, 0xf8,
+  0xf8, 0xbc, 0x83, 0x14, 0x00, 0x7c, 0x80, 0x2c, 0x01, 0xdc, 0xf8, 0x82, 0x00, 0x82, 0x19, 0x82, 0x28, 0x84, 0x00, 0x85, 0x0e, 0x03, 0xdb, 0xdb,
+  0xdb, 0xf9, 0x81, 0x0f, 0x80, 0x2a, 0x80, 0x39, 0x02, 0x1c, 0xdb, 0xff, 0x80, 0x00, 0x00, 0xdb, 0x84, 0x20, 0x01, 0x7c, 0xf8, 0x82, 0x0e, 0x83,
+  0x10, 0x80, 0x0f, 0x84, 0x0d, 0x04, 0xff, 0xdb, 0xff, 0xdb, 0xda, 0x80, 0x0f, 0x80, 0x06, 0x83, 0x2e, 0x82, 0x04, 0x84, 0x3a, 0x8c, 0x0f, 0x81,
+  0x0c, 0x8b, 0x0f, 0x02, 0xb6, 0xb6, 0xb6, 0x81, 0x07, 0x00, 0xb6, 0x84, 0x4e, 0x80, 0x07, 0x00, 0x1c, 0x80, 0x12, 0x81, 0x06, 0x86, 0x07, 0x93,
+  0x00,
+};
+const PackedSheet packedEmojis = {16, 16, 13, 1, packedEmojisOffsets, packedEmojisData, NULL};
+
+#endif
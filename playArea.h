@@ -0,0 +1,137 @@
+#ifndef PLAY_AREA
+#define PLAY_AREA
+
+////////////////////////////////////////////////////////////////////////
+// Coarse grid over the 240x240 round display, answering "is this spot on the screen / in the
+// walking area / free" with a couple of bit tests instead of redoing the bounds math.
+// The screen is cut into 8x8 pixel cells, 30 per row, and each row of cells is one 32 bit mask.
+// The panel and walking area masks are worked out by the compiler (constexpr), so they cost
+// nothing at run time; only the occupancy mask (what's been put down, like poops) changes.
+////////////////////////////////////////////////////////////////////////
+
+#include "arduino.h"
+
+const int cellSize = 8;
+const int gridSize = 30; //cells per row and column
+const int screenRadius = 120; //the GC9A01 is a 240 pixel circle
+
+//walking area for the pets, in sprite coordinates: a trapezoid that narrows further down the screen,
+//so the dog stays on the round display.
+const int petXmin = -64, petXmax = 240-64;
+const int petYmin = 60, petYmax = 100;
+
+//the spot on a pet sprite that has to be in the walking area: its feet, where the poops go.
+const int petAnchorX = 64, petAnchorY = 112;
+
+//a running dog isn't kept in the walking area: it runs off one side of the screen and comes back on at the other,
+//as it always has. These are how far off it gets (sprite x at petYmin; a pixel less each side for every pixel further down).
+const int runXmin = -128, runXmax = 240;
+
+//is the pixel X, Y on the round panel?
+constexpr bool onPanelPx(int X, int Y){
+  return (X-screenRadius)*(X-screenRadius) + (Y-screenRadius)*(Y-screenRadius) <= screenRadius*screenRadius;
+}
+
+//a cell is on the panel if all four corners are, so anything inside it is fully visible.
+constexpr bool cellOnPanel(int cx, int cy){
+  return onPanelPx(cx*cellSize, cy*cellSize) && onPanelPx(cx*cellSize+cellSize, cy*cellSize)
+      && onPanelPx(cx*cellSize, cy*cellSize+cellSize) && onPanelPx(cx*cellSize+cellSize, cy*cellSize+cellSize);
+}
+
+//a cell is walkable if a pet with its feet in the middle of the cell is inside the trapezoid, and the cell is on the panel.
+constexpr bool cellWalkable(int cx, int cy){
+  return cellOnPanel(cx, cy)
+      && cy*cellSize + cellSize/2 - petAnchorY >= petYmin && cy*cellSize + cellSize/2 - petAnchorY <= petYmax
+      && cx*cellSize + cellSize/2 - petAnchorX >= petXmin + (cy*cellSize + cellSize/2 - petAnchorY - petYmin)
+      && cx*cellSize + cellSize/2 - petAnchorX <= petXmax - (cy*cellSize + cellSize/2 - petAnchorY - petYmin);
+}
+
+//build a row of bits, one per cell (recursive, so it works as a C++11 constexpr)
+constexpr uint32_t panelRow(int cy, int cx = gridSize-1){
+  return cx < 0 ? 0 : (panelRow(cy, cx-1) | (cellOnPanel(cx, cy) ? (1UL << cx) : 0));
+}
+
+constexpr uint32_t walkRow(int cy, int cx = gridSize-1){
+  return cx < 0 ? 0 : (walkRow(cy, cx-1) | (cellWalkable(cx, cy) ? (1UL << cx) : 0));
+}
+
+#define GRID_ROWS(f) { f(0), f(1), f(2), f(3), f(4), f(5), f(6), f(7), f(8), f(9), \
+  f(10), f(11), f(12), f(13), f(14), f(15), f(16), f(17), f(18), f(19), \
+  f(20), f(21), f(22), f(23), f(24), f(25), f(26), f(27), f(28), f(29) }
+
+const uint32_t panelMask[gridSize] = GRID_ROWS(panelRow);
+const uint32_t walkMask[gridSize] = GRID_ROWS(walkRow);
+
+class PlayArea {
+  public:
+  uint32_t occupied[gridSize]; //cells covered by things that have been put down
+
+  PlayArea(){
+    clear();
+  }
+
+  void clear(){
+    for(int i=0; i<gridSize; i++) occupied[i] = 0;
+  }
+
+  //can a pet with its sprite at X, Y (top left) stand there?
+  bool walkable(int X, int Y){
+    X += petAnchorX, Y += petAnchorY;
+    if(X < 0 || Y < 0 || X >= 240 || Y >= 240) return false;
+    return walkMask[Y/cellSize] >> (X/cellSize) & 1;
+  }
+
+  //the cells covered by a box; returns false if any of it is off the grid.
+  bool cells(int X, int Y, int w, int h, int & cy0, int & cy1, uint32_t & bits){
+    if(X < 0 || Y < 0 || X+w > 240 || Y+h > 240) return false;
+    int cx0 = X/cellSize, cx1 = (X+w-1)/cellSize;
+    cy0 = Y/cellSize, cy1 = (Y+h-1)/cellSize;
+    bits = ((1UL << (cx1-cx0+1)) - 1) << cx0;
+    return true;
+  }
+
+  //is the whole box on the panel?
+  bool onPanel(int X, int Y, int w, int h){
+    int cy0, cy1;
+    uint32_t bits;
+    if(!cells(X, Y, w, h, cy0, cy1, bits)) return false;
+    for(int cy=cy0; cy<=cy1; cy++) if((panelMask[cy] & bits) != bits) return false;
+    return true;
+  }
+
+  //does any of the box land on the panel? Used to skip drawing things that are entirely off the round screen.
+  bool visible(int X, int Y, int w, int h){
+    int x0 = max(X, 0), y0 = max(Y, 0);
+    int x1 = min(X+w, 240), y1 = min(Y+h, 240);
+    if(x0 >= x1 || y0 >= y1) return false;
+    int cy0, cy1;
+    uint32_t bits;
+    cells(x0, y0, x1-x0, y1-y0, cy0, cy1, bits);
+    for(int cy=cy0; cy<=cy1; cy++) if(panelMask[cy] & bits) return true;
+    return false;
+  }
+
+  //is the whole box on the panel, and not on top of anything else that's been put down?
+  bool isFree(int X, int Y, int w, int h){
+    int cy0, cy1;
+    uint32_t bits;
+    if(!cells(X, Y, w, h, cy0, cy1, bits)) return false;
+    for(int cy=cy0; cy<=cy1; cy++) if((panelMask[cy] & bits) != bits || (occupied[cy] & bits)) return false;
+    return true;
+  }
+
+  //mark a box as taken (or free again)
+  void mark(int X, int Y, int w, int h, bool taken = true){
+    int cy0, cy1;
+    uint32_t bits;
+    if(!cells(X, Y, w, h, cy0, cy1, bits)) return;
+    for(int cy=cy0; cy<=cy1; cy++){
+      if(taken) occupied[cy] |= bits;
+      else occupied[cy] &= ~bits;
+    }
+  }
+};
+
+PlayArea playArea;
+
+#endif
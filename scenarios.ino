@@ -0,0 +1,117 @@
+#ifdef FRAME_CAPTURE
+////////////////////////////////////////////////////////////////////////
+// Scripted scenarios for frame capture (see capture.h).
+// Each scenario puts the dog and the menu into a fixed state, draws one frame and captures it
+// under a name, so a capture from before and after a rendering change can be compared frame by frame.
+// Runs once at the end of setup() when FRAME_CAPTURE is defined.
+////////////////////////////////////////////////////////////////////////
+
+//put the dog in a fixed spot, doing a fixed thing, on its first frame.
+void poseDog(Action a, int X, int Y, bool faceLeft = false){
+  dog.bShuffling = false;
+  dog.bypass = false;
+  dog.script.stop();
+  dog.left = faceLeft;
+  dog.action(a, game.simTime);
+  dog.motion.set(X, Y);
+  dog.x = X, dog.y = Y;
+  dog.counter = 0;
+  dog.sync();
+}
+
+//draw one frame with the dog's draw callback, and capture it under label.
+void captureScene(const char * label){
+  captureLabel = label;
+  (*dog.drawCB)();
+  captureLabel = "live";
+}
+
+//capture every option of a menu level, stepping into submenus and input screens.
+void captureMenu(JsonObject lvl, int depth){
+  char label[32];
+  int n = lvl["opts"].size();
+  for(int i=0; i<n; i++){
+    JsonObject opt = lvl["opts"][i];
+    lvl["ind"] = i;
+    level = lvl;
+    menuLevel = depth;
+    menuTimeout = millis() + 30000;
+    snprintf(label, sizeof(label), "menu-%s", opt["name"].as<const char*>());
+    captureScene(label);
+    if(opt.containsKey("opts")){
+      captureMenu(opt, depth+1);
+    } else if(opt.containsKey("type")){ //input and display screens
+      level = opt;
+      menuLevel = depth+1;
+      if(opt["type"] == "kb") kbInd = opt["range"][2].as<int>();
+      snprintf(label, sizeof(label), "menu-%s-open", opt["name"].as<const char*>());
+      captureScene(label);
+    }
+  }
+  lvl["ind"] = 0;
+}
+
+void runScenarios(){
+  randomSeed(1); //the same random choices every run
+  int wasPhase = lighting.phase;
+  bool hadClock = cfgDoc["clock"].as<bool>();
+  cfgDoc["clock"] = false;
+  lighting.setPhase(LIGHT_DAY);
+
+  poseDog(WALK_RIGHT, 56, 60);
+  captureScene("walk");
+  poseDog(WALK_LEFT, 56, 60, true);
+  captureScene("walk-left");
+  poseDog(RUN, 56, 60);
+  captureScene("run");
+  poseDog(SIT_RIGHT, 56, 60);
+  captureScene("sit");
+  poseDog(SIT_RIGHT, 56, 60, true);
+  captureScene("sit-mirrored");
+  poseDog(SLEEP, 56, 60);
+  captureScene("sleep");
+
+  poseDog(SIT_RIGHT, 56, 60);
+  dog.giveFood(); //shows the speech bubble
+  captureScene("feed");
+  dog.noteTmr = 0;
+
+  poseDog(WALK_RIGHT, 56, 60);
+  ball = world.spawn(ENT_BALL, -32, 60);
+  ballPath.throwArc(-32, 60, 240, 60, 40, 1000, game.simTime - 500); //halfway through the throw
+  ballPath.sample(game.simTime, world.x[ball], world.y[ball]); //where ballTick() would put it
+  world.depth[ball] = 240;
+  captureScene("ball");
+  world.remove(ball);
+  ball = -1;
+
+  poseDog(SIT_RIGHT, 56, 60);
+  for(int i=0; i<maxPoops; i++){
+    int px = 24 + i*40;
+    if(playArea.isFree(px, 172, 32, 32)) world.spawn(ENT_POOP, px, 172), playArea.mark(px, 172, 32, 32), curPoops++;
+  }
+  captureScene("poop");
+  world.clear(ENT_POOP);
+  playArea.clear();
+  curPoops = 0;
+
+  lighting.setPhase(LIGHT_DUSK);
+  poseDog(SIT_RIGHT, 56, 60);
+  captureScene("dusk");
+  lighting.setPhase(LIGHT_NIGHT);
+  captureScene("night");
+  lighting.setPhase(LIGHT_DAY);
+
+  cfgDoc["clock"] = true; //only shows up if the clock has a time to show
+  captureScene("clock");
+  cfgDoc["clock"] = false;
+
+  bMenu = true;
+  captureMenu(menuDoc.as<JsonObject>(), 1);
+  bMenu = false;
+  menuLevel = 0;
+
+  cfgDoc["clock"] = hadClock;
+  lighting.setPhase(wasPhase);
+}
+#endif
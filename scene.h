@@ -0,0 +1,46 @@
+#ifndef SCENE_OBJ
+#define SCENE_OBJ
+
+////////////////////////////////////////////////////////////////////////
+// Everything a frame needs to be drawn, copied out of the game state once per frame.
+// Drawing only ever reads a Scene, never the world, the dog or the menu json directly, so on a dual
+// core chip the drawing can run on the other core from a snapshot (see handoff.h) while the game
+// carries on. On one core the snapshot is taken and drawn straight away, which comes to the same thing.
+////////////////////////////////////////////////////////////////////////
+
+#include "arduino.h"
+#include "world.h"
+
+//#define DUAL_CORE //uncomment on dual core chips (ESP32, ESP32-S3) to draw and push frames on the other core
+
+#if defined(DUAL_CORE) && defined(CONFIG_FREERTOS_UNICORE)
+#error "DUAL_CORE needs a chip with two cores; this one (ie the ESP32-S2) only has one"
+#endif
+
+//what the menu bar shows, worked out from the menu json
+struct MenuView {
+  bool open;
+  int8_t icon; //emoji to show, or -1 for text
+  uint8_t size; //text size
+  char text[40];
+  bool kb; //keyboard input: kbText, then the next character in blue
+  char kbText[65];
+  char kbNext;
+};
+
+struct Scene {
+  uint32_t seq; //counts up by one per scene
+  World world; //where everything is, with the dog in between ticks
+  Rect dirty; //where static things have changed since the last scene that got drawn
+  int lightPhase;
+  int dogX, dogY;
+  bool dogLeft;
+  uint8_t dogState; //emote in the bubble
+  bool bubble;
+  bool clock; //show the clock and temperature
+  char hm[6];
+  char temp[8];
+  MenuView menu;
+};
+
+#endif
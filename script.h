@@ -0,0 +1,54 @@
+#ifndef SCRIPT_OBJ
+#define SCRIPT_OBJ
+
+////////////////////////////////////////////////////////////////////////
+// Straight line scripts for things that take a while ("walk to the middle, sit, wait 30 s, sleep"),
+// without chains of callbacks, and without the heap.
+// A script is a void function its owner calls every tick. The macros turn its body into a switch on the
+// line it stopped at last time, so each call carries on from the last wait (the protothreads trick).
+// The only thing kept between calls is the Script itself, which makes them a few bytes each, but it
+// means locals don't survive a wait (keep anything that has to in the owner), and there can't be a
+// switch statement of its own in the body. One wait per line.
+//
+//  void napScript(unsigned long now){
+//    SCRIPT_BEGIN(script);
+//    goTo(56, 60, now);
+//    SCRIPT_WAIT(script, arrived());
+//    SCRIPT_SLEEP(script, now, 30000);
+//    action(SLEEP, now);
+//    SCRIPT_END(script);
+//  }
+////////////////////////////////////////////////////////////////////////
+
+#include "arduino.h"
+
+struct Script {
+  uint8_t id = 0; //which script is running, as the owner numbers them; 0 for none
+  uint16_t line = 0; //the line to carry on from; 0 for the top
+  unsigned long until = 0; //when the current SCRIPT_SLEEP is over
+
+  bool running(){
+    return id != 0;
+  }
+
+  //start a script from the top, dropping whatever was running
+  void start(uint8_t which){
+    id = which, line = 0;
+  }
+
+  void stop(){
+    id = 0, line = 0;
+  }
+};
+
+#define SCRIPT_BEGIN(s) switch((s).line){ case 0:
+
+//come back to this line every call until cond is true
+#define SCRIPT_WAIT(s, cond) do { (s).line = __LINE__; case __LINE__: if(!(cond)) return; } while(0)
+
+//wait ms milliseconds, counted in the now the script is called with
+#define SCRIPT_SLEEP(s, now, ms) do { (s).until = (now) + (ms); SCRIPT_WAIT(s, (long)((now) - (s).until) >= 0); } while(0)
+
+#define SCRIPT_END(s) } (s).stop()
+
+#endif
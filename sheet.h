@@ -0,0 +1,77 @@
+#ifndef SPRITE_SHEET_OBJ
+#define SPRITE_SHEET_OBJ
+
+////////////////////////////////////////////////////////////////////////
+// A sprite sheet unpacked into RAM once at boot, with left facing copies.
+// The sheets are stored compressed in flash (see unpack.h), and used to be converted and flipped
+// pixel by pixel every time a frame was drawn. Here every frame is unpacked once, and the
+// rows that ever get drawn flipped are also stored flipped, so picking a frame is just a pointer,
+// and the blitter only ever copies left to right.
+////////////////////////////////////////////////////////////////////////
+
+#include "arduino.h"
+#include "unpack.h"
+
+class Sheet {
+  public:
+  uint8_t * frames = NULL; //cols*rows frames of fw*fh pixels, one after the other
+  uint8_t * flipped = NULL; //flipped copies of the frames in rows flipFrom and up
+  int fw, fh; //frame size
+  int cols, rows;
+  int flipFrom; //first row that gets flipped; rows past the end of the sheet means nothing is
+  int held = 0; //bytes allocated. The owner tells the heap monitor, since this may not be on the core that owns it
+
+  //unpack every frame of a packed sheet. The new frames are allocated before the old ones are freed, so if there
+  //isn't room for them, this returns false and the sheet stays as it was, rather than ending up with no frames at all.
+  bool begin(const PackedSheet & sheet, int firstFlip){
+    int flipAt = constrain(firstFlip, 0, sheet.rows);
+    int size = sheet.fw*sheet.fh;
+    uint8_t * newFrames = (uint8_t *)malloc(sheet.cols*sheet.rows*size);
+    uint8_t * newFlipped = (uint8_t *)malloc(max(1, sheet.cols*(sheet.rows-flipAt)*size));
+    if(!newFrames || !newFlipped){
+      free(newFrames);
+      free(newFlipped);
+      return false;
+    }
+    end();
+    frames = newFrames, flipped = newFlipped;
+    fw = sheet.fw, fh = sheet.fh;
+    cols = sheet.cols, rows = sheet.rows;
+    flipFrom = flipAt;
+    held = bytes();
+    Unpacker unpacker;
+    for(int r=0; r<rows; r++){
+      for(int c=0; c<cols; c++){
+        uint8_t * f = frames + (r*cols + c)*size;
+        unpacker.frame(sheet, r*cols + c, f);
+        if(r < flipFrom) continue;
+        uint8_t * m = flipped + ((r-flipFrom)*cols + c)*size;
+        for(int i=0; i<fh; i++){ //reverse each row
+          for(int j=0; j<fw; j++) m[i*fw + j] = f[i*fw + fw-1-j];
+        }
+      }
+    }
+    return true;
+  }
+
+  //free the frames, ie to load a different sheet
+  void end(){
+    free(frames);
+    free(flipped);
+    frames = flipped = NULL;
+    held = 0;
+  }
+
+  //the pixels of frame col in row row, facing left if flip is set (and that row has flipped copies)
+  const uint8_t * frame(int col, int row, bool flip){
+    if(flip && row >= flipFrom) return flipped + ((row-flipFrom)*cols + col)*fw*fh;
+    return frames + (row*cols + col)*fw*fh;
+  }
+
+  //bytes of RAM the sheet takes up
+  int bytes(){
+    return (cols*rows + cols*(rows-flipFrom))*fw*fh;
+  }
+};
+
+#endif
@@ -0,0 +1,106 @@
+#ifndef SKIN_PACK_OBJ
+#define SKIN_PACK_OBJ
+
+////////////////////////////////////////////////////////////////////////
+// Extra dog skins, kept in their own flash partition ("skins" in partitions.csv) instead of
+// being compiled in. The partition is mapped into the address space, so a skin's frames are read
+// straight from flash like the built in ones: nothing is loaded or copied until a skin is picked.
+// tools/skinpack.py builds the partition image. The layout, all little endian:
+//
+//   pack:   "SKP1", uint16 count, uint16 0, uint32 total size, uint32 0
+//           count entries of: char name[12], uint32 offset of the skin from the start of the pack
+//   skin:   "SKN1", uint16 fw, fh, cols, rows, uint16 palette size, uint16 0, uint32 data size
+//           uint32 offsets[cols*rows+1] (where each frame starts in data)
+//           palette (palette size bytes of RGB332, padded to 4 bytes), then data
+//
+// Frames are compressed the same way as packedAssets.h (see unpack.h). With a palette,
+// the frames hold palette indexes, so a recoloured skin can share its frames' layout.
+// Nothing in the partition is trusted: every offset and length is checked against the size of the
+// pack before it's used, and a skin has to have the same frame size and layout as the built in dog.
+////////////////////////////////////////////////////////////////////////
+
+#include "arduino.h"
+#include "esp_partition.h"
+#include "unpack.h"
+
+const int maxSkins = 16;
+const esp_partition_subtype_t skinPartType = (esp_partition_subtype_t)0x40; //first of the custom data subtypes
+
+class SkinPack {
+  public:
+  const uint8_t * base = NULL; //the mapped partition
+  spi_flash_mmap_handle_t handle;
+  uint32_t size = 0; //of the pack, which is never more than the partition
+  int count = 0;
+
+  //map the skins partition, if there is one with a pack in it
+  bool begin(){
+    const esp_partition_t * part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, skinPartType, "skins");
+    if(!part) return false;
+    const void * p;
+    if(esp_partition_mmap(part, 0, part->size, SPI_FLASH_MMAP_DATA, &p, &handle) != ESP_OK) return false;
+    base = (const uint8_t *)p;
+    size = get32(8);
+    count = min((int)get16(4), maxSkins);
+    //a damaged frame can have the decoder read on for up to two bytes a pixel, so leave that much after the pack
+    if(memcmp(base, "SKP1", 4) || size < 16 || size > part->size - 2*32*32 || 16 + count*16 > size){ //empty or garbage
+      end();
+      return false;
+    }
+    Serial.print(count);
+    Serial.println(" skins in the skin pack");
+    return true;
+  }
+
+  void end(){
+    if(base) spi_flash_munmap(handle);
+    base = NULL;
+    size = 0;
+    count = 0;
+  }
+
+  //skin i's name, up to 12 characters; copied out, since it isn't zero terminated in the pack
+  void name(int i, char * out){
+    out[0] = 0;
+    if(i < 0 || i >= count) return;
+    memcpy(out, base + 16 + i*16, 12);
+    out[12] = 0;
+  }
+
+  //point sheet at skin i's frames, in place in flash. false if there's no such skin, it's damaged,
+  //or its frames aren't laid out like layout's (the built in dog; the blitter and Dog both count on it).
+  bool sheet(int i, PackedSheet & sheet, const PackedSheet & layout){
+    if(i < 0 || i >= count) return false;
+    uint32_t at = get32(16 + i*16 + 12);
+    if(at & 3 || at < 16 + count*16 || at > size - 20 || memcmp(base + at, "SKN1", 4)) return false;
+    if(get16(at + 4) != layout.fw || get16(at + 6) != layout.fh || get16(at + 8) != layout.cols || get16(at + 10) != layout.rows) return false;
+    uint32_t pal = get16(at + 12), dataSize = get32(at + 16);
+    uint32_t frames = layout.cols*layout.rows;
+    uint32_t offsets = at + 20;
+    uint32_t palAt = offsets + 4*(frames + 1);
+    uint32_t dataAt = palAt + ((pal + 3) & ~3);
+    if(pal > 256 || dataAt > size || dataSize > size - dataAt) return false; //the sizes run off the end of the pack
+    const uint32_t * o = (const uint32_t *)(base + offsets); //4 byte aligned, so it's safe to read from flash directly
+    for(uint32_t f=0; f<frames; f++) if(o[f] > o[f+1]) return false;
+    if(o[frames] > dataSize) return false; //every frame starts and ends inside the data
+    sheet = layout;
+    sheet.offsets = o;
+    sheet.palette = pal ? base + palAt : NULL;
+    sheet.data = base + dataAt;
+    return true;
+  }
+
+  private:
+  //little endian numbers out of the pack; every field is aligned to its size
+  uint32_t get32(uint32_t at){
+    return *(const uint32_t *)(base + at);
+  }
+
+  uint16_t get16(uint32_t at){
+    return *(const uint16_t *)(base + at);
+  }
+};
+
+SkinPack skinPack;
+
+#endif
@@ -0,0 +1,46 @@
+#ifndef SMALLDOGS_ANIM
+#define SMALLDOGS_ANIM
+
+////////////////////////////////////////////////////////////////////////
+// Animation table for the smallDogs sprite sheets (smallDogs.h and smallDogsAlt.h share a layout).
+// Each row of the sheet is one Action, 32x32 pixels per frame, columns left to right.
+// If a row is redrawn with more or fewer frames, this is the only place that needs to change.
+////////////////////////////////////////////////////////////////////////
+
+#include "animation.h"
+
+//events fired when a one shot clip ends
+enum DogAnimEvent : uint8_t {
+  EVT_NONE,
+  EVT_SAT //finished sitting down
+};
+
+//rows from here down (STARTSIT onwards) face right in the sheet, and get drawn flipped when the dog faces left
+const int firstFlipRow = 5;
+
+const AnimFrame dogFrames[] = {
+  {0,150}, {1,150}, {2,150}, {3,150}, // 0: WALK_DWN
+  {0,150}, {1,150}, {2,150}, {3,150}, // 4: WALK_RIGHT
+  {0,150}, {1,150}, {2,150}, {3,150}, // 8: WALK_UP
+  {0,150}, {1,150}, {2,150}, {3,150}, //12: WALK_LEFT
+  {0,150}, {1,150}, {2,150}, {3,150}, //16: SIT_FOR
+  {0,150}, {1,150}, {2,150}, {3,150}, //20: STARTSIT
+  {0,500}, {1,500},                   //24: SIT_RIGHT (column 3 is the sad face, shown by hand)
+  {0,1000}, {1,1000},                 //26: SLEEP
+  {0,150}, {1,150}, {2,150}           //28: RUN
+};
+
+//one clip per row of the sheet, in the same order as the Action enum
+const AnimClip dogClips[] = {
+  { 0, 4, ANIM_LOOP, EVT_NONE }, //WALK_DWN
+  { 4, 4, ANIM_LOOP, EVT_NONE }, //WALK_RIGHT
+  { 8, 4, ANIM_LOOP, EVT_NONE }, //WALK_UP
+  {12, 4, ANIM_LOOP, EVT_NONE }, //WALK_LEFT
+  {16, 4, ANIM_LOOP, EVT_NONE }, //SIT_FOR
+  {20, 4, ANIM_ONCE, EVT_SAT },  //STARTSIT
+  {24, 2, ANIM_LOOP, EVT_NONE }, //SIT_RIGHT
+  {26, 2, ANIM_LOOP, EVT_NONE }, //SLEEP
+  {28, 3, ANIM_LOOP, EVT_NONE }  //RUN
+};
+
+#endif
@@ -0,0 +1,69 @@
+#ifndef SOLAR_OBJ
+#define SOLAR_OBJ
+
+////////////////////////////////////////////////////////////////////////
+// Sunrise, sunset and civil twilight for a place and a date, worked out on the device.
+// Uses the standard sunrise equation (low precision solar position, as in the NOAA and
+// Wikipedia "sunrise equation" write-ups); good to a minute or two, which is plenty for
+// deciding when the dog's yard gets dark. It's done once a day, so floats are fine here.
+////////////////////////////////////////////////////////////////////////
+
+#include "arduino.h"
+#include <math.h>
+
+//default location, until the weather service tells us where we are (Northfield, MN, zip 55057)
+const float defaultLat = 44.4583;
+const float defaultLon = -93.1616;
+
+//the sun's times for one day, in unix seconds
+struct SunTimes {
+  long day = -1; //which local day these are for (days since 1970)
+  long dawn = 0, rise = 0, set = 0, dusk = 0; //civil dawn, sunrise, sunset, civil dusk
+  int8_t polar = 0; //1 if the sun never sets that day, -1 if it never rises
+
+  bool valid(){
+    return day >= 0;
+  }
+
+  bool isDay(long now){
+    if(polar) return polar > 0;
+    return now >= rise && now < set;
+  }
+};
+
+//the unix time when the sun is at angle degrees above the horizon, on either side of transit (both in julian days)
+inline long solarCrossing(double transit, double lat, double decl, double angle, bool rising, int8_t & polar){
+  double c = (sin(angle * DEG_TO_RAD) - sin(lat * DEG_TO_RAD) * sin(decl)) / (cos(lat * DEG_TO_RAD) * cos(decl));
+  if(c < -1) polar = 1; //always above angle
+  if(c > 1) polar = -1; //always below
+  double w = acos(constrain(c, -1.0, 1.0)) * RAD_TO_DEG; //hour angle
+  double j = transit + (rising ? -w : w) / 360.0;
+  return (long)lround((j - 2440587.5) * 86400.0);
+}
+
+//work out the sun's times for local day number day (days since 1970 in local time), at lat/lon (north and east positive)
+inline SunTimes solarTimes(long day, float lat, float lon){
+  SunTimes s;
+  s.day = day;
+  double n = day - 10957 + 0.0008; //days since noon, Jan 1st 2000
+  double jStar = n - lon / 360.0; //mean solar noon
+  double M = fmod(357.5291 + 0.98560028 * jStar, 360.0) * DEG_TO_RAD; //solar mean anomaly
+  double C = 1.9148 * sin(M) + 0.0200 * sin(2*M) + 0.0003 * sin(3*M); //equation of the center
+  double L = fmod(M * RAD_TO_DEG + C + 180.0 + 102.9372, 360.0) * DEG_TO_RAD; //ecliptic longitude
+  double transit = 2451545.0 + jStar + 0.0053 * sin(M) - 0.0069 * sin(2*L); //solar noon, julian day
+  double decl = asin(sin(L) * sin(23.4397 * DEG_TO_RAD)); //declination of the sun
+
+  int8_t p = 0, twilight = 0;
+  s.rise = solarCrossing(transit, lat, decl, -0.833, true, p); //-0.833 degrees is the top of the sun, allowing for refraction
+  s.set = solarCrossing(transit, lat, decl, -0.833, false, p);
+  s.polar = p;
+  s.dawn = solarCrossing(transit, lat, decl, -6, true, twilight); //civil twilight ends with the sun 6 degrees down
+  s.dusk = solarCrossing(transit, lat, decl, -6, false, twilight);
+  if(twilight > 0){ //it never gets properly dark; take twilight as the half hour around sunrise and sunset
+    s.dawn = s.rise - 1800;
+    s.dusk = s.set + 1800;
+  }
+  return s;
+}
+
+#endif
@@ -0,0 +1,151 @@
+#ifndef TILE_CACHE_OBJ
+#define TILE_CACHE_OBJ
+
+////////////////////////////////////////////////////////////////////////
+// Cache of small pre-composited tiles, for things that are drawn the same way frame after frame,
+// like the speech bubble with an emote in it. A tile is built once from layers of 8 bit pixels,
+// already scaled and lit, and stored as runs: an opaque run is copied straight into the frame,
+// and a shadow run darkens whatever is under it. Tiles are looked up by a key that has to cover
+// everything that changes the picture (for the bubble: emote, facing and light), and the least
+// recently used tile is thrown out when a new one is needed.
+////////////////////////////////////////////////////////////////////////
+
+#include "arduino.h"
+#include <TFT_eSPI.h>
+#include "lighting.h"
+
+const int tileSize = 64; //tiles are square
+const int maxTiles = 4;
+const int maxTileRuns = 384;
+
+enum RunKind : uint8_t {
+  RUN_CLEAR, //only used while building; clear pixels don't get runs
+  RUN_OPAQUE,
+  RUN_SHADOW, //darken what's behind by half
+  RUN_SHADOW2 //a shadow on top of a shadow
+};
+
+struct TileRun {
+  uint8_t y, x, len;
+  RunKind kind;
+};
+
+struct Tile {
+  uint32_t key;
+  uint32_t used; //when it was last drawn, in draws, for throwing out the oldest
+  bool valid;
+  int numRuns;
+  uint8_t px[tileSize*tileSize]; //lit colours of the opaque pixels
+  TileRun runs[maxTileRuns];
+};
+
+class TileCache {
+  public:
+  Tile tiles[maxTiles];
+  uint32_t draws = 0;
+  uint32_t hits = 0, misses = 0;
+  uint8_t kinds[tileSize*tileSize]; //scratch space for building a tile
+
+  TileCache(){
+    clear();
+  }
+
+  void clear(){
+    for(int i=0; i<maxTiles; i++) tiles[i].valid = false;
+  }
+
+  //the tile for key, if we have it
+  Tile * find(uint32_t key){
+    for(int i=0; i<maxTiles; i++){
+      if(tiles[i].valid && tiles[i].key == key){
+        hits++;
+        return &tiles[i];
+      }
+    }
+    misses++;
+    return NULL;
+  }
+
+  //start building a tile for key, in place of an empty or the least recently used one
+  Tile * start(uint32_t key){
+    Tile * t = &tiles[0];
+    for(int i=0; i<maxTiles; i++){
+      if(!tiles[i].valid){
+        t = &tiles[i];
+        break;
+      }
+      if(tiles[i].used < t->used) t = &tiles[i];
+    }
+    t->key = key;
+    t->valid = false;
+    memset(kinds, RUN_CLEAR, sizeof(kinds));
+    return t;
+  }
+
+  //draw sw by sh pixels, scaled up by fac, onto the tile being built at X, Y. Same rules as the blitter:
+  //green is transparent, black is shadow, everything else goes through the lighting table.
+  void layer(Tile * t, const uint8_t * src, int sw, int sh, int X, int Y, int fac){
+    for(int i=0; i<sh*fac; i++){
+      int y = Y + i;
+      if(y < 0 || y >= tileSize) continue;
+      for(int j=0; j<sw*fac; j++){
+        int x = X + j;
+        if(x < 0 || x >= tileSize) continue;
+        uint8_t col = src[(i/fac)*sw + j/fac];
+        int p = y*tileSize + x;
+        if(col == 0x1C) continue; //transparent
+        if(col != 0x00){ //opaque
+          t->px[p] = lighting.lut[col];
+          kinds[p] = RUN_OPAQUE;
+        }
+        else if(kinds[p] == RUN_OPAQUE) t->px[p] = lighting.shadow[t->px[p]]; //shadow on something we've already drawn
+        else if(kinds[p] == RUN_SHADOW) kinds[p] = RUN_SHADOW2;
+        else if(kinds[p] == RUN_CLEAR) kinds[p] = RUN_SHADOW;
+      }
+    }
+  }
+
+  //turn the layers into runs. Returns false (and the tile isn't kept) if it has too many to store.
+  bool finish(Tile * t){
+    t->numRuns = 0;
+    for(int y=0; y<tileSize; y++){
+      const uint8_t * k = kinds + y*tileSize;
+      int x = 0;
+      while(x < tileSize){
+        if(k[x] == RUN_CLEAR){
+          x++;
+          continue;
+        }
+        if(t->numRuns >= maxTileRuns) return false;
+        int x0 = x;
+        while(x < tileSize && k[x] == k[x0]) x++;
+        t->runs[t->numRuns++] = {(uint8_t)y, (uint8_t)x0, (uint8_t)(x - x0), (RunKind)k[x0]};
+      }
+    }
+    t->valid = true;
+    return true;
+  }
+
+  //draw a finished tile into dest with its top left corner at X, Y
+  void draw(Tile * t, TFT_eSprite * dest, int X, int Y){
+    t->used = ++draws;
+    uint8_t * dbuf = (uint8_t *)dest->getPointer();
+    int dw = dest->width(), dh = dest->height();
+    for(int r=0; r<t->numRuns; r++){
+      const TileRun & run = t->runs[r];
+      int y = Y + run.y;
+      if(y < 0 || y >= dh) continue;
+      int x0 = max(X + run.x, 0); //clip the run to the frame
+      int x1 = min(X + run.x + run.len, dw);
+      if(x1 <= x0) continue;
+      uint8_t * d = dbuf + y*dw;
+      if(run.kind == RUN_OPAQUE) memcpy(d + x0, t->px + run.y*tileSize + (x0 - X), x1 - x0);
+      else for(int x=x0; x<x1; x++){
+        d[x] = lighting.shadow[d[x]];
+        if(run.kind == RUN_SHADOW2) d[x] = lighting.shadow[d[x]];
+      }
+    }
+  }
+};
+
+#endif
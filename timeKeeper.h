@@ -0,0 +1,115 @@
+#ifndef TIME_KEEPER_OBJ
+#define TIME_KEEPER_OBJ
+
+////////////////////////////////////////////////////////////////////////
+// Our own clock, set from the internet time servers whenever they answer.
+// SNTP runs in the background; each time it syncs, we set the clock from it and work out how fast
+// millis() runs compared to real time, so the clock stays right between syncs, and keeps going
+// when the Wi-Fi is down. The local time is broken down once a minute and kept, so drawing the clock
+// never waits on anything (getLocalTime() would wait up to five seconds before the first sync).
+////////////////////////////////////////////////////////////////////////
+
+#include "arduino.h"
+#include "time.h"
+#include <sys/time.h>
+#include "esp_sntp.h"
+
+const uint32_t sntpInterval = 3600000; //ask the time servers once an hour
+const int32_t maxDrift = 500; //parts per million; anything more than this is a bad sync, not a slow crystal
+
+volatile bool sntpSynced = false; //set by the SNTP task, picked up in TimeKeeper::idle()
+
+void onSntpSync(struct timeval * tv){
+  sntpSynced = true;
+}
+
+class TimeKeeper {
+  public:
+  int64_t baseTime = 0; //real time at the last sync, in unix milliseconds
+  unsigned long baseMillis = 0; //millis() at the last sync
+  int32_t drift = 0; //how fast millis() runs against real time, in parts per million (positive is slow)
+  int32_t lastError = 0; //how far off we were at the last sync, in milliseconds
+  int syncs = 0;
+  long offset = 0; //time zone, seconds from UTC
+  struct tm local; //broken down local time, as of the start of this minute
+  char hm[6] = "--:--"; //and as "HH:MM"
+  long minute = -1; //which minute local and hm are for
+
+  //start SNTP in the background; it'll keep the clock set from here on
+  void begin(){
+    sntp_set_time_sync_notification_cb(onSntpSync);
+    sntp_set_sync_interval(sntpInterval);
+    configTime(0, 0, "pool.ntp.org", "time.nist.gov"); //UTC; we add the time zone ourselves
+  }
+
+  //false until the first sync
+  bool valid(){
+    return syncs > 0;
+  }
+
+  //unix time in milliseconds, by our clock
+  int64_t nowMs(){
+    int64_t since = (unsigned long)(millis() - baseMillis); //wraps properly across millis() rollover
+    return baseTime + since + since * drift / 1000000;
+  }
+
+  //unix time in seconds; 0 if we've never synced
+  time_t now(){
+    return valid() ? (time_t)(nowMs() / 1000) : 0;
+  }
+
+  void setOffset(long seconds){
+    if(seconds == offset) return;
+    offset = seconds;
+    minute = -1; //break the time down again
+  }
+
+  //pick up syncs and roll the cached time over to the next minute. Call every loop; it's cheap.
+  //returns true when the clock has just been set from the time servers.
+  bool idle(){
+    bool synced = false;
+    if(sntpSynced){
+      sntpSynced = false;
+      sync();
+      synced = true;
+    }
+    if(!valid()) return synced;
+    time_t t = now() + offset;
+    if(t / 60 != minute){
+      minute = t / 60;
+      gmtime_r(&t, &local);
+      strftime(hm, sizeof(hm), "%H:%M", &local);
+    }
+    return synced;
+  }
+
+  private:
+  //set our clock from the system clock, which SNTP just set
+  void sync(){
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    int64_t real = (int64_t)tv.tv_sec * 1000 + tv.tv_usec / 1000;
+    unsigned long m = millis();
+    if(syncs){
+      int64_t since = (unsigned long)(m - baseMillis);
+      lastError = (int32_t)(real - nowMs());
+      if(since > 60000){ //long enough to say something about the rate
+        int64_t rate = (real - baseTime - since) * 1000000 / since; //what the drift would have had to be
+        if(rate > -maxDrift && rate < maxDrift) drift = (drift + (int32_t)rate) / 2; //smooth it over syncs
+      }
+    }
+    baseTime = real;
+    baseMillis = m;
+    syncs++;
+    minute = -1;
+    Serial.print("Time synced, ");
+    Serial.print(lastError);
+    Serial.print("ms off, drift ");
+    Serial.print(drift);
+    Serial.println("ppm");
+  }
+};
+
+TimeKeeper timeKeeper;
+
+#endif
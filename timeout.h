@@ -6,6 +6,7 @@
 ////////////////////////////////////////////////////////////////////////////
 
 #include "arduino.h"
+#include "heapMonitor.h"
 
 template <typename CT, typename ... A> class function
 : public function<decltype(&CT::operator())()> {};
@@ -33,6 +34,7 @@ public:
   unsigned long timer;
   void (*voidCB)();
   timeOutFunc* callback;
+  size_t callbackSize;
   bool lambda;
 
   TimeOut(){
@@ -47,13 +49,17 @@ public:
 
   template<typename C>
   void set(const C & CB, unsigned int time){
+    release();
     running = true;
     timer = millis() + time;
     callback = new function<C>(CB);
+    callbackSize = sizeof(function<C>);
+    heapMon.note(HEAP_CALLBACKS, callbackSize);
     lambda = true;
   }
 
   void set(void (*CB)(), unsigned int time){
+    release();
     running = true;
     timer = millis() + time;
     voidCB = CB;
@@ -61,15 +67,23 @@ public:
   
   void clear(){
     running = false;
+    release(); //a cleared lambda used to stay allocated, and get called by the next function pointer set here
+  }
+
+  //free the lambda, if there is one
+  void release(){
+    if(lambda){
+      delete callback;
+      heapMon.note(HEAP_CALLBACKS, -(int32_t)callbackSize);
+    }
+    lambda = false;
   }
   
   bool idle(){
     if(timer < millis() && running){
-      if(lambda){
-        (*callback)();
-        delete callback;
-      } else voidCB();
-      lambda = false;
+      if(lambda) (*callback)(); //still running while it's called, so it can't be handed out again from inside it
+      else voidCB();
+      release();
       running = false;
       return true;
     }
@@ -102,7 +116,7 @@ void idleTimers(){
 }
 
 void clearTimeout(int which){
-  if(which >=0) timeOuts[which].running = false;
+  if(which >=0) timeOuts[which].clear();
 }
 
 #endif
@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+"""
+Compare kernel timings from a RUN_BENCHMARKS build against a saved baseline.
+
+Save the serial output of a RUN_BENCHMARKS build to a file, then:
+
+  bench.py check output.txt baseline.json [--slack 0.15]
+      fails (exit status 1) if any kernel is more than --slack slower than
+      the baseline, or if a baseline kernel is missing from the output.
+      No baseline is kept in the repo yet, since it has to come from a real
+      board: if baseline.json doesn't exist, the first check writes it from
+      output.txt (like update) and only checks the ALLOC and CHECK lines.
+      Commit it, and later checks compare against it.
+  bench.py update output.txt baseline.json
+      writes the timings in output.txt as the new baseline
+  bench.py show output.txt
+      prints the timings as one JSON document
+
+Timings are the mean microseconds per iteration from the BENCH lines.
+check also fails if any ALLOC line shows a heap allocation; those paths
+(frames, button presses) aren't meant to touch the heap at all. And it fails
+if any CHECK line (an on-device test, like nothing being put off the round
+panel) has failed cases.
+"""
+
+import argparse
+import json
+import os
+import sys
+
+
+def read_lines(path, prefix):
+    results = {}
+    for line in open(path, errors="replace"):
+        line = line.strip()
+        if not line.startswith(prefix + " {"):
+            continue
+        r = json.loads(line[len(prefix) + 1:])
+        results[r["name"]] = r
+    return results
+
+
+def read_results(path):
+    results = read_lines(path, "BENCH")
+    if not results:
+        sys.exit("no BENCH results in %s" % path)
+    return results
+
+
+def check(args):
+    results = read_results(args.output)
+    if os.path.exists(args.baseline):
+        baseline = json.load(open(args.baseline))["kernels"]
+    else:
+        print("no baseline at %s yet; writing this run as the baseline" % args.baseline)
+        update(args)
+        baseline = {name: r["us"] for name, r in results.items()}
+    failed = False
+    for name, base in sorted(baseline.items()):
+        if name not in results:
+            print("%-22s MISSING" % name)
+            failed = True
+            continue
+        now = results[name]["us"]
+        change = (now - base) / base if base else 0.0
+        slow = change > args.slack
+        failed |= slow
+        print("%-22s %10.2f us  baseline %10.2f  %+6.1f%%%s" % (name, now, base, change * 100, "  SLOWER" if slow else ""))
+    for name in sorted(set(results) - set(baseline)):
+        print("%-22s %10.2f us  (new, not in baseline)" % (name, results[name]["us"]))
+    for name, r in sorted(read_lines(args.output, "ALLOC").items()):
+        leaked = r["news"] or r["blocks"]
+        failed |= bool(leaked)
+        print("%-22s %4d news %4d blocks over %d runs%s" % (name, r["news"], r["blocks"], r["iters"], "  ALLOCATES" if leaked else ""))
+    for name, r in sorted(read_lines(args.output, "CHECK").items()):
+        failed |= bool(r["failed"])
+        print("%-22s %4d of %d cases failed%s" % (name, r["failed"], r["cases"], "  FAILED" if r["failed"] else ""))
+    sys.exit(1 if failed else 0)
+
+
+def update(args):
+    results = read_results(args.output)
+    doc = {"kernels": {name: r["us"] for name, r in sorted(results.items())}}
+    with open(args.baseline, "w") as f:
+        json.dump(doc, f, indent=2)
+        f.write("\n")
+    print("wrote %d kernels to %s" % (len(results), args.baseline))
+
+
+def show(args):
+    json.dump({"kernels": read_results(args.output), "allocs": read_lines(args.output, "ALLOC"),
+               "checks": read_lines(args.output, "CHECK")}, sys.stdout, indent=2)
+    print()
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = ap.add_subparsers(dest="cmd", required=True)
+    c = sub.add_parser("check")
+    c.add_argument("output")
+    c.add_argument("baseline")
+    c.add_argument("--slack", type=float, default=0.15, help="allowed slowdown, as a fraction (0.15 = 15%%)")
+    c.set_defaults(fn=check)
+    u = sub.add_parser("update")
+    u.add_argument("output")
+    u.add_argument("baseline")
+    u.set_defaults(fn=update)
+    s = sub.add_parser("show")
+    s.add_argument("output")
+    s.set_defaults(fn=show)
+    args = ap.parse_args()
+    args.fn(args)
+
+
+if __name__ == "__main__":
+    main()
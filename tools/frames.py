@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+"""
+Turn a serial capture from a FRAME_CAPTURE build into images, and compare captures.
+
+Save the serial output of a FRAME_CAPTURE build to a file (for example
+`cat /dev/ttyACM0 > capture.bin` while the board boots), then:
+
+  frames.py extract capture.bin out/           writes out/<label>.ppm for every frame
+  frames.py compare capture.bin golden/ [--tol 8] [--max-bad 0]
+                                               compares each frame against golden/<label>.ppm
+
+compare exits with status 1 if any frame has more than --max-bad pixels whose
+colour channels differ by more than --tol, or if a golden image is missing.
+
+No golden images are kept in the repo yet; they have to come from a real board.
+The first compare against a golden folder that's missing or empty writes that
+capture's frames into it as the reference, and passes. Look the frames over,
+commit the folder, and every compare after that checks against them.
+Packets are "FRM1", label length, label, width, height (little endian), then
+width*height RGB332 pixels; anything else in the stream (debug prints) is skipped.
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+MAGIC = b"FRM1"
+
+
+def read_frames(path):
+    data = open(path, "rb").read()
+    frames = []
+    seen = {}
+    pos = data.find(MAGIC)
+    while pos >= 0:
+        p = pos + 4
+        if p >= len(data):
+            break
+        n = data[p]
+        label = data[p + 1:p + 1 + n].decode("ascii", "replace")
+        p += 1 + n
+        if p + 4 > len(data):
+            break
+        w, h = struct.unpack("<HH", data[p:p + 4])
+        p += 4
+        if p + w * h > len(data):
+            print("truncated frame '%s', skipping" % label, file=sys.stderr)
+            break
+        # labels can repeat ("live" frames); number the repeats so every frame gets a file
+        count = seen.get(label, 0)
+        seen[label] = count + 1
+        name = label if count == 0 else "%s-%d" % (label, count)
+        frames.append((name, w, h, data[p:p + w * h]))
+        pos = data.find(MAGIC, p + w * h)
+    return frames
+
+
+def rgb332(c):
+    return ((c >> 5) * 255 // 7, ((c >> 2) & 7) * 255 // 7, (c & 3) * 255 // 3)
+
+
+def to_rgb(pixels):
+    lut = [bytes(rgb332(c)) for c in range(256)]
+    return b"".join(lut[c] for c in pixels)
+
+
+def write_ppm(path, w, h, rgb):
+    with open(path, "wb") as f:
+        f.write(b"P6\n%d %d\n255\n" % (w, h))
+        f.write(rgb)
+
+
+def read_ppm(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    parts = []
+    p = 0
+    while len(parts) < 4:  # magic, width, height, maxval; skip comments and whitespace
+        while data[p:p + 1].isspace():
+            p += 1
+        if data[p:p + 1] == b"#":
+            p = data.index(b"\n", p)
+            continue
+        start = p
+        while not data[p:p + 1].isspace():
+            p += 1
+        parts.append(data[start:p])
+    if parts[0] != b"P6":
+        raise ValueError("%s is not a binary PPM" % path)
+    w, h = int(parts[1]), int(parts[2])
+    return w, h, data[p + 1:p + 1 + w * h * 3]
+
+
+def extract(args):
+    os.makedirs(args.out, exist_ok=True)
+    for name, w, h, pixels in read_frames(args.capture):
+        write_ppm(os.path.join(args.out, name + ".ppm"), w, h, to_rgb(pixels))
+        print(name)
+
+
+def compare(args):
+    if not os.path.isdir(args.golden) or not any(f.endswith(".ppm") for f in os.listdir(args.golden)):
+        if not read_frames(args.capture):
+            sys.exit("no frames in %s, nothing to use as the reference" % args.capture)
+        print("no golden images in %s yet; writing this capture as the reference" % args.golden)
+        args.out = args.golden
+        extract(args)
+        return
+    failed = False
+    for name, w, h, pixels in read_frames(args.capture):
+        golden = os.path.join(args.golden, name + ".ppm")
+        if not os.path.exists(golden):
+            if name.startswith("live"):
+                continue
+            print("%-24s MISSING golden image" % name)
+            failed = True
+            continue
+        gw, gh, ref = read_ppm(golden)
+        if (gw, gh) != (w, h):
+            print("%-24s SIZE %dx%d, golden is %dx%d" % (name, w, h, gw, gh))
+            failed = True
+            continue
+        rgb = to_rgb(pixels)
+        bad = 0
+        for i in range(0, len(rgb), 3):
+            if max(abs(rgb[i] - ref[i]), abs(rgb[i + 1] - ref[i + 1]), abs(rgb[i + 2] - ref[i + 2])) > args.tol:
+                bad += 1
+        ok = bad <= args.max_bad
+        failed |= not ok
+        print("%-24s %s (%d pixels differ)" % (name, "ok" if ok else "FAIL", bad))
+        if not ok and args.diff:
+            os.makedirs(args.diff, exist_ok=True)
+            write_ppm(os.path.join(args.diff, name + ".ppm"), w, h, rgb)
+    sys.exit(1 if failed else 0)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = ap.add_subparsers(dest="cmd", required=True)
+    e = sub.add_parser("extract", help="write every captured frame as a PPM")
+    e.add_argument("capture")
+    e.add_argument("out")
+    e.set_defaults(fn=extract)
+    c = sub.add_parser("compare", help="compare captured frames against golden PPMs")
+    c.add_argument("capture")
+    c.add_argument("golden")
+    c.add_argument("--tol", type=int, default=8, help="allowed difference per colour channel (0-255)")
+    c.add_argument("--max-bad", type=int, default=0, help="pixels allowed over the tolerance per frame")
+    c.add_argument("--diff", help="folder to write failing frames to, for a look")
+    c.set_defaults(fn=compare)
+    args = ap.parse_args()
+    args.fn(args)
+
+
+if __name__ == "__main__":
+    main()
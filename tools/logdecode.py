@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+"""
+Decode the binary event log (see eventLog.h) out of the sketch's serial output.
+
+  logdecode.py CAPTURE            a file of raw serial output
+  logdecode.py /dev/ttyACM0       read the port live (needs pyserial)
+  [--header eventLog.h] [--baud 115200]
+
+Ordinary text is printed as it comes. Each record is a 0xA5 byte and a
+LogRecord; it's printed as its time, level and the event's format string
+with the record's numbers filled in. The event names and formats are read
+from eventLog.h, so the two can't drift apart.
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+SYNC = 0xA5
+RECORD = struct.Struct("<IBBH3i")  # ms, event, level, pad, args[3]
+LEVELS = ["DEBUG", "INFO", "WARN", "ERROR"]
+
+
+def read_events(path):
+    text = open(path).read()
+    events = re.findall(r'X\((\w+),\s*"((?:[^"\\]|\\.)*)"\)', text)
+    if not events:
+        sys.exit("no LOG_EVENTS found in %s" % path)
+    return events
+
+
+def describe(events, raw):
+    ms, event, level, _, a, b, c = RECORD.unpack(raw)
+    if event < len(events):
+        name, fmt = events[event]
+        n = fmt.count("%d")
+        msg = fmt % (a, b, c)[:n] if n else fmt
+    else:
+        msg = "unknown event %d: %d %d %d" % (event, a, b, c)
+    lvl = LEVELS[level] if level < len(LEVELS) else str(level)
+    return "[%10.3f] %-5s %s" % (ms / 1000.0, lvl, msg)
+
+
+def decode(stream, events, out):
+    text = bytearray()
+    while True:
+        b = stream.read(1)
+        if not b:
+            break
+        if b[0] != SYNC:
+            text += b
+            if b == b"\n":
+                out.write(text.decode(errors="replace"))
+                text.clear()
+            continue
+        raw = b""
+        while len(raw) < RECORD.size:
+            more = stream.read(RECORD.size - len(raw))
+            if not more:
+                return
+            raw += more
+        if text:  # a record in the middle of a line goes on its own line
+            out.write(text.decode(errors="replace") + "\n")
+            text.clear()
+        out.write(describe(events, raw) + "\n")
+        out.flush()
+    if text:
+        out.write(text.decode(errors="replace"))
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("source")
+    ap.add_argument("--header", default=os.path.join(here, "..", "eventLog.h"))
+    ap.add_argument("--baud", type=int, default=115200)
+    args = ap.parse_args()
+    events = read_events(args.header)
+
+    if args.source.startswith("/dev/") or args.source.upper().startswith("COM"):
+        import serial
+        stream = serial.Serial(args.source, args.baud)
+    else:
+        stream = open(args.source, "rb")
+    try:
+        decode(stream, events, sys.stdout)
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
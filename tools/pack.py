@@ -0,0 +1,203 @@
+#!/usr/bin/env python3
+"""
+Pack the sprite sheets into compressed 8 bit assets for the sketch.
+
+Reads the 16 bit image headers made with FileToCArray (smallDogs.h and friends),
+converts every pixel to 8 bit RGB332 the same way TFT_eSPI does for 8 bit
+sprites, cuts each sheet into frames, and compresses every frame on its own so
+any frame can be decoded without the others. Writes packedAssets.h, and prints
+the size of each sheet before and after.
+
+In sheets drawn as sprites, 0x1C (green) is transparent and 0x00 (black) is a
+shadow, so only pure green and pure black are packed as those; any other colour
+that would round to one of them gets the nearest colour that isn't special.
+
+  pack.py [--repo DIR] [--out packedAssets.h] [--no-swap]
+
+The compressed format (decoded by unpack.h) is a stream of tokens:
+  0xxxxxxx             a run of x+1 literal bytes follows
+  1xxxxxxx oooooooo    copy x+3 bytes starting o+1 bytes back in the output
+Matches only reach back 256 bytes, so the decoder's window is 256 bytes.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+WINDOW = 256
+MIN_MATCH = 3
+MAX_MATCH = 130
+MAX_LITERALS = 128
+
+# colours the blitter treats specially in sprites: green isn't drawn, black is a shadow
+CLEAR8 = 0x1C
+SHADOW8 = 0x00
+GREEN16 = 0x07E0
+BLACK16 = 0x0000
+
+# name in the sketch, source header, array name in it, frame width, frame height, whether it's drawn as a sprite
+# (and so has to keep the special colours for the pixels meant to be them; the background is copied straight)
+SHEETS = [
+    ("packedDogs", "smallDogs.h", "smallDogs", 32, 32, True),
+    ("packedDogsAlt", "smallDogsAlt.h", "smallDogs", 32, 32, True),
+    ("packedBg", "smallBg.h", "smallBg", 120, 120, False),
+    ("packedBubble", "bubble.h", "bubble", 32, 32, True),
+    ("packedEmojis", "emoji.h", "emojis", 16, 16, True),
+]
+
+
+def read_header(path, array):
+    text = open(path).read()
+    w = int(re.search(r"#define\s+\w+_WIDTH\s+(\d+)", text).group(1))
+    h = int(re.search(r"#define\s+\w+_HEIGHT\s+(\d+)", text).group(1))
+    body = re.search(r"%s\[\]\s*PROGMEM\s*=\s*\{(.*?)\};" % array, text, re.S).group(1)
+    words = [int(v, 16) for v in re.findall(r"0x[0-9a-fA-F]+", body)]
+    if len(words) != w * h:
+        sys.exit("%s: expected %d pixels, found %d" % (path, w * h, len(words)))
+    return w, h, words
+
+
+def rgb565(c):
+    return ((c >> 11) & 0x1F) * 255 // 31, ((c >> 5) & 0x3F) * 255 // 63, (c & 0x1F) * 255 // 31
+
+
+def rgb332(v):
+    return (v >> 5) * 255 // 7, ((v >> 2) & 7) * 255 // 7, (v & 3) * 255 // 3
+
+
+# the nearest colour to a 16 bit one that isn't one of the special ones
+def nearest332(c):
+    r, g, b = rgb565(c)
+
+    def dist(v):
+        vr, vg, vb = rgb332(v)
+        return (vr - r) ** 2 + (vg - g) ** 2 + (vb - b) ** 2
+    return min((v for v in range(256) if v not in (CLEAR8, SHADOW8)), key=dist)
+
+
+# sprite is true for sheets drawn by the blitter: only pure green and pure black get the special colours there,
+# so a near-black or near-green pixel stays a colour instead of turning into a shadow or a hole.
+def to332(c, swap, sprite=False):
+    if swap:
+        c = ((c & 0xFF) << 8) | (c >> 8)
+    v = ((c & 0xE000) >> 8) | ((c & 0x0700) >> 6) | ((c & 0x0018) >> 3)
+    if sprite and ((v == SHADOW8 and c != BLACK16) or (v == CLEAR8 and c != GREEN16)):
+        v = nearest332(c)
+    return v
+
+
+def compress(data):
+    out = bytearray()
+    lits = bytearray()
+
+    def flush():
+        while lits:
+            n = min(len(lits), MAX_LITERALS)
+            out.append(n - 1)
+            out.extend(lits[:n])
+            del lits[:n]
+
+    i = 0
+    while i < len(data):
+        best, off = 0, 0
+        for d in range(1, min(WINDOW, i) + 1):  # greedy; the sheets are small, so brute force is fine
+            n = 0
+            while n < MAX_MATCH and i + n < len(data) and data[i + n] == data[i + n - d]:
+                n += 1
+            if n > best:
+                best, off = n, d
+                if n == MAX_MATCH:
+                    break
+        if best >= MIN_MATCH:
+            flush()
+            out.append(0x80 | (best - MIN_MATCH))
+            out.append(off - 1)
+            i += best
+        else:
+            lits.append(data[i])
+            if len(lits) == MAX_LITERALS:
+                flush()
+            i += 1
+    flush()
+    return bytes(out)
+
+
+def decompress(packed, size):
+    out = bytearray()
+    i = 0
+    while len(out) < size:
+        t = packed[i]
+        i += 1
+        if t & 0x80:
+            n, d = (t & 0x7F) + MIN_MATCH, packed[i] + 1
+            i += 1
+            for _ in range(n):
+                out.append(out[-d])
+        else:
+            out.extend(packed[i:i + t + 1])
+            i += t + 1
+    return bytes(out)
+
+
+def frames(w, h, pixels, fw, fh):
+    for r in range(h // fh):
+        for c in range(w // fw):
+            yield bytes(pixels[(r * fh + y) * w + c * fw + x] for y in range(fh) for x in range(fw))
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("--repo", default=os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+    ap.add_argument("--out", default=None)
+    ap.add_argument("--no-swap", action="store_true", help="the 16 bit headers aren't byte swapped (big-endian)")
+    args = ap.parse_args()
+    out_path = os.path.normpath(args.out or os.path.join(args.repo, "packedAssets.h"))
+
+    lines = [
+        "#ifndef PACKED_ASSETS",
+        "#define PACKED_ASSETS",
+        "",
+        "// Generated by tools/pack.py from the 16 bit image headers; don't edit, run the packer again.",
+        "// 8 bit (RGB332) frames, each compressed on its own (see unpack.h).",
+        "",
+        '#include "unpack.h"',
+        "",
+    ]
+    total_raw = total_packed = 0
+    print("%-14s %-16s %8s %8s %8s %6s" % ("sheet", "source", "16 bit", "8 bit", "packed", "ratio"))
+    for name, src, array, fw, fh, sprite in SHEETS:
+        w, h, words = read_header(os.path.join(args.repo, src), array)
+        pixels = [to332(c, not args.no_swap, sprite) for c in words]
+        data = bytearray()
+        offsets = []
+        for f in frames(w, h, pixels, fw, fh):
+            packed = compress(f)
+            assert decompress(packed, len(f)) == f
+            offsets.append(len(data))
+            data.extend(packed)
+        offsets.append(len(data))
+        raw16 = w * h * 2
+        total_raw += raw16
+        total_packed += len(data) + 4 * len(offsets)
+        print("%-14s %-16s %8d %8d %8d %5.1fx" % (name, src, raw16, w * h, len(data), raw16 / float(len(data))))
+
+        lines.append("// %s: %dx%d frames, %d across, %d down; %d bytes, from %d" % (src, fw, fh, w // fw, h // fh, len(data), raw16))
+        lines.append("static const uint32_t %sOffsets[] PROGMEM = {" % name)
+        for i in range(0, len(offsets), 12):
+            lines.append("  " + ", ".join(str(o) for o in offsets[i:i + 12]) + ",")
+        lines.append("};")
+        lines.append("static const uint8_t %sData[] PROGMEM = {" % name)
+        for i in range(0, len(data), 24):
+            lines.append("  " + ", ".join("0x%02x" % b for b in data[i:i + 24]) + ",")
+        lines.append("};")
+        lines.append("const PackedSheet %s = {%d, %d, %d, %d, %sOffsets, %sData, NULL};" % (name, fw, fh, w // fw, h // fh, name, name))
+        lines.append("")
+    lines.append("#endif")
+    open(out_path, "w").write("\n".join(lines) + "\n")
+    print("%-31s %8d %17d %5.1fx" % ("total (with offsets)", total_raw, total_packed, total_raw / float(total_packed)))
+    print("wrote %s" % out_path)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+"""
+Build a skin pack: extra dog sprite sheets for the "skins" flash partition.
+
+  skinpack.py skins.bin NAME=HEADER[:ARRAY] [NAME=HEADER[:ARRAY] ...] [--palette] [--no-swap]
+
+Each HEADER is a 16 bit image header from FileToCArray, laid out like
+smallDogs.h (32x32 frames, one Action per row). ARRAY defaults to smallDogs.
+NAME is what the skin menu shows, up to 12 characters. --palette stores
+palette indexes instead of colours. Then flash the pack into the partition:
+
+  esptool.py --chip esp32s2 write_flash 0x1F0000 skins.bin
+
+(0x1F0000 is the skins partition in partitions.csv). The layout is described
+in skinPack.h; frames are compressed the same way as pack.py does it. The pack
+is read back and every frame is checked against its source before it's written.
+"""
+
+import argparse
+import struct
+import sys
+
+import pack
+
+FRAME_W, FRAME_H = 32, 32
+
+
+def build_skin(pixels, w, h, use_palette):
+    palette = b""
+    if use_palette:
+        colours = sorted(set(pixels))
+        index = {c: i for i, c in enumerate(colours)}
+        palette = bytes(colours)
+        pixels = [index[c] for c in pixels]
+    data = bytearray()
+    offsets = []
+    for f in pack.frames(w, h, pixels, FRAME_W, FRAME_H):
+        offsets.append(len(data))
+        data.extend(pack.compress(f))
+    offsets.append(len(data))
+    out = bytearray(b"SKN1")
+    out += struct.pack("<HHHHHHI", FRAME_W, FRAME_H, w // FRAME_W, h // FRAME_H, len(palette), 0, len(data))
+    out += struct.pack("<%dI" % len(offsets), *offsets)
+    out += palette + b"\0" * (-len(palette) % 4)
+    out += data
+    return bytes(out)
+
+
+def build_pack(skins):
+    table_size = 16 + 16 * len(skins)
+    body = bytearray()
+    entries = bytearray()
+    for name, skin in skins:
+        body += b"\0" * (-(table_size + len(body)) % 4)  # skins start 4 byte aligned
+        entries += struct.pack("<12sI", name.encode()[:12], table_size + len(body))
+        body += skin
+    total = table_size + len(body)
+    return bytes(b"SKP1" + struct.pack("<HHII", len(skins), 0, total, 0) + entries + body)
+
+
+# read a pack back the way skinPack.h does, and unpack every frame
+def read_pack(blob):
+    assert blob[:4] == b"SKP1"
+    count = struct.unpack_from("<H", blob, 4)[0]
+    skins = []
+    for i in range(count):
+        name, at = struct.unpack_from("<12sI", blob, 16 + 16 * i)
+        assert blob[at:at + 4] == b"SKN1" and at % 4 == 0
+        fw, fh, cols, rows, pal, _, size = struct.unpack_from("<HHHHHHI", blob, at + 4)
+        offsets = struct.unpack_from("<%dI" % (cols * rows + 1), blob, at + 20)
+        pal_at = at + 20 + 4 * len(offsets)
+        palette = blob[pal_at:pal_at + pal]
+        data_at = pal_at + ((pal + 3) & ~3)
+        frames = []
+        for n in range(cols * rows):
+            f = pack.decompress(blob[data_at + offsets[n]:data_at + offsets[n + 1]], fw * fh)
+            frames.append(bytes(palette[b] for b in f) if pal else f)
+        skins.append((name.rstrip(b"\0").decode(), frames))
+    return skins
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("out")
+    ap.add_argument("skins", nargs="+", metavar="NAME=HEADER[:ARRAY]")
+    ap.add_argument("--palette", action="store_true")
+    ap.add_argument("--no-swap", action="store_true", help="the 16 bit headers aren't byte swapped (big-endian)")
+    args = ap.parse_args()
+
+    skins, sources = [], []
+    for spec in args.skins:
+        name, _, src = spec.partition("=")
+        path, _, array = src.partition(":")
+        if not name or not path or len(name) > 12:
+            sys.exit("bad skin %r; want NAME=HEADER[:ARRAY], with a name of up to 12 characters" % spec)
+        w, h, words = pack.read_header(path, array or "smallDogs")
+        pixels = [pack.to332(c, not args.no_swap, True) for c in words]
+        skin = build_skin(pixels, w, h, args.palette)
+        skins.append((name, skin))
+        sources.append(list(pack.frames(w, h, pixels, FRAME_W, FRAME_H)))
+        print("%-12s %-20s %6d bytes, from %d" % (name, path, len(skin), w * h * 2))
+
+    blob = build_pack(skins)
+    for (name, frames), source in zip(read_pack(blob), sources):
+        if frames != source:
+            sys.exit("%s didn't read back the same; not writing the pack" % name)
+    open(args.out, "wb").write(blob)
+    print("wrote %d skins, %d bytes, to %s" % (len(skins), len(blob), args.out))
+
+
+if __name__ == "__main__":
+    main()
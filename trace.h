@@ -0,0 +1,237 @@
+#ifndef TRACE_OBJ
+#define TRACE_OBJ
+
+////////////////////////////////////////////////////////////////////////
+// Recording a session and playing it back, for before and after numbers on the same inputs.
+// With TRACE_RECORD defined, everything that comes into the sketch from outside goes into /trace.bin:
+// the random seed, each button press and release (after debouncing), and each network reply.
+// With TRACE_REPLAY defined, the real buttons and network are ignored, and the same inputs are fed
+// back in from the file. Presses come at the same times after setup, and replies go to the same requests
+// in order. Frame, tick and loop times are counted while it plays. When the trace runs out, they're
+// printed as BENCH lines (see bench.h), so two builds can be compared over the same session with
+// tools/bench.py. The file stays in LittleFS when a new build is flashed, so record once, then flash
+// the before and after builds with TRACE_REPLAY.
+// Timing on the chip is never exactly the same twice, so a replay is the same session to within a loop,
+// not frame for frame; it runs with whatever config is on the chip.
+//
+// A reply longer than traceReplySize can't be kept whole, and the parser would go a different way on a
+// cut off copy, so it's recorded as cut off instead (and logged), and a trace with one in won't replay.
+//
+// File: "TRC1", the seed (4 bytes), then records: milliseconds since setup finished (4 bytes), type,
+// arg, payload length (2 bytes), payload. Little endian, straight out of the structs.
+////////////////////////////////////////////////////////////////////////
+
+#include "arduino.h"
+#include <LittleFS.h>
+#include "ArduinoJson.h"
+#include "bench.h"
+#include "eventLog.h"
+
+//#define TRACE_RECORD //uncomment to record a session into /trace.bin
+//#define TRACE_REPLAY //uncomment to play /trace.bin back and time it
+
+#if defined(TRACE_RECORD) && defined(TRACE_REPLAY)
+#error "record a trace or replay one, not both"
+#endif
+
+const char * tracePath = "/trace.bin";
+const unsigned long traceFlushTime = 10000; //write a recording out to flash this often
+const unsigned long traceReplyLate = 5000; //skip a recorded reply if nothing's asked for it by this long after it came
+
+enum TraceType : uint8_t {
+  TR_BUTTON, //arg is the pin times two, plus one if pressed
+  TR_REPLY, //arg is 1 for a reply (the payload is the body), 0 for a failed request, and 2 for one too long to keep
+};
+
+const uint8_t traceReplyCut = 2;
+
+struct TraceRecord {
+  uint32_t ms;
+  uint8_t type;
+  uint8_t arg;
+  uint16_t len;
+};
+
+#if defined(TRACE_RECORD) || defined(TRACE_REPLAY)
+const size_t traceReplySize = 2048; //longest reply kept; the weather is about 500 bytes
+#else
+const size_t traceReplySize = 1; //no room needed when there's no tracing
+#endif
+
+//passes a reply through to the json parser, keeping a copy of what went by
+class TraceTee : public Stream {
+  public:
+  Stream & src;
+  char * buf;
+  size_t len = 0; //bytes kept in buf
+  size_t total = 0; //bytes that went by; more than len if the reply didn't fit
+
+  TraceTee(Stream & s, char * b) : src(s), buf(b) {}
+
+  int available(){ return src.available(); }
+  int peek(){ return src.peek(); }
+  size_t write(uint8_t c){ return 0; }
+
+  int read(){
+    int c = src.read();
+    if(c < 0) return c;
+    total++;
+    if(len < traceReplySize) buf[len++] = c;
+    return c;
+  }
+};
+
+class Trace {
+  public:
+  File file;
+  bool recording = false, replaying = false;
+  uint32_t seed = 0;
+  unsigned long start = 0; //millis() when setup finished; the times in the file count from here
+  unsigned long nextFlush = 0;
+  TraceRecord next; //the next record to play back
+  bool pending = false; //whether next has anything in it
+  char reply[traceReplySize]; //one reply, on its way in or out
+  BenchResult frames = {"replay_frame", 0, 0, 0xffffffff, 0};
+  BenchResult ticks = {"replay_sim", 0, 0, 0xffffffff, 0};
+  BenchResult loops = {"replay_loop", 0, 0, 0xffffffff, 0};
+  uint32_t lastLoop = 0; //micros() at the start of the last loop
+
+  //open the trace and seed random(); once LittleFS is up, and before anything random happens
+  void begin(){
+#if defined(TRACE_RECORD)
+    file = LittleFS.open(tracePath, FILE_WRITE);
+    recording = file;
+    seed = esp_random();
+    if(recording) file.write((const uint8_t *)"TRC1", 4), file.write((const uint8_t *)&seed, 4);
+#elif defined(TRACE_REPLAY)
+    file = LittleFS.open(tracePath);
+    uint8_t magic[4];
+    replaying = file && file.read(magic, 4) == 4 && !memcmp(magic, "TRC1", 4) && file.read((uint8_t *)&seed, 4) == 4;
+    replaying = replaying && whole();
+    if(replaying) readNext();
+    else file.close(), seed = esp_random(); //nothing to play; carry on as normal
+#else
+    return; //not tracing: random() stays on the hardware generator
+#endif
+    randomSeed(seed);
+    LOGI(EV_TRACE_START, recording ? 1 : replaying ? 2 : 0, seed);
+  }
+
+  //setup's done; button times count from here
+  void startClock(){
+    start = millis();
+    lastLoop = micros();
+  }
+
+  //check every reply in the trace was kept whole, and every record fits (in reply, and in the file; a damaged
+  //or foreign trace.bin mustn't run playReply off the end of reply), then go back to the first record
+  bool whole(){
+    TraceRecord r;
+    size_t at = file.position(), size = file.size();
+    bool ok = true;
+    while(ok && file.read((uint8_t *)&r, sizeof(r)) == sizeof(r)){
+      if(r.type == TR_REPLY && r.arg == traceReplyCut) ok = false;
+      else if(r.len > traceReplySize || file.position() + r.len > size) ok = false;
+      if(!ok) LOGW(EV_TRACE_REFUSED, r.ms);
+      else file.seek(file.position() + r.len);
+    }
+    file.seek(at);
+    return ok;
+  }
+
+  void readNext(){
+    pending = file.read((uint8_t *)&next, sizeof(next)) == sizeof(next);
+    if(!pending) finish();
+  }
+
+  void add(TraceType type, uint8_t arg, const char * payload = NULL, uint16_t len = 0){
+    if(!recording) return;
+    TraceRecord r = {(uint32_t)(millis() - start), type, arg, len};
+    file.write((const uint8_t *)&r, sizeof(r));
+    if(len) file.write((const uint8_t *)payload, len);
+  }
+
+  void button(uint8_t pin, bool pressed){
+    add(TR_BUTTON, pin << 1 | pressed);
+  }
+
+  //the next recorded button edge, if it's time for it; skips replies nobody asked for in time
+  bool nextButton(uint8_t & pin, bool & pressed){
+    unsigned long now = millis() - start;
+    while(pending && next.type == TR_REPLY && (long)(now - next.ms) > (long)traceReplyLate){
+      LOGW(EV_TRACE_SKIP, next.ms);
+      file.seek(file.position() + next.len);
+      readNext();
+    }
+    if(!pending || next.type != TR_BUTTON || (long)(now - next.ms) < 0) return false;
+    pin = next.arg >> 1, pressed = next.arg & 1;
+    readNext();
+    return true;
+  }
+
+  //play back the next reply into doc, in place of a request; returns an http code like the request would
+  int playReply(JsonDocument & doc, DeserializationError & error){
+    if(!pending || next.type != TR_REPLY){ //the session went differently this time
+      LOGW(EV_TRACE_SKIP, millis() - start);
+      return -1;
+    }
+    uint16_t len = next.len; //never more than traceReplySize; whole() refused the trace if it was
+    bool ok = next.arg == 1;
+    file.read((uint8_t *)reply, len);
+    readNext();
+    if(!ok) return -1;
+    error = deserializeJson(doc, reply, len);
+    return 200;
+  }
+
+  //record a reply, after it's been parsed through a TraceTee on reply
+  //total is how long the reply really was; if it's more than len, the reply didn't fit
+  void recordReply(int httpCode, size_t len, size_t total = 0){
+    if(httpCode <= 0) add(TR_REPLY, 0);
+    else if(total > len){
+      LOGW(EV_TRACE_CUT, total, traceReplySize);
+      add(TR_REPLY, traceReplyCut);
+    } else add(TR_REPLY, 1, reply, len);
+  }
+
+  void count(BenchResult & r, uint32_t us){
+    r.iters++;
+    r.total += us;
+    if(us < r.best) r.best = us;
+    if(us > r.worst) r.worst = us;
+  }
+
+  void frame(uint32_t us){
+    if(replaying) count(frames, us);
+  }
+
+  void tick(uint32_t us){
+    if(replaying) count(ticks, us);
+  }
+
+  //once a loop: times the loops while replaying, and writes a recording out every so often
+  void idle(){
+    uint32_t now = micros();
+    if(replaying) count(loops, now - lastLoop);
+    lastLoop = now;
+    if(recording && (long)(millis() - nextFlush) >= 0){
+      nextFlush = millis() + traceFlushTime;
+      file.flush();
+    }
+  }
+
+  //the trace ran out: print what we counted, and give the buttons and network back
+  void finish(){
+    replaying = false;
+    file.close();
+    LOGI(EV_TRACE_END, millis() - start);
+    eventLog.flush();
+    benchReport(frames);
+    benchReport(ticks);
+    benchReport(loops);
+  }
+};
+
+Trace trace;
+
+#endif
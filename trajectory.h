@@ -0,0 +1,57 @@
+#ifndef TRAJECTORY_OBJ
+#define TRAJECTORY_OBJ
+
+////////////////////////////////////////////////////////////////////////
+// A thrown thing's path through the air, worked out once when it's thrown.
+// throwArc() fills a short table of points along the arc; after that, where the thing is at
+// any time is a lookup between two of them, with no floats or sin() in the per-frame path.
+// Times are kept as unsigned millis() and compared by subtracting, so they survive rollover.
+////////////////////////////////////////////////////////////////////////
+
+#include "arduino.h"
+#include "fixmath.h"
+
+const int trajectorySteps = 32; //points along the arc, not counting the start
+
+class Trajectory {
+  public:
+  int16_t px[trajectorySteps+1], py[trajectorySteps+1];
+  unsigned long start = 0;
+  unsigned long duration = 0;
+
+  //straight across from X0, Y0 to X1, Y1 over dur milliseconds, rising height pixels in the middle
+  void throwArc(int X0, int Y0, int X1, int Y1, int height, unsigned long dur, unsigned long now){
+    start = now;
+    duration = dur;
+    for(int i=0; i<=trajectorySteps; i++){
+      fix16 t = fixFrac(i, trajectorySteps);
+      fix16 lift = fixSin((uint16_t)(t >> 1)) * height; //half a turn of sine over the throw; FIX_ONE is a whole turn
+      px[i] = fromFix(fixLerp(toFix(X0), toFix(X1), t));
+      py[i] = fromFix(fixLerp(toFix(Y0), toFix(Y1), t) - lift);
+    }
+  }
+
+  bool done(unsigned long now){
+    return now - start >= duration;
+  }
+
+  //time since the throw ended; 0 while still in the air
+  unsigned long since(unsigned long now){
+    return done(now) ? now - start - duration : 0;
+  }
+
+  //where the thing is at time now
+  void sample(unsigned long now, int & X, int & Y){
+    fix16 t = fixFrac(now - start, duration) * trajectorySteps; //whole steps in the top half, fraction in the bottom
+    int i = t >> 16;
+    if(i >= trajectorySteps){
+      X = px[trajectorySteps], Y = py[trajectorySteps];
+      return;
+    }
+    fix16 f = t & (FIX_ONE - 1);
+    X = px[i] + fromFix((px[i+1] - px[i]) * f);
+    Y = py[i] + fromFix((py[i+1] - py[i]) * f);
+  }
+};
+
+#endif
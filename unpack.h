@@ -0,0 +1,68 @@
+#ifndef UNPACK_OBJ
+#define UNPACK_OBJ
+
+////////////////////////////////////////////////////////////////////////
+// Decoder for the compressed sprite sheets made by tools/pack.py.
+// Each frame is compressed on its own, as a stream of tokens:
+//   0xxxxxxx           x+1 literal bytes follow
+//   1xxxxxxx offset    copy x+3 bytes from offset+1 bytes back
+// The decoder works a few bytes at a time, so a frame can be drawn row by row straight out of flash,
+// only keeping the last 256 bytes it made (the furthest back a copy can reach).
+////////////////////////////////////////////////////////////////////////
+
+#include "arduino.h"
+
+//a sheet of frames, as written by the packer
+struct PackedSheet {
+  uint16_t fw, fh; //frame size
+  uint16_t cols, rows;
+  const uint32_t * offsets; //where each frame starts in data, plus one past the end
+  const uint8_t * data;
+  const uint8_t * palette; //if set, data holds indexes into this, rather than colours
+
+  int frames() const {
+    return cols*rows;
+  }
+};
+
+class Unpacker {
+  public:
+  const uint8_t * src = NULL;
+  const uint8_t * palette = NULL;
+  uint8_t window[256]; //the last 256 bytes out, for copies; indexed by the low byte of pos
+  uint8_t pos = 0;
+  uint8_t lits = 0; //literal bytes left in the current token
+  uint8_t copy = 0; //bytes left to copy in the current token
+  uint8_t back = 0; //how far back the copy reads from
+
+  //start on frame n of a sheet
+  void begin(const PackedSheet & sheet, int n){
+    src = sheet.data + sheet.offsets[n];
+    palette = sheet.palette;
+    lits = copy = 0;
+  }
+
+  //decode the next len bytes of the frame into out
+  void read(uint8_t * out, int len){
+    for(int i=0; i<len; i++){
+      if(!lits && !copy){ //next token
+        uint8_t t = *src++;
+        if(t & 0x80) copy = (t & 0x7F) + 3, back = *src++ + 1;
+        else lits = t + 1;
+      }
+      uint8_t b;
+      if(lits) b = *src++, lits--;
+      else b = window[(uint8_t)(pos - back)], copy--;
+      window[pos++] = b;
+      out[i] = palette ? palette[b] : b;
+    }
+  }
+
+  //decode a whole frame
+  void frame(const PackedSheet & sheet, int n, uint8_t * out){
+    begin(sheet, n);
+    read(out, sheet.fw*sheet.fh);
+  }
+};
+
+#endif
@@ -0,0 +1,211 @@
+#ifndef WIFI_CONNECT_OBJ
+#define WIFI_CONNECT_OBJ
+
+////////////////////////////////////////////////////////////////////////
+// Getting onto a saved Wi-Fi network quickly at boot.
+// The network, access point, channel and IP settings of the last good connection are kept in a small file.
+// On boot we try those directly first: no scan, and the remembered address so joining doesn't wait on DHCP.
+// The address is only for getting associated, though. Once we're on, we hand the interface back to DHCP
+// and wait for a proper lease, so the router always knows we have the address, and nobody else gets it.
+// It's usually the same address, and it's sorted before setup makes any requests.
+// If that doesn't work, we scan just the remembered channel, then every channel, and try the saved
+// networks that showed up, best first: ranked by signal strength, plus a bonus for how often each
+// one has worked before. Saved networks are found by a hash of their name, and then the name itself is
+// checked, so a hash collision can't send one network's password to another.
+////////////////////////////////////////////////////////////////////////
+
+#include "arduino.h"
+#include <WiFi.h>
+#include "FS.h"
+#include <LittleFS.h>
+#include "ArduinoJson.h"
+#include "wifiScan.h"
+
+const char * wifiMemPath = "/wifi.dat";
+const uint32_t wifiMemMagic = 0x57494633; //"WIF3"; bump if WifiMemory changes
+const int maxKnown = 8; //networks we keep a success count for
+const int knownTableSize = 16; //hash table slots for looking up saved networks; a power of 2, more than the saved networks
+const unsigned long directTimeout = 1500; //how long to give a direct reconnect
+const unsigned long joinTimeout = 8000; //and a normal one
+const unsigned long leaseTimeout = 4000; //how long to wait for DHCP after a direct reconnect
+
+//32 bit FNV-1a hash of a network name
+inline uint32_t hashName(const char * s){
+  uint32_t h = 2166136261UL;
+  while(*s) h = (h ^ (uint8_t)*s++) * 16777619UL;
+  return h;
+}
+
+//what's remembered between boots
+struct WifiMemory {
+  uint32_t magic;
+  char ssid[33]; //network of the last good connection
+  uint8_t bssid[6];
+  int32_t channel;
+  uint32_t ip, gateway, subnet, dns;
+  uint32_t knownHash[maxKnown]; //success counts, by network name
+  uint8_t wins[maxKnown];
+};
+
+class WifiConnect {
+  public:
+  WifiMemory mem;
+  int8_t slot[knownTableSize]; //index into the saved network list, or -1
+  uint32_t slotHash[knownTableSize];
+  JsonArray ssids, passwords; //the saved networks, from the config
+  int saved = -1; //saved network we connected to
+  unsigned long took = 0; //milliseconds it took
+
+  //load what we remembered last time
+  void begin(JsonArray s, JsonArray p){
+    ssids = s, passwords = p;
+    memset(&mem, 0, sizeof(mem));
+    File file = LittleFS.open(wifiMemPath);
+    if(file && !file.isDirectory()){
+      if(file.read((uint8_t *)&mem, sizeof(mem)) != sizeof(mem) || mem.magic != wifiMemMagic) memset(&mem, 0, sizeof(mem));
+      file.close();
+    }
+    index();
+  }
+
+  //hash the saved network names into the lookup table
+  void index(){
+    for(int i=0; i<knownTableSize; i++) slot[i] = -1;
+    for(int j=0; j<(int)ssids.size() && j<knownTableSize-1; j++){ //always leave an empty slot, so lookups stop
+      uint32_t h = hashName(ssids[j].as<const char *>());
+      int i = h & (knownTableSize-1);
+      while(slot[i] >= 0) i = (i+1) & (knownTableSize-1);
+      slot[i] = j, slotHash[i] = h;
+    }
+  }
+
+  //index of the saved network with this name hash, or -1
+  int lookup(uint32_t h){
+    for(int i=h & (knownTableSize-1); slot[i] >= 0; i = (i+1) & (knownTableSize-1)){
+      if(slotHash[i] == h) return slot[i];
+    }
+    return -1;
+  }
+
+  int lookup(const char * ssid){
+    int j = lookup(hashName(ssid));
+    return (j >= 0 && !strcmp(ssids[j].as<const char *>(), ssid)) ? j : -1; //make sure it's not a hash collision
+  }
+
+  //how many times a network has worked before
+  int wins(uint32_t h){
+    for(int i=0; i<maxKnown; i++) if(mem.knownHash[i] == h) return mem.wins[i];
+    return 0;
+  }
+
+  //connect to the best saved network we can find. Blocks, so it's for setup; returns true if we're on.
+  bool connect(){
+    unsigned long start = millis();
+    saved = -1;
+
+    //1: straight back to the last access point, on the same IP settings until DHCP gives us a lease
+    int j = mem.magic ? lookup(mem.ssid) : -1; //by name, so it's the network the password's for
+    if(j >= 0){
+      WiFi.config(IPAddress(mem.ip), IPAddress(mem.gateway), IPAddress(mem.subnet), IPAddress(mem.dns));
+      WiFi.begin(ssids[j].as<const char *>(), passwords[j].as<const char *>(), mem.channel, mem.bssid);
+      if(wait(directTimeout)){
+        renew();
+        return done(j, start);
+      }
+      Serial.println("Direct reconnect failed");
+      WiFi.disconnect();
+      WiFi.config(IPAddress(), IPAddress(), IPAddress()); //back to DHCP
+    }
+
+    //2: scan the last channel, and if none of ours are there, all of them
+    if(mem.channel) wifiScan.scanNow(mem.channel);
+    if(!tryScanned(start)){
+      wifiScan.scanNow();
+      if(!tryScanned(start)) return false;
+    }
+    return true;
+  }
+
+  private:
+  //try the saved networks in the scan list, best first
+  bool tryScanned(unsigned long start){
+    int order[maxNets], score[maxNets], n = 0;
+    for(int i=0; i<wifiScan.count; i++){
+      int j = lookup(wifiScan.nets[i].ssid);
+      if(j < 0) continue;
+      int s = wifiScan.nets[i].rssi + 6*min(wins(hashName(wifiScan.nets[i].ssid)), 5); //up to 30dB for a good record
+      int k = n++;
+      while(k > 0 && score[k-1] < s) order[k] = order[k-1], score[k] = score[k-1], k--; //insert in order
+      order[k] = i, score[k] = s;
+    }
+    for(int k=0; k<n; k++){
+      NetInfo & net = wifiScan.nets[order[k]];
+      int j = lookup(net.ssid);
+      Serial.print("Trying ");
+      Serial.println(net.ssid);
+      WiFi.begin(net.ssid, passwords[j].as<const char *>(), net.channel, net.bssid);
+      if(wait(joinTimeout)) return done(j, start);
+      WiFi.disconnect();
+    }
+    return false;
+  }
+
+  bool wait(unsigned long ms){
+    unsigned long t = millis();
+    while(WiFi.status() != WL_CONNECTED && millis() - t < ms) delay(20);
+    return WiFi.status() == WL_CONNECTED;
+  }
+
+  //associated on the remembered settings; switch to DHCP, and wait for it to give us an address
+  void renew(){
+    WiFi.config(IPAddress(), IPAddress(), IPAddress()); //no address: this starts the DHCP client, and stays connected
+    unsigned long t = millis();
+    while(!(uint32_t)WiFi.localIP() && millis() - t < leaseTimeout) delay(20);
+    if(!(uint32_t)WiFi.localIP()) Serial.println("No DHCP lease yet");
+  }
+
+  //we're on; remember how, for next time
+  bool done(int j, unsigned long start){
+    saved = j;
+    took = millis() - start;
+    Serial.print("Wi-Fi up in ");
+    Serial.print(took);
+    Serial.println("ms");
+
+    WifiMemory was = mem;
+    mem.magic = wifiMemMagic;
+    strlcpy(mem.ssid, ssids[j].as<const char *>(), sizeof(mem.ssid));
+    uint32_t h = hashName(mem.ssid);
+    uint8_t * b = WiFi.BSSID();
+    if(b) memcpy(mem.bssid, b, 6);
+    mem.channel = WiFi.channel();
+    if((uint32_t)WiFi.localIP()){ //keep the last address we had if DHCP hasn't come back yet
+      mem.ip = WiFi.localIP(), mem.gateway = WiFi.gatewayIP();
+      mem.subnet = WiFi.subnetMask(), mem.dns = WiFi.dnsIP();
+    }
+
+    int k = 0; //bump this network's count, or take the slot of the one with the fewest
+    for(int i=0; i<maxKnown; i++){
+      if(mem.knownHash[i] == h){
+        k = i;
+        break;
+      }
+      if(mem.wins[i] < mem.wins[k]) k = i;
+    }
+    if(mem.knownHash[k] != h) mem.knownHash[k] = h, mem.wins[k] = 0;
+    if(mem.wins[k] < 5) mem.wins[k]++; //it stops counting at 5; any more doesn't change the ranking
+
+    if(memcmp(&was, &mem, sizeof(mem))){ //only write to flash if something changed
+      File file = LittleFS.open(wifiMemPath, FILE_WRITE);
+      if(file){
+        file.write((const uint8_t *)&mem, sizeof(mem));
+        file.close();
+      }
+    }
+    return true;
+  }
+};
+
+WifiConnect wifiConnect;
+
+#endif
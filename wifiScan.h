@@ -0,0 +1,134 @@
+#ifndef WIFI_SCAN_OBJ
+#define WIFI_SCAN_OBJ
+
+////////////////////////////////////////////////////////////////////////
+// Background Wi-Fi scanning.
+// WiFi.scanNetworks() blocks for a few seconds, which froze the dog and the buttons. Here scans
+// run asynchronously, idle() picks up the results when they're ready, and the networks found
+// are kept in a list that's sorted strongest first, with one entry per network name (the strongest
+// access point for it). The list is always there to show, even while a new scan is running;
+// entries that haven't been seen for a while drop off.
+////////////////////////////////////////////////////////////////////////
+
+#include "arduino.h"
+#include <WiFi.h>
+
+const int maxNets = 16;
+const unsigned long netStaleTime = 120000; //forget networks that haven't shown up in a scan for 2 minutes
+
+struct NetInfo {
+  char ssid[33];
+  int32_t rssi;
+  uint8_t bssid[6]; //the strongest access point with this name
+  int32_t channel;
+  unsigned long seen; //millis() of the scan that last found it
+};
+
+class WifiScan {
+  public:
+  NetInfo nets[maxNets];
+  int count = 0;
+  bool scanning = false;
+  unsigned long lastScan = 0; //when the last scan finished
+  unsigned long scans = 0; //how many scans have finished
+
+  //start a scan in the background, if one isn't already running. Only channel is scanned, if it's set,
+  //which takes a tenth of the time of scanning them all.
+  void start(uint8_t channel = 0){
+    if(scanning) return;
+    if(WiFi.scanNetworks(true, false, false, 300, channel) == WIFI_SCAN_FAILED) return;
+    scanning = true;
+  }
+
+  //start a scan if the list is older than maxAge milliseconds (or there's never been one)
+  void refresh(unsigned long maxAge){
+    if(!scans || millis() - lastScan > maxAge) start();
+  }
+
+  //scan and wait for it; only for setup, before anything is on the move
+  void scanNow(uint8_t channel = 0){
+    start(channel);
+    while(scanning){
+      int follow = 0;
+      idle(follow);
+      delay(10);
+    }
+  }
+
+  //check on a running scan, and merge in the results when it's done. follow is an index into the list that
+  //someone's showing; if the list changes, it's moved to wherever that network ends up.
+  //returns true if the list changed.
+  bool idle(int & follow){
+    if(!scanning) return false;
+    int n = WiFi.scanComplete();
+    if(n == WIFI_SCAN_RUNNING) return false;
+    scanning = false;
+    if(n < 0) return false; //failed; we'll try again next refresh
+
+    char shown[33] = "";
+    if(follow >= 0 && follow < count) strcpy(shown, nets[follow].ssid);
+
+    unsigned long now = millis();
+    for(int i=0; i<n; i++) add(WiFi.SSID(i).c_str(), WiFi.RSSI(i), WiFi.BSSID(i), WiFi.channel(i), now);
+    WiFi.scanDelete(); //free up the scan results
+    lastScan = now;
+    scans++;
+
+    int k = 0;
+    for(int i=0; i<count; i++) if(now - nets[i].seen <= netStaleTime) nets[k++] = nets[i]; //drop the old ones
+    count = k;
+    sort();
+
+    follow = max(0, find(shown));
+    return true;
+  }
+
+  //index of the network called ssid, or -1
+  int find(const char * ssid){
+    for(int i=0; i<count; i++) if(!strcmp(nets[i].ssid, ssid)) return i;
+    return -1;
+  }
+
+  const char * name(int i){
+    return (i >= 0 && i < count) ? nets[i].ssid : "";
+  }
+
+  private:
+  //put one scan result into the list; keep the strongest access point for each name
+  void add(const char * ssid, int32_t rssi, const uint8_t * bssid, int32_t channel, unsigned long now){
+    if(!ssid[0]) return; //hidden networks
+    int i = find(ssid);
+    if(i >= 0 && nets[i].seen == now && nets[i].rssi >= rssi) return; //already have a stronger one from this scan
+    if(i < 0){
+      if(count < maxNets) i = count++;
+      else { //full; replace the weakest, if this one's stronger
+        i = 0;
+        for(int j=1; j<count; j++) if(nets[j].rssi < nets[i].rssi) i = j;
+        if(nets[i].rssi >= rssi) return;
+      }
+      strncpy(nets[i].ssid, ssid, 32);
+      nets[i].ssid[32] = 0;
+    }
+    nets[i].rssi = rssi;
+    if(bssid) memcpy(nets[i].bssid, bssid, 6);
+    nets[i].channel = channel;
+    nets[i].seen = now;
+  }
+
+  //strongest first; insertion sort, the list is short and mostly in order already
+  void sort(){
+    for(int j=1; j<count; j++){
+      NetInfo e = nets[j];
+      int k = j - 1;
+      while(k >= 0 && nets[k].rssi < e.rssi){
+        nets[k+1] = nets[k];
+        k--;
+      }
+      nets[k+1] = e;
+    }
+  }
+};
+
+WifiScan wifiScan;
+
+#endif
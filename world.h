@@ -0,0 +1,207 @@
+#ifndef WORLD_OBJ
+#define WORLD_OBJ
+
+////////////////////////////////////////////////////////////////////////
+// Entity store for everything that lives in the yard: pets, poops, balls and props.
+// Data is kept as parallel arrays (one array per field) instead of one object per thing,
+// so the per-tick update only walks the fields it needs. Entities keep their slot for
+// their whole life, so an index returned from spawn() stays valid until remove().
+////////////////////////////////////////////////////////////////////////
+
+#include "arduino.h"
+#include "playArea.h"
+#include "smallDogsAnim.h"
+
+//kinds of things the world can hold
+enum EntityKind : uint8_t {
+  ENT_NONE,
+  ENT_PET,
+  ENT_POOP,
+  ENT_BALL,
+  ENT_PROP
+};
+
+const int maxEntities = 32;
+
+//drawn size of each kind, in screen pixels; pets are drawn at 4x (128px), everything else at 2x (32px)
+const int entSize[] = {0, 128, 32, 32, 32};
+
+//a screen rectangle that grows to cover everything added to it; used for what needs redrawing
+struct Rect {
+  int x0, y0, x1, y1; //x1, y1 are one past the edge
+
+  Rect(){
+    clear();
+  }
+
+  void clear(){
+    x0 = y0 = 0x7fff;
+    x1 = y1 = -0x7fff;
+  }
+
+  bool empty(){
+    return x1 <= x0 || y1 <= y0;
+  }
+
+  void add(int X, int Y, int w, int h){
+    x0 = min(x0, X), y0 = min(y0, Y);
+    x1 = max(x1, X+w), y1 = max(y1, Y+h);
+  }
+
+  bool overlaps(int X, int Y, int w, int h){
+    return X < x1 && X+w > x0 && Y < y1 && Y+h > y0;
+  }
+};
+
+//velocities for the four walk actions, in the same order as the Action enum (down, right, up, left)
+const int walkDx[4] = {0, 10, 0, -10};
+const int walkDy[4] = {10, 0, -10, 0};
+
+class World {
+  public:
+  int count; //high water mark of used slots; slots below this may be ENT_NONE
+  EntityKind kind[maxEntities];
+  int x[maxEntities], y[maxEntities]; //top left corner of the sprite, in screen pixels
+  int dx[maxEntities], dy[maxEntities]; //pixels moved per step
+  int depth[maxEntities]; //added to y when sorting, normally the height of the sprite, so we sort by where it touches the ground
+  uint8_t act[maxEntities]; //animation row (an Action for pets)
+  uint8_t counter[maxEntities]; //animation frame (column of the sprite sheet)
+  bool left[maxEntities]; //facing left
+  bool driven[maxEntities]; //moved by someone else (like the Dog class), so update() leaves it alone
+  uint16_t stepTime[maxEntities]; //milliseconds between steps
+  unsigned long lastStep[maxEntities], timer[maxEntities]; //time of last step, and a general purpose timer (direction changes for pets)
+  unsigned long animStart[maxEntities]; //when the current animation started
+  uint8_t order[maxEntities]; //draw order, sorted back to front by sort()
+  int numOrder;
+  Rect dirty; //where static things have come or gone since the baked background was last redrawn
+  unsigned long clock; //simulation time of the last update(); anything started in between starts then
+
+  World(){
+    count = 0;
+    clock = 0;
+    numOrder = 0;
+    for(int i=0; i<maxEntities; i++) kind[i] = ENT_NONE;
+  }
+
+  //put a new thing in the world, returns its index, or -1 if the world is full.
+  int spawn(EntityKind k, int X, int Y){
+    int i = 0;
+    while(i<count && kind[i] != ENT_NONE) i++; //reuse the first empty slot
+    if(i>=maxEntities) return -1;
+    if(i == count) count++;
+    kind[i] = k;
+    x[i] = X, y[i] = Y;
+    dx[i] = dy[i] = 0;
+    depth[i] = entSize[k];
+    act[i] = counter[i] = 0;
+    left[i] = driven[i] = false;
+    stepTime[i] = 250;
+    lastStep[i] = timer[i] = 0;
+    animStart[i] = clock;
+    order[numOrder++] = i; //new things go on top, sort() fixes it up
+    if(isStatic(i)) dirty.add(X, Y, entSize[k], entSize[k]);
+    return i;
+  }
+
+  //spawn a pet that wanders about on its own.
+  int spawnPet(int X, int Y){
+    int i = spawn(ENT_PET, X, Y);
+    if(i>=0) walk(i, 1); //start out walking right
+    return i;
+  }
+
+  void remove(int i){
+    if(i<0 || i>=count || kind[i] == ENT_NONE) return;
+    if(isStatic(i)) dirty.add(x[i], y[i], entSize[kind[i]], entSize[kind[i]]);
+    kind[i] = ENT_NONE;
+    int n = 0;
+    for(int j=0; j<numOrder; j++) if(order[j] != i) order[n++] = order[j]; //drop it from the draw order
+    numOrder = n;
+    while(count && kind[count-1] == ENT_NONE) count--;
+  }
+
+  //remove every entity of a kind (ie, cleaning up all the poops)
+  void clear(EntityKind k){
+    for(int i=0; i<count; i++) if(kind[i] == k) remove(i);
+  }
+
+  int countOf(EntityKind k){
+    int n = 0;
+    for(int i=0; i<count; i++) if(kind[i] == k) n++;
+    return n;
+  }
+
+  //things that never move or animate, like poops. They're baked into the background instead of drawn every frame,
+  //so anyone moving one has to add where it was and where it went to dirty.
+  bool isStatic(int i){
+    return kind[i] == ENT_POOP;
+  }
+
+  //pets facing left and no longer walking get drawn flipped; mirrors Dog::shouldMirror()
+  bool mirror(int i){
+    return kind[i] == ENT_PET && left[i] && act[i] >= firstFlipRow;
+  }
+
+  //set a wandering pet walking in direction w (0-3, see walkDx)
+  void walk(int i, int w){
+    if(act[i] != w) animStart[i] = clock; //new direction, new animation
+    act[i] = w;
+    dx[i] = walkDx[w], dy[i] = walkDy[w];
+    if(dx[i]) left[i] = dx[i] < 0;
+    stepTime[i] = 150;
+    timer[i] = clock + 1000 + random(5000); //change direction again in 1-6 seconds
+  }
+
+  //check if a pet at X, Y is inside the walking area (see playArea.h)
+  bool petFits(int X, int Y){
+    return playArea.walkable(X, Y);
+  }
+
+  //////////////////////////////////////////////////////
+  // per tick update; steps everything that moves by itself.
+  // called from the dog's tick (see dogClass.h), so the other pets are on the same clock as the dog.
+  //////////////////////////////////////////////////////
+  void update(unsigned long now){
+    clock = now;
+    for(int i=0; i<count; i++){
+      if(kind[i] != ENT_PET || driven[i]) continue; //only free roaming pets move for now
+      counter[i] = clipFrame(dogClips[act[i]], dogFrames, now - animStart[i]);
+      if(now - lastStep[i] < stepTime[i]) continue;
+      lastStep[i] = now;
+
+      //pick a new direction if the timer ran out, or the next step would leave the walking area.
+      //the four directions are tried from a random starting point, so this always finishes in four tries.
+      if(timer[i] < now || !petFits(x[i]+dx[i], y[i]+dy[i])){
+        int start = random(4);
+        for(int t=0; t<4; t++){
+          int w = (start+t)%4;
+          if(w == act[i]) continue; //look for a different direction; if none fits, keep the current one
+          if(petFits(x[i]+walkDx[w], y[i]+walkDy[w])){
+            walk(i, w);
+            break;
+          }
+        }
+      }
+      if(petFits(x[i]+dx[i], y[i]+dy[i])) x[i] += dx[i], y[i] += dy[i];
+    }
+  }
+
+  //sort the draw order by where each thing touches the ground, so lower things are drawn over higher ones.
+  //insertion sort, since the order barely changes between frames and this is nearly free on sorted input.
+  void sort(){
+    for(int j=1; j<numOrder; j++){
+      uint8_t e = order[j];
+      int key = y[e] + depth[e];
+      int k = j - 1;
+      while(k >= 0 && y[order[k]] + depth[order[k]] > key){
+        order[k+1] = order[k];
+        k--;
+      }
+      order[k+1] = e;
+    }
+  }
+};
+
+World world;
+
+#endif